@@ -32,6 +32,12 @@ function(cutlass_add_library NAME)
   set(multiValueArgs)
   cmake_parse_arguments(_ "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
+  foreach(File ${__UNPARSED_ARGUMENTS})
+    if(File MATCHES ".*\.cu$")
+      set_source_files_properties(${File} PROPERTIES LANGUAGE CXX)
+    endif()
+  endforeach()
+
   set(TARGET_SOURCE_ARGS ${__UNPARSED_ARGUMENTS})
   set(${TARGET_ARGS_VAR} ${TARGET_SOURCE_ARGS} PARENT_SCOPE)
 
@@ -77,3 +83,18 @@ function(cutlass_add_executable NAME)
     cxx_std_17
   )
 endfunction()
+
+function(cutlass_target_sources NAME)
+  set(options)
+  set(oneValueArgs)
+  set(multiValueArgs)
+  cmake_parse_arguments(_ "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  foreach(File ${__UNPARSED_ARGUMENTS})
+    if(File MATCHES ".*\.cu$")
+      set_source_files_properties(${File} PROPERTIES LANGUAGE CXX)
+    endif()
+  endforeach()
+
+  target_sources(${NAME} ${__UNPARSED_ARGUMENTS})
+endfunction()
@@ -0,0 +1,282 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Problem shape helpers and score masks/biases for the Xe flash attention kernels.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Describes a ragged sequence length. Sequence b of the batch covers tokens
+// [cumulative_length[b], cumulative_length[b + 1]), so cumulative_length holds batch + 1 entries.
+// max_length is only used to size the grid; workgroups beyond the real length of a sequence exit early.
+struct VariableLength {
+  int max_length = 0;
+  int *cumulative_length = nullptr;
+
+  CUTLASS_HOST_DEVICE operator int() const { return max_length; }
+};
+
+template <class T>
+static constexpr bool is_variable_length_v = cute::is_same_v<cute::remove_cvref_t<T>, VariableLength>;
+
+// Returns the length and the starting token of sequence batch_coord.
+template <class SeqLen>
+CUTLASS_HOST_DEVICE cute::tuple<int, int> get_sequence_extent(SeqLen const &seq_len, int const &batch_coord) {
+  if constexpr (is_variable_length_v<SeqLen>) {
+    int const offset = seq_len.cumulative_length[batch_coord];
+    return cute::make_tuple(seq_len.cumulative_length[batch_coord + 1] - offset, offset);
+  } else {
+    return cute::make_tuple(static_cast<int>(seq_len), batch_coord * static_cast<int>(seq_len));
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Fusions mask or bias the scores S = Q K^T before the softmax. A fusion gives the range of KV columns a group of
+// query rows can attend to, so that the KV blocks outside of it are skipped, and updates the scores of the blocks it
+// cannot skip. Rows and columns are positions within the query and KV sequences of one head, and the diagonal is
+// aligned to the bottom right corner of S by causal_offset = seq_len_kv - seq_len_qo. Biases are expressed on the
+// scaled scores S * softmax_scale and are brought back to S by bias_scale = 1 / softmax_scale.
+
+struct NoFusion {
+  struct Arguments {};
+  using Params = Arguments;
+
+  // Whether the KV range depends on the rows, i.e. the subgroups of a workgroup may visit different KV blocks
+  static constexpr bool HasRowDependentRange = false;
+
+  static Params to_underlying_arguments(Arguments const &args) { return args; }
+
+  static bool can_implement(Arguments const &args, int seq_len_qo, int seq_len_kv) { return true; }
+
+  // KV columns [begin, end) that the query rows [row_begin, row_end) can attend to
+  CUTLASS_HOST_DEVICE static cute::tuple<int, int> get_kv_range(Params const &params, int row_begin, int row_end,
+                                                                 int causal_offset, int seq_len_kv) {
+    return {0, seq_len_kv};
+  }
+
+  // Whether update has to be applied to the tile [row_begin, row_end) x [col_begin, col_end)
+  CUTLASS_HOST_DEVICE static bool needs_update(Params const &params, int row_begin, int row_end, int col_begin,
+                                               int col_end, int causal_offset) {
+    return false;
+  }
+
+  // Returns the score of (row, col) for query head head_q of batch entry batch_coord
+  template <class T>
+  CUTLASS_HOST_DEVICE static T update(Params const &params, T score, int row, int col, int causal_offset,
+                                      int head_q, int batch_coord, T bias_scale) {
+    return score;
+  }
+};
+
+// Row i attends to the keys [0, i + causal_offset]
+struct CausalFusion {
+  struct Arguments {};
+  using Params = Arguments;
+
+  static constexpr bool HasRowDependentRange = true;
+
+  static Params to_underlying_arguments(Arguments const &args) { return args; }
+
+  // Every query needs at least one key
+  static bool can_implement(Arguments const &args, int seq_len_qo, int seq_len_kv) {
+    return seq_len_qo <= seq_len_kv;
+  }
+
+  CUTLASS_HOST_DEVICE static cute::tuple<int, int> get_kv_range(Params const &params, int row_begin, int row_end,
+                                                                 int causal_offset, int seq_len_kv) {
+    return {0, cute::min(seq_len_kv, row_end + causal_offset)};
+  }
+
+  // Only the blocks crossing the diagonal are masked
+  CUTLASS_HOST_DEVICE static bool needs_update(Params const &params, int row_begin, int row_end, int col_begin,
+                                               int col_end, int causal_offset) {
+    return col_end > row_begin + causal_offset + 1;
+  }
+
+  template <class T>
+  CUTLASS_HOST_DEVICE static T update(Params const &params, T score, int row, int col, int causal_offset,
+                                      int head_q, int batch_coord, T bias_scale) {
+    return col > row + causal_offset ? static_cast<T>(-INFINITY) : score;
+  }
+};
+
+// Local attention: row i attends to the keys [i + causal_offset - window_left, i + causal_offset + window_right].
+// A negative window leaves its side unbounded, e.g. window_right = 0 gives a causal sliding window.
+struct SlidingWindowFusion {
+  struct Arguments {
+    int window_left = -1;
+    int window_right = -1;
+  };
+  using Params = Arguments;
+
+  static constexpr bool HasRowDependentRange = true;
+
+  static Params to_underlying_arguments(Arguments const &args) { return args; }
+
+  static bool can_implement(Arguments const &args, int seq_len_qo, int seq_len_kv) { return true; }
+
+  CUTLASS_HOST_DEVICE static cute::tuple<int, int> get_kv_range(Params const &params, int row_begin, int row_end,
+                                                                 int causal_offset, int seq_len_kv) {
+    int const begin = params.window_left < 0 ? 0 : cute::max(0, row_begin + causal_offset - params.window_left);
+    int const end = params.window_right < 0
+                        ? seq_len_kv
+                        : cute::min(seq_len_kv, row_end + causal_offset + params.window_right);
+    return {begin, cute::max(begin, end)};
+  }
+
+  CUTLASS_HOST_DEVICE static bool needs_update(Params const &params, int row_begin, int row_end, int col_begin,
+                                               int col_end, int causal_offset) {
+    bool const left = params.window_left >= 0 && col_begin < row_end - 1 + causal_offset - params.window_left;
+    bool const right = params.window_right >= 0 && col_end - 1 > row_begin + causal_offset + params.window_right;
+    return left || right;
+  }
+
+  template <class T>
+  CUTLASS_HOST_DEVICE static T update(Params const &params, T score, int row, int col, int causal_offset,
+                                      int head_q, int batch_coord, T bias_scale) {
+    int const diagonal = row + causal_offset;
+    bool const masked = (params.window_left >= 0 && col < diagonal - params.window_left) ||
+                        (params.window_right >= 0 && col > diagonal + params.window_right);
+    return masked ? static_cast<T>(-INFINITY) : score;
+  }
+};
+
+// ALiBi: adds -slope[head_q] * |i + causal_offset - j| to the scores left visible by Mask
+template <class Mask = NoFusion>
+struct AlibiFusion {
+  struct Arguments {
+    // One slope per query head
+    float const *ptr_slopes = nullptr;
+    typename Mask::Arguments mask{};
+  };
+  struct Params {
+    float const *ptr_slopes;
+    typename Mask::Params mask;
+  };
+
+  static constexpr bool HasRowDependentRange = Mask::HasRowDependentRange;
+
+  static Params to_underlying_arguments(Arguments const &args) {
+    return {args.ptr_slopes, Mask::to_underlying_arguments(args.mask)};
+  }
+
+  static bool can_implement(Arguments const &args, int seq_len_qo, int seq_len_kv) {
+    return args.ptr_slopes != nullptr && Mask::can_implement(args.mask, seq_len_qo, seq_len_kv);
+  }
+
+  CUTLASS_HOST_DEVICE static cute::tuple<int, int> get_kv_range(Params const &params, int row_begin, int row_end,
+                                                                 int causal_offset, int seq_len_kv) {
+    return Mask::get_kv_range(params.mask, row_begin, row_end, causal_offset, seq_len_kv);
+  }
+
+  CUTLASS_HOST_DEVICE static bool needs_update(Params const &params, int row_begin, int row_end, int col_begin,
+                                               int col_end, int causal_offset) {
+    return true;
+  }
+
+  template <class T>
+  CUTLASS_HOST_DEVICE static T update(Params const &params, T score, int row, int col, int causal_offset,
+                                      int head_q, int batch_coord, T bias_scale) {
+    T const distance = static_cast<T>(cute::abs(row + causal_offset - col));
+    T const bias = -static_cast<T>(params.ptr_slopes[head_q]) * distance;
+    return Mask::update(params.mask, score, row, col, causal_offset, head_q, batch_coord, bias_scale) +
+           bias * bias_scale;
+  }
+};
+
+// Adds bias[b, h, i, j], located at b * stride_batch + h * stride_head + i * stride_row + j, to the scores left
+// visible by Mask. Zero strides broadcast the bias, e.g. over the batch or the heads.
+template <class ElementBias = float, class Mask = NoFusion>
+struct AdditiveBiasFusion {
+  struct Arguments {
+    ElementBias const *ptr_bias = nullptr;
+    int64_t stride_batch = 0;
+    int64_t stride_head = 0;
+    int64_t stride_row = 0;
+    typename Mask::Arguments mask{};
+  };
+  struct Params {
+    ElementBias const *ptr_bias;
+    int64_t stride_batch;
+    int64_t stride_head;
+    int64_t stride_row;
+    typename Mask::Params mask;
+  };
+
+  static constexpr bool HasRowDependentRange = Mask::HasRowDependentRange;
+
+  static Params to_underlying_arguments(Arguments const &args) {
+    return {args.ptr_bias, args.stride_batch, args.stride_head, args.stride_row,
+            Mask::to_underlying_arguments(args.mask)};
+  }
+
+  static bool can_implement(Arguments const &args, int seq_len_qo, int seq_len_kv) {
+    return args.ptr_bias != nullptr && Mask::can_implement(args.mask, seq_len_qo, seq_len_kv);
+  }
+
+  CUTLASS_HOST_DEVICE static cute::tuple<int, int> get_kv_range(Params const &params, int row_begin, int row_end,
+                                                                 int causal_offset, int seq_len_kv) {
+    return Mask::get_kv_range(params.mask, row_begin, row_end, causal_offset, seq_len_kv);
+  }
+
+  CUTLASS_HOST_DEVICE static bool needs_update(Params const &params, int row_begin, int row_end, int col_begin,
+                                               int col_end, int causal_offset) {
+    return true;
+  }
+
+  template <class T>
+  CUTLASS_HOST_DEVICE static T update(Params const &params, T score, int row, int col, int causal_offset,
+                                      int head_q, int batch_coord, T bias_scale) {
+    int64_t const offset = batch_coord * params.stride_batch + head_q * params.stride_head +
+                           row * params.stride_row + col;
+    return Mask::update(params.mask, score, row, col, causal_offset, head_q, batch_coord, bias_scale) +
+           static_cast<T>(params.ptr_bias[offset]) * bias_scale;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::fmha::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,8 @@
 #include "cutlass/epilogue/collective/detail.hpp"
 #include "cutlass/detail/layout.hpp"
 
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -74,7 +76,7 @@ public:
   static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
 
   static_assert(cute::rank(CtaTileMNK{}) == 3, "CtaTileMNK must be rank-3: [CTA_M, CTA_N, CTA_K]");
-  static_assert(cute::rank(StrideO{}) == 3, "StrideO must be rank-3: [seq_len, head_size, batch * num_heads]");
+  static_assert(cute::rank(StrideO{}) == 3, "StrideO must be rank-3: [seq_len, head_size, batch * num_heads_q]");
 
   using Trait_O = Copy_Traits<GmemTiledCopyO, StrideO>;
   using XE_Copy_O = decltype(make_tiled_copy(Copy_Atom<Trait_O, ElementO>{}
@@ -101,11 +103,16 @@ public:
   struct Arguments {
     ElementO const *ptr_O;
     StrideO dO;
+    // Optional log-sum-exp of every row of S, laid out as [batch * num_heads_q, seq_len_qo]
+    ElementLSE *ptr_LSE = nullptr;
   };
 
   // Device side epilogue params
   struct Params {
     XE_Copy_O xe_store_o;
+    ElementO const *ptr_O;
+    StrideO dO;
+    ElementLSE *ptr_LSE;
   };
 
   //
@@ -115,21 +122,55 @@ public:
   template <class ProblemShape>
   static constexpr Params to_underlying_arguments(ProblemShape const &problem_shape, Arguments const &args,
                                                   [[maybe_unused]] void *workspace) {
-    auto [batch, num_heads, seq_len, head_size] = problem_shape;
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo_, seq_len_kv, head_size] = problem_shape;
+    int seq_len_qo = seq_len_qo_;
+    int group_size = num_heads_q / num_heads_kv;
 
+    // O is written like Q is read, with the query heads of a KV group stacked along M
+    StrideO dO = args.dO;
+    get<2>(dO) *= group_size;
     XE_Copy_O xe_store_o = {};
     xe_store_o = make_tiled_copy(Copy_Atom<Trait_O, ElementO>{}.with(
                                       make_tensor(make_gmem_ptr(static_cast<ElementO const*>(args.ptr_O)), 
-                                                  make_layout(make_shape(seq_len, head_size, batch * num_heads), 
-                                                  args.dO))),
+                                                  make_layout(make_shape(group_size * seq_len_qo, head_size, batch * num_heads_kv), 
+                                                  dO))),
                                  Layout<Shape<_1, Int<SubgroupSize>>>{},
                                  make_layout(make_shape(get<0>(typename Trait_O::BlockShape{}),
                                                         get<1>(typename Trait_O::BlockShape{}) / Int<SubgroupSize>{})));
     return {
         xe_store_o,
+        args.ptr_O,
+        dO,
+        args.ptr_LSE,
     };
   }
 
+  // Rebinds O to the sequence handled by the current workgroup, using the same packing as the mainloop.
+  template <class ProblemShape>
+  CUTLASS_DEVICE static Params get_updated_copies(Params const &params, ProblemShape const &problem_shape,
+                                                  int const &l_coord) {
+    if constexpr (!cutlass::fmha::collective::is_variable_length_v<decltype(get<3>(ProblemShape{}))> &&
+                  !cutlass::fmha::collective::is_variable_length_v<decltype(get<4>(ProblemShape{}))>) {
+      return params;
+    } else {
+      auto [batch, num_heads_q, num_heads_kv, seq_len_var, seq_len_kv, head_size] = problem_shape;
+      int const group_size = num_heads_q / num_heads_kv;
+      int const batch_coord = l_coord / num_heads_kv;
+      int const head_coord = l_coord % num_heads_kv;
+      auto [seq_len, seq_offset] = cutlass::fmha::collective::get_sequence_extent(seq_len_var, batch_coord);
+      int64_t const row_offset = static_cast<int64_t>(seq_offset) * num_heads_q + head_coord * group_size * seq_len;
+
+      XE_Copy_O xe_store_o = make_tiled_copy(Copy_Atom<Trait_O, ElementO>{}.with(
+                                                 make_tensor(make_gmem_ptr(params.ptr_O + row_offset * head_size),
+                                                             make_layout(make_shape(group_size * seq_len, head_size, 1), params.dO))),
+                                             Layout<Shape<_1, Int<SubgroupSize>>>{},
+                                             make_layout(make_shape(get<0>(typename Trait_O::BlockShape{}),
+                                                                    get<1>(typename Trait_O::BlockShape{}) / Int<SubgroupSize>{})));
+      return {xe_store_o, params.ptr_O, params.dO,
+              params.ptr_LSE == nullptr ? nullptr : params.ptr_LSE + row_offset};
+    }
+  }
+
   template <class ProblemShape>
   static size_t get_workspace_size(ProblemShape const &problem_shape, Arguments const &args) {
     return 0;
@@ -150,6 +191,7 @@ public:
   CUTLASS_HOST_DEVICE
   CollectiveEpilogueAttention(Params const &params_, TensorStorage const &) : params(params_) {}
 
+  // problem_shape holds the extents of the current sequence, i.e. plain integers even for variable length problems.
   template <class ProblemShape, class TileCoord, class FragOut, class FragMax, class FragSum, class TiledMma>
   CUTLASS_DEVICE void operator()(ProblemShape problem_shape, TileCoord tile_coord, FragOut &out, FragMax const &max,
                                  FragSum &sum, TiledMma tiled_mma, ElementCompute const &softmax_scale) {
@@ -165,6 +207,9 @@ public:
     static constexpr int Vec = (get<0>(MmaAtomShape()) * get<1>(MmaAtomShape())) / SubgroupSize;
 
     auto g = syclcompat::get_nd_item<1>().get_sub_group();
+    const int item_id = g.get_local_id()[0];
+    // Each work item holds the running max of row item_id, see CollectiveSoftmaxEpilogue::reduce_max
+    ElementCompute lse = -INFINITY;
 
     CUTLASS_PRAGMA_UNROLL
     for (int y = 0; y < FragsM; y++) {
@@ -177,13 +222,112 @@ public:
         for (int z = 0; z < FragsN; z++) {
           out(x, y, z) *= cur_scale;
         }
+        if (indx == item_id) {
+          // softmax_scale already contains log2(e), so this is the log-sum-exp in base 2
+          lse = max * softmax_scale + sycl::log2(cur_sum);
+        }
+      }
+    }
+
+    store_output(problem_shape, tile_coord, out, tiled_mma);
+    store_lse(problem_shape, tile_coord, lse * static_cast<ElementCompute>(M_LN2), tiled_mma);
+  }
+
+  // Combines the results of a split-KV launch. Split s wrote its normalized output and LSE through operator() into
+  // slice (s * batch * num_heads_kv + partial_l_coord) of the partial tensors described by partial and partial_shape.
+  // The outputs are rescaled by exp(lse_s - lse) and summed, and the result is written to O (and LSE).
+  template <class ProblemShape, class PartialShape, class TileCoord, class FragOut, class TiledMma>
+  CUTLASS_DEVICE void reduce_kv_splits(ProblemShape problem_shape, PartialShape partial_shape, TileCoord tile_coord,
+                                       Params const &partial, int num_kv_splits, int partial_l_coord, FragOut &out,
+                                       TiledMma tiled_mma) {
+
+    using namespace cute;
+
+    using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+    using SubgroupTileShape = decltype(cute::shape_div(CtaTileMNK{}, take<1, 4>(typename TiledMma::ThrLayoutVMNK{}.shape())));
+    using FragsShape = decltype(cute::shape_div(take<0, 2>(SubgroupTileShape{}), take<0, 2>(MmaAtomShape())));
+
+    static constexpr int FragsM = get<0>(FragsShape{});
+    static constexpr int FragsN = get<1>(FragsShape{});
+    static constexpr int Vec = (get<0>(MmaAtomShape()) * get<1>(MmaAtomShape())) / SubgroupSize;
+    static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo_, seq_len_kv, head_size] = problem_shape;
+    auto [m_coord, n_coord, k_coord, l_coord] = tile_coord;
+    int const group_size = num_heads_q / num_heads_kv;
+    int const seq_len_qo = group_size * seq_len_qo_;
+    int const max_seq_len_qo = group_size * get<3>(partial_shape);
+    int const num_l = batch * num_heads_kv;
+
+    Tensor mO_partial = make_tensor(make_gmem_ptr(partial.ptr_O),
+                                    make_layout(make_shape(max_seq_len_qo, head_size, num_kv_splits * num_l), partial.dO));
+    Tensor mLSE_partial = make_tensor(make_gmem_ptr(partial.ptr_LSE),
+                                      make_layout(make_shape(max_seq_len_qo, num_kv_splits * num_l)));
+
+    auto g = syclcompat::get_nd_item<1>().get_sub_group();
+    const int item_id = g.get_local_id()[0];
+    const int m_sg = get_sub_group_id() / ATOM_N;
+    const int n_sg = get_sub_group_id() % ATOM_N;
+    const int seq_coord = m_coord * get<0>(CtaTileMNK{}) + m_sg * get<0>(SubgroupTileShape{});
+    const int col_coord = n_coord * get<1>(CtaTileMNK{}) + n_sg * get<1>(SubgroupTileShape{}) + item_id;
+    ElementCompute lse = -INFINITY;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int y = 0; y < FragsM; y++) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int x = 0; x < Vec; x++) {
+        int indx = y * Vec + x;
+        int row = seq_coord + indx;
+        CUTLASS_PRAGMA_UNROLL
+        for (int z = 0; z < FragsN; z++) {
+          out(x, y, z) = ElementCompute{0};
+        }
+        if (row >= seq_len_qo) {
+          continue;
+        }
+        ElementCompute lse_max = -INFINITY;
+        for (int split = 0; split < num_kv_splits; split++) {
+          lse_max = sycl::max(lse_max, static_cast<ElementCompute>(mLSE_partial(row, split * num_l + partial_l_coord)));
+        }
+        // Every split of this row was fully masked
+        if (lse_max == -INFINITY) {
+          continue;
+        }
+        ElementCompute weight_sum{0};
+        for (int split = 0; split < num_kv_splits; split++) {
+          int partial_l = split * num_l + partial_l_coord;
+          ElementCompute weight = sycl::native::exp(mLSE_partial(row, partial_l) - lse_max);
+          weight_sum += weight;
+          CUTLASS_PRAGMA_UNROLL
+          for (int z = 0; z < FragsN; z++) {
+            out(x, y, z) += weight * mO_partial(row, col_coord + z * get<1>(MmaAtomShape()), partial_l);
+          }
+        }
+        auto scale = sycl::native::recip(weight_sum);
+        CUTLASS_PRAGMA_UNROLL
+        for (int z = 0; z < FragsN; z++) {
+          out(x, y, z) *= scale;
+        }
+        if (indx == item_id) {
+          lse = lse_max + sycl::log(weight_sum);
+        }
       }
     }
 
+    store_output(problem_shape, tile_coord, out, tiled_mma);
+    store_lse(problem_shape, tile_coord, lse, tiled_mma);
+  }
+
+  // Stores an accumulator tile as is, also used by the backward kernels to write the gradients
+  template <class ProblemShape, class TileCoord, class FragOut, class TiledMma>
+  CUTLASS_DEVICE void store_output(ProblemShape problem_shape, TileCoord tile_coord, FragOut &out, TiledMma tiled_mma) {
+    using SubgroupTileShape = decltype(cute::shape_div(CtaTileMNK{}, take<1, 4>(typename TiledMma::ThrLayoutVMNK{}.shape())));
+
     // Indexing variables
-    auto [batch, num_heads, seq_len, head_size] = problem_shape;
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    int const group_size = num_heads_q / num_heads_kv;
     // Represent the full output tensor
-    Tensor mO_mnl = cute::get_pvc_tensor(make_shape(seq_len, head_size, batch * num_heads));
+    Tensor mO_mnl = cute::get_pvc_tensor(make_shape(group_size * seq_len_qo, head_size, batch * num_heads_kv));
     
     auto [m_coord, n_coord, k_coord, l_coord] = tile_coord;
     // Tile the output tensor per WG
@@ -202,6 +346,30 @@ public:
   }
 
 private:
+  // Every work item holds the LSE of one row of its subgroup tile. All the subgroups and workgroups along N
+  // compute the same values, so only the first one writes them.
+  template <class ProblemShape, class TileCoord, class TiledMma>
+  CUTLASS_DEVICE void store_lse(ProblemShape problem_shape, TileCoord tile_coord, ElementCompute const &lse,
+                                TiledMma tiled_mma) {
+    using SubgroupTileShape = decltype(cute::shape_div(CtaTileMNK{}, take<1, 4>(typename TiledMma::ThrLayoutVMNK{}.shape())));
+    static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+    if (params.ptr_LSE == nullptr) {
+      return;
+    }
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    auto [m_coord, n_coord, k_coord, l_coord] = tile_coord;
+    // Rows are packed like O, which matches the [batch * num_heads_q, seq_len_qo] layout of the LSE
+    int const num_rows = (num_heads_q / num_heads_kv) * seq_len_qo;
+    auto m_sg = get_sub_group_id() / ATOM_N;
+    auto n_sg = get_sub_group_id() % ATOM_N;
+    int row = m_coord * get<0>(CtaTileMNK{}) + m_sg * get<0>(SubgroupTileShape{}) +
+              static_cast<int>(ThreadIdxX()) % SubgroupSize;
+    if (n_coord == 0 && n_sg == 0 && row < num_rows) {
+      params.ptr_LSE[static_cast<int64_t>(l_coord) * num_rows + row] = static_cast<ElementLSE>(lse);
+    }
+  }
+
   Params const &params;
 };
 
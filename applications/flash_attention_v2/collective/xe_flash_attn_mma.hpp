@@ -38,6 +38,8 @@
 #include "cute/algorithm/gemm.hpp"
 #include "cute/tensor_predicate.hpp"
 
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::collective {
@@ -60,7 +62,9 @@ CUTLASS_DEVICE auto convert_type(Tensor<Engine, Layout> const &tensor) {
 
 template <class DispatchPolicy, class TileShape_, class ElementQ_, class StrideQ_, class ElementK_, class StrideK_,
           class ElementV_, class StrideV_, class TiledMma_, class GmemTiledCopyQ_, class GmemTiledCopyK_,
-          class GmemTiledCopyV_, bool CausalMask_>
+          class GmemTiledCopyV_, bool CausalMask_,
+          class Fusion_ = cute::conditional_t<CausalMask_, cutlass::fmha::collective::CausalFusion,
+                                              cutlass::fmha::collective::NoFusion>>
 struct CollectiveMmaAttention {
   static_assert(cutlass::detail::dependent_false<ElementQ_>, "Could not find a mainloop specialization.");
 };
@@ -69,9 +73,10 @@ struct CollectiveMmaAttention {
 
 template <int Stages, class TileShape_, class ElementQ_, class StrideQ_, class ElementK_, class StrideK_,
           class ElementV_, class StrideV_, class TiledMma_, class GmemTiledCopyQ_, class GmemTiledCopyK_,
-          class GmemTiledCopyV_, bool CausalMask_>
+          class GmemTiledCopyV_, bool CausalMask_, class Fusion_>
 struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, StrideQ_, ElementK_, StrideK_, ElementV_,
-                              StrideV_, TiledMma_, GmemTiledCopyQ_, GmemTiledCopyK_, GmemTiledCopyV_, CausalMask_> {
+                              StrideV_, TiledMma_, GmemTiledCopyQ_, GmemTiledCopyK_, GmemTiledCopyV_, CausalMask_,
+                              Fusion_> {
   //
   // Type Aliases
   //
@@ -91,6 +96,8 @@ struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, S
   using ArchTag = typename DispatchPolicy::ArchTag;
 
   static constexpr bool CausalMask = CausalMask_;
+  // Mask and bias applied to the scores, see fmha_fusion.hpp
+  using Fusion = Fusion_;
   static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
 
   using MmaAtomShape = typename TiledMma::AtomShape_MNK;
@@ -143,6 +150,14 @@ struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, S
     StrideK dK;
     ElementV const *ptr_V;
     StrideV dV;
+    // Paged KV cache. When ptr_page_table is set, K and V hold num_pages pages packed as
+    // [num_pages, num_heads_kv, page_size, head_size] and dK/dV describe that layout. The page table is a
+    // [batch, num_pages_per_seq] row-major array mapping the logical pages of every sequence to physical pages.
+    int const *ptr_page_table = nullptr;
+    int page_size = 0;
+    int num_pages_per_seq = 0;
+    int num_pages = 0;
+    typename Fusion::Arguments fusion{};
   };
 
   struct Params {
@@ -153,6 +168,11 @@ struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, S
     TensorQ_mkl mQ;
     TensorK_nkl mK;
     TensorV_nkl mV;
+
+    int const *ptr_page_table;
+    int page_size;
+    int num_pages_per_seq;
+    typename Fusion::Params fusion;
   };
 
   //
@@ -166,14 +186,27 @@ struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, S
                                                   void *workspace) {
     (void)workspace;
 
-    auto [batch, num_heads, seq_len, head_size] = problem_shape;
-
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo_, seq_len_kv_, head_size] = problem_shape;
+    // For variable length problems this binds the padded extents; the kernel rebinds each sequence
+    // through get_updated_copies.
+    int seq_len_qo = seq_len_qo_;
+    int seq_len_kv = seq_len_kv_;
+    int group_size = num_heads_q / num_heads_kv;
+
+    // The query heads sharing a KV head are adjacent in Q, so they are read as a single
+    // (group_size * seq_len_qo, head_size) matrix per (batch, KV head)
+    StrideQ dQ = args.dQ;
+    get<2>(dQ) *= group_size;
     auto tensorQ = make_tensor(make_gmem_ptr(static_cast<ElementQ const *>(args.ptr_Q)),
-                               make_layout(make_shape(seq_len, head_size, batch * num_heads), args.dQ));
+                               make_layout(make_shape(group_size * seq_len_qo, head_size, batch * num_heads_kv), dQ));
+    // A paged cache is addressed one (page, head) pair at a time
+    bool const is_paged = args.ptr_page_table != nullptr;
+    int const kv_rows = is_paged ? args.page_size : seq_len_kv;
+    int const kv_batches = is_paged ? args.num_pages * num_heads_kv : batch * num_heads_kv;
     auto tensorK = make_tensor(make_gmem_ptr(static_cast<ElementK const *>(args.ptr_K)),
-                               make_layout(make_shape(seq_len, head_size, batch * num_heads), args.dK));
+                               make_layout(make_shape(kv_rows, head_size, kv_batches), args.dK));
     auto tensorV = make_tensor(make_gmem_ptr(static_cast<ElementV const *>(args.ptr_V)),
-                               make_layout(make_shape(head_size, seq_len, batch * num_heads), args.dV));
+                               make_layout(make_shape(head_size, kv_rows, kv_batches), args.dV));
 
     XE_Copy_Q copyQ = make_tiled_copy(atom_load_Q{}.with(tensorQ),
                                       Layout<CopyThreadShape>{},
@@ -184,8 +217,92 @@ struct CollectiveMmaAttention<MainloopIntelPVC<Stages>, TileShape_, ElementQ_, S
     XE_Copy_V copyV = make_tiled_copy(atom_load_V{}.with(tensorV),
                                       Layout<CopyThreadShape>{},
                                       make_layout(shape_div(typename traits_load_V::BlockShape{}, CopyThreadShape{})));
-  
-    return Params{copyQ, copyK, copyV, tensorQ, tensorK, tensorV};
+
+    return Params{copyQ,   copyK,   copyV,
+                  tensorQ, tensorK, tensorV,
+                  args.ptr_page_table, args.page_size, args.num_pages_per_seq,
+                  Fusion::to_underlying_arguments(args.fusion)};
+  }
+
+  template <class ProblemShape>
+  static bool can_implement(ProblemShape const &problem_shape, Arguments const &args) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    // Variable length sequences are only known on the device, so their longest lengths are checked
+    if (!Fusion::can_implement(args.fusion, static_cast<int>(seq_len_qo), static_cast<int>(seq_len_kv))) {
+      return false;
+    }
+    if (args.ptr_page_table == nullptr) {
+      return true;
+    }
+    // Every KV block of a subgroup must lie within a single page
+    return args.page_size > 0 && args.page_size % SG_N == 0 && args.num_pages > 0 &&
+           args.num_pages_per_seq * args.page_size >= static_cast<int>(seq_len_kv);
+  }
+
+  // Maps the logical KV block nblock of the sequence (batch_coord, head_coord) to the (block, l) coordinate of
+  // the K/V tensors. Dense caches keep the sequence at l_coord, while paged caches look up the physical page.
+  CUTLASS_DEVICE static cute::tuple<int, int> get_kv_block_coord(Params const &params, int nblock, int batch_coord,
+                                                                 int head_coord, int num_heads, int l_coord) {
+    if (params.ptr_page_table == nullptr) {
+      return {nblock, l_coord};
+    }
+    int const token = nblock * SG_N;
+    // Blocks past the end of the sequence are only prefetched, clamp them to the last page of the table
+    int const logical_page = cute::min(token / params.page_size, params.num_pages_per_seq - 1);
+    int const physical_page = params.ptr_page_table[batch_coord * params.num_pages_per_seq + logical_page];
+    return {(token % params.page_size) / SG_N, physical_page * num_heads + head_coord};
+  }
+
+  // Rebinds Q, K and V to the sequence handled by the current workgroup. Variable length sequences are
+  // packed back to back in [batch, num_heads, seq_len, head_size] order, so each (batch, head) pair is a
+  // dense (seq_len, head_size) block starting at (cumulative_length[b] * num_heads + h * seq_len) rows.
+  // Q and K/V follow their own cumulative lengths and head counts, and l_coord is a (batch, KV head) pair.
+  // A paged KV cache is left as is, as its sequences are located through the page table.
+  template <class ProblemShape>
+  CUTLASS_DEVICE static Params get_updated_copies(Params const &params, ProblemShape const &problem_shape,
+                                                  int const &l_coord) {
+    if constexpr (!cutlass::fmha::collective::is_variable_length_v<decltype(get<3>(ProblemShape{}))> &&
+                  !cutlass::fmha::collective::is_variable_length_v<decltype(get<4>(ProblemShape{}))>) {
+      return params;
+    } else {
+      auto [batch, num_heads_q, num_heads_kv, seq_len_qo_var, seq_len_kv_var, head_size] = problem_shape;
+      int const group_size = num_heads_q / num_heads_kv;
+      int const batch_coord = l_coord / num_heads_kv;
+      int const head_coord = l_coord % num_heads_kv;
+      auto [seq_len_qo, seq_offset_qo] = cutlass::fmha::collective::get_sequence_extent(seq_len_qo_var, batch_coord);
+      auto [seq_len_kv, seq_offset_kv] = cutlass::fmha::collective::get_sequence_extent(seq_len_kv_var, batch_coord);
+      int64_t const offset_qo =
+          (static_cast<int64_t>(seq_offset_qo) * num_heads_q + head_coord * group_size * seq_len_qo) * head_size;
+      int64_t const offset_kv =
+          (static_cast<int64_t>(seq_offset_kv) * num_heads_kv + head_coord * seq_len_kv) * head_size;
+
+      auto tensorQ = make_tensor(make_gmem_ptr(raw_pointer_cast(params.mQ.data()) + offset_qo),
+                                 make_layout(make_shape(group_size * seq_len_qo, head_size, 1), params.mQ.stride()));
+      XE_Copy_Q copyQ = make_tiled_copy(atom_load_Q{}.with(tensorQ),
+                                        Layout<CopyThreadShape>{},
+                                        make_layout(shape_div(typename traits_load_Q::BlockShape{}, CopyThreadShape{})));
+      if (params.ptr_page_table != nullptr) {
+        return Params{copyQ,   params.gmem_tiled_copy_k, params.gmem_tiled_copy_v,
+                      tensorQ, params.mK,                params.mV,
+                      params.ptr_page_table, params.page_size, params.num_pages_per_seq, params.fusion};
+      }
+
+      auto tensorK = make_tensor(make_gmem_ptr(raw_pointer_cast(params.mK.data()) + offset_kv),
+                                 make_layout(make_shape(seq_len_kv, head_size, 1), params.mK.stride()));
+      auto tensorV = make_tensor(make_gmem_ptr(raw_pointer_cast(params.mV.data()) + offset_kv),
+                                 make_layout(make_shape(head_size, seq_len_kv, 1), params.mV.stride()));
+
+      XE_Copy_K copyK = make_tiled_copy(atom_load_K{}.with(tensorK),
+                                        Layout<CopyThreadShape>{},
+                                        make_layout(shape_div(typename traits_load_K::BlockShape{}, CopyThreadShape{})));
+      XE_Copy_V copyV = make_tiled_copy(atom_load_V{}.with(tensorV),
+                                        Layout<CopyThreadShape>{},
+                                        make_layout(shape_div(typename traits_load_V::BlockShape{}, CopyThreadShape{})));
+
+      return Params{copyQ,   copyK,   copyV,
+                    tensorQ, tensorK, tensorV,
+                    params.ptr_page_table, params.page_size, params.num_pages_per_seq, params.fusion};
+    }
   }
 
   template <class FragAccum, class TensorQ, class TensorK, class FragSrc>
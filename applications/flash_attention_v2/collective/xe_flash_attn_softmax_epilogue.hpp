@@ -106,7 +106,8 @@ public:
   template <int Vec, int FragsM, int FragsN, class FragAcc, class FragMax, class FragSum>
   CUTLASS_DEVICE void scale_exp_log2(FragAcc &frag_s, FragMax const &max, FragSum &sum) {
     auto g = syclcompat::get_nd_item<1>().get_sub_group();
-    const auto max_scale = max * params.scale;
+    // A row can be fully masked in the first block of a KV split; keep exp2 away from (-inf) - (-inf)
+    const auto max_scale = max == -INFINITY ? Element{0} : max * params.scale;
     CUTLASS_PRAGMA_UNROLL
     for (int indx = 0; indx < Vec * FragsM; indx++) {
       const auto max_scale_bcast = group_broadcast(g, max_scale, indx);
@@ -150,7 +151,7 @@ public:
     static_assert(Vec * FragsM == 16, " the number of reg_max per workitem should be adopted accordingly.");
     if (!is_first) {
       auto g = syclcompat::get_nd_item<1>().get_sub_group();
-      Element max_scale{max * params.scale};
+      Element max_scale{max == -INFINITY ? Element{0} : max * params.scale};
       Element exp_scale{sycl::native::exp2(max_prev * params.scale - max_scale)};
       CUTLASS_PRAGMA_UNROLL
       for (int indx = 0; indx < Vec * FragsM; indx++) {
@@ -0,0 +1,495 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/workspace.h"
+
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
+#include "flash_attention_v2/collective/xe_flash_attn_mma.hpp"
+
+namespace cutlass::gemm::kernel {
+
+// Gradients computed by a GemmUniversalAttentionBwd launch
+struct FlashAttnBwdDQ {};   // dQ, and D = rowsum(dO * O) into the workspace
+struct FlashAttnBwdDKDV {}; // dK and dV, reading D from the workspace
+
+template <class ProblemShape, class CollectiveMainloop, class CollectiveEpilogue, class Operation>
+class GemmUniversalAttentionBwd;
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Backward pass of GemmUniversalAttention. Neither S nor P is stored: both kernels recompute the tiles of P from Q, K
+// and the LSE written by the forward epilogue, P = exp(S * softmax_scale - LSE).
+//  - FlashAttnBwdDQ walks the KV sequence of a tile of query rows and computes dP = dO V^T, dS = P * (dP - D) and
+//    dQ = softmax_scale * dS K.
+//  - FlashAttnBwdDKDV walks the query rows of a tile of keys and computes dV = P^T dO and dK = softmax_scale * dS^T Q.
+// Every output tile is owned by a single workgroup, so no atomics are needed. The DKDV kernel reads the D written by
+// the DQ kernel, so both must be launched in that order with the same workspace.
+//
+// All the products are done with the forward mainloop, whose Q, K and V copies are bound to the operands of each one:
+// its A operand is read like Q, its B operand like K, and the second product reads its B operand like V. The query
+// heads of a group are stacked along the rows like in the forward kernel. Q, K, V, O, dO and the gradients must be
+// packed [batch, num_heads, seq_len, head_size] tensors.
+template <class ProblemShape_, class CollectiveMainloop_, class CollectiveEpilogue_, class Operation_>
+class GemmUniversalAttentionBwd {
+
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  using Operation = Operation_;
+
+  static_assert(rank(ProblemShape{}) == 6,
+                "ProblemShape{} should be <batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size>");
+  static_assert(!cutlass::fmha::collective::is_variable_length_v<decltype(get<3>(ProblemShape{}))> &&
+                !cutlass::fmha::collective::is_variable_length_v<decltype(get<4>(ProblemShape{}))>,
+                "The flash attention backward pass does not support variable length sequences.");
+  static_assert(cute::is_same_v<Operation, FlashAttnBwdDQ> || cute::is_same_v<Operation, FlashAttnBwdDKDV>,
+                "Unknown flash attention backward operation.");
+  static constexpr bool IsDQ = cute::is_same_v<Operation, FlashAttnBwdDQ>;
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::WorkgroupTileShape;
+  using WorkgroupTileShape = TileShape;
+  using TiledMma = typename CollectiveMainloop::TiledMma;
+  using ArchTag = typename CollectiveMainloop::ArchTag;
+  using ElementQ = typename CollectiveMainloop::ElementQ;
+  using StrideQ = typename CollectiveMainloop::StrideQ;
+  using StrideK = typename CollectiveMainloop::StrideK;
+  using StrideV = typename CollectiveMainloop::StrideV;
+  using DispatchPolicy = typename CollectiveMainloop::DispatchPolicy;
+  using ElementAccumulator = typename CollectiveMainloop::ElementAccumulator;
+  using MainloopParams = typename CollectiveMainloop::Params;
+
+  // Every tensor is read in several roles, e.g. K is the B operand of S and the second operand of dQ
+  static_assert(cute::is_same_v<ElementQ, typename CollectiveMainloop::ElementK> &&
+                cute::is_same_v<ElementQ, typename CollectiveMainloop::ElementV>,
+                "The flash attention backward pass requires Q, K and V of the same type.");
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using ElementO = typename CollectiveEpilogue::ElementO;
+  using StrideO = typename CollectiveEpilogue::StrideO;
+  using ElementLSE = typename CollectiveEpilogue::ElementLSE;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+  static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue::ElementAccumulator>,
+                "Mainloop and epilogue do not agree on accumulator value type.");
+
+  static constexpr int SharedStorageSize = 0;
+
+  static constexpr bool CausalMask = CollectiveMainloop::CausalMask;
+  static_assert(cute::is_same_v<typename CollectiveMainloop::Fusion,
+                                cute::conditional_t<CausalMask, cutlass::fmha::collective::CausalFusion,
+                                                    cutlass::fmha::collective::NoFusion>>,
+                "The flash attention backward pass only supports the causal mask.");
+  static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
+  static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+  using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;           // 8,16,16
+  using SubgroupTileShape = typename CollectiveMainloop::SubgroupTileShape; //(16,64,64)
+
+  static constexpr int BLK_M = CollectiveMainloop::BLK_M;
+  static constexpr int BLK_N = CollectiveMainloop::BLK_N;
+
+  static constexpr int ATOM_M = CollectiveMainloop::ATOM_M;
+  static constexpr int ATOM_N = CollectiveMainloop::ATOM_N;
+
+  static constexpr int SG_M = CollectiveMainloop::SG_M;
+  static constexpr int SG_N = CollectiveMainloop::SG_N;
+
+  static constexpr int Vec = (get<0>(MmaAtomShape()) * get<1>(MmaAtomShape())) / SubgroupSize; // 8
+  using FragsShape = decltype(cute::shape_div(take<0, 2>(SubgroupTileShape{}), take<0, 2>(MmaAtomShape())));
+  static constexpr int FragsM = get<0>(FragsShape{}); // 2
+  static constexpr int FragsN = get<1>(FragsShape{}); // 4
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+    EpilogueTensorStorage epilogue;
+  };
+
+  // Device side arguments
+  struct Arguments {
+    GemmUniversalMode mode{};
+    ProblemShape problem_shape{};
+    ElementQ const *ptr_Q;
+    ElementQ const *ptr_K;
+    ElementQ const *ptr_V;
+    // Output and log-sum-exp of the forward pass
+    ElementO const *ptr_O;
+    ElementLSE const *ptr_LSE;
+    // Gradient of the output
+    ElementQ const *ptr_dO;
+    ElementO *ptr_dQ;
+    ElementO *ptr_dK;
+    ElementO *ptr_dV;
+    float softmax_scale;
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    GemmUniversalMode mode;
+    ProblemShape problem_shape;
+    // DQ: S = Q K^T and dQ = dS K. DKDV: S^T = K Q^T and dV = P^T dO.
+    MainloopParams mainloop_s;
+    // DQ: dP = dO V^T. DKDV: dP^T = V dO^T and dK = dS^T Q.
+    MainloopParams mainloop_dp;
+    // DQ: dQ. DKDV: dK.
+    EpilogueParams epilogue;
+    // DKDV: dV.
+    EpilogueParams epilogue_dv;
+    ElementO const *ptr_O;
+    ElementLSE const *ptr_LSE;
+    ElementQ const *ptr_dO;
+    ElementAccumulator *ptr_D;
+    ElementAccumulator softmax_scale;
+  };
+
+  //
+  // Methods
+  //
+
+  // Query heads sharing a KV head are processed by the same workgroups, stacked along the rows
+  CUTLASS_HOST_DEVICE
+  static int get_grouped_seq_len_qo(ProblemShape const &problem_shape) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    return num_heads_q / num_heads_kv * static_cast<int>(seq_len_qo);
+  }
+
+  // Binds the mainloop to packed row-major operands: A as a (rows_a, head_size) matrix read like Q, B as a
+  // (rows_b, head_size) matrix read like K and C as a (rows_b, head_size) matrix read like V.
+  static MainloopParams bind_mainloop(int batch, int num_heads, int rows_a, int rows_b, int head_size,
+                                      ElementQ const *ptr_A, ElementQ const *ptr_B, ElementQ const *ptr_C) {
+    auto shape = make_shape(batch, num_heads, num_heads, rows_a, rows_b, head_size);
+    StrideQ stride_A = make_stride(static_cast<int64_t>(head_size), _1{}, static_cast<int64_t>(rows_a) * head_size);
+    StrideK stride_B = make_stride(static_cast<int64_t>(head_size), _1{}, static_cast<int64_t>(rows_b) * head_size);
+    StrideV stride_C = make_stride(_1{}, static_cast<int64_t>(head_size), static_cast<int64_t>(rows_b) * head_size);
+    return CollectiveMainloop::to_underlying_arguments(shape, {ptr_A, stride_A, ptr_B, stride_B, ptr_C, stride_C},
+                                                       nullptr);
+  }
+
+  static EpilogueParams bind_epilogue(int batch, int num_heads, int rows, int head_size, ElementO *ptr) {
+    auto shape = make_shape(batch, num_heads, num_heads, rows, 0, head_size);
+    StrideO stride = make_stride(static_cast<int64_t>(head_size), _1{}, static_cast<int64_t>(rows) * head_size);
+    return CollectiveEpilogue::to_underlying_arguments(shape, {ptr, stride, nullptr}, nullptr);
+  }
+
+  static Params to_underlying_arguments(Arguments const &args, void *workspace) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = args.problem_shape;
+    int const num_rows = get_grouped_seq_len_qo(args.problem_shape);
+    auto ptr_D = reinterpret_cast<ElementAccumulator *>(workspace);
+    if constexpr (IsDQ) {
+      return {args.mode,
+              args.problem_shape,
+              bind_mainloop(batch, num_heads_kv, num_rows, seq_len_kv, head_size, args.ptr_Q, args.ptr_K, args.ptr_K),
+              bind_mainloop(batch, num_heads_kv, num_rows, seq_len_kv, head_size, args.ptr_dO, args.ptr_V, args.ptr_V),
+              bind_epilogue(batch, num_heads_kv, num_rows, head_size, args.ptr_dQ),
+              EpilogueParams{},
+              args.ptr_O,
+              args.ptr_LSE,
+              args.ptr_dO,
+              ptr_D,
+              args.softmax_scale};
+    } else {
+      return {args.mode,
+              args.problem_shape,
+              bind_mainloop(batch, num_heads_kv, seq_len_kv, num_rows, head_size, args.ptr_K, args.ptr_Q, args.ptr_dO),
+              bind_mainloop(batch, num_heads_kv, seq_len_kv, num_rows, head_size, args.ptr_V, args.ptr_dO, args.ptr_Q),
+              bind_epilogue(batch, num_heads_kv, seq_len_kv, head_size, args.ptr_dK),
+              bind_epilogue(batch, num_heads_kv, seq_len_kv, head_size, args.ptr_dV),
+              args.ptr_O,
+              args.ptr_LSE,
+              args.ptr_dO,
+              ptr_D,
+              args.softmax_scale};
+    }
+  }
+
+  static bool can_implement(Arguments const &args) {
+    bool mode_implementable = args.mode == GemmUniversalMode::kGemm or args.mode == GemmUniversalMode::kBatched;
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = args.problem_shape;
+    mode_implementable &= num_heads_kv > 0 && num_heads_q % num_heads_kv == 0;
+    if constexpr (CausalMask) {
+      mode_implementable &= seq_len_qo <= seq_len_kv;
+    }
+    mode_implementable &= args.ptr_LSE != nullptr && args.ptr_O != nullptr && args.ptr_dO != nullptr;
+    if constexpr (IsDQ) {
+      mode_implementable &= args.ptr_dQ != nullptr;
+    } else {
+      mode_implementable &= args.ptr_dK != nullptr && args.ptr_dV != nullptr;
+    }
+    return mode_implementable;
+  }
+
+  // D = rowsum(dO * O), one value per query row laid out like the LSE. Both kernels must share this workspace.
+  static size_t get_workspace_size(Arguments const &args) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = args.problem_shape;
+    return round_nearest(sizeof(ElementAccumulator) * batch * num_heads_q * seq_len_qo, MinWorkspaceAlignment);
+  }
+
+  static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
+                                              cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = params.problem_shape;
+    int const rows = IsDQ ? get_grouped_seq_len_qo(params.problem_shape) : static_cast<int>(seq_len_kv);
+    return dim3(cute::ceil_div(static_cast<int>(head_size), BLK_N), cute::ceil_div(rows, BLK_M),
+                batch * num_heads_kv);
+  }
+
+  static dim3 get_block_shape() { return dim3(MaxThreadsPerBlock, 1, 1); }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char *smem_buf) {
+    CUTE_STATIC_ASSERT(is_static<WorkgroupTileShape>::value);
+    if constexpr (IsDQ) {
+      compute_dq(params, smem_buf);
+    } else {
+      compute_dk_dv(params, smem_buf);
+    }
+  }
+
+private:
+  CUTLASS_DEVICE
+  void compute_dq(Params const &params, char *smem_buf) {
+    SharedStorage &shared_storage = *reinterpret_cast<SharedStorage *>(smem_buf);
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo_, seq_len_kv_, head_size] = params.problem_shape;
+    int const seq_len_qo = seq_len_qo_;
+    int const seq_len_kv = seq_len_kv_;
+    int const num_rows = get_grouped_seq_len_qo(params.problem_shape);
+
+    int thread_idx = int(ThreadIdxX());
+    int sub_group_id = thread_idx / SubgroupSize;
+    auto sg = syclcompat::get_nd_item<1>().get_sub_group();
+    const int item_id = sg.get_local_id()[0];
+    constexpr auto subgroup_shape = SubgroupTileShape{}; // (SUB_M,SUB_N,SUB_K)
+
+    const int blk_m_coord = BlockIdxY();
+    const int blk_n_coord = BlockIdxX();
+    const int blk_l_coord = BlockIdxZ();
+
+    Tensor mQ_mkl = cute::get_pvc_tensor(params.mainloop_s.mQ.shape()); // (m,k,l)
+    Tensor mK_nkl = cute::get_pvc_tensor(params.mainloop_s.mK.shape()); // (n,k,l)
+    Tensor mV_nkl = cute::get_pvc_tensor(params.mainloop_s.mV.shape()); // (n,k,l)
+    auto gQ = local_tile(mQ_mkl(_, _, blk_l_coord), subgroup_shape, make_coord(blk_m_coord * ATOM_M, _, _),
+                         Step<_1, X, _1>{});
+    auto gK = local_tile(mK_nkl(_, _, blk_l_coord), subgroup_shape, make_coord(_, _, _), Step<X, _1, _1>{});
+    auto gV = local_tile(mV_nkl(_, _, blk_l_coord), subgroup_shape, make_coord(_, _, _), Step<X, _1, _1>{})
+                  (_, _, blk_n_coord * ATOM_N, _); // (64, 64, k)
+
+    const int seq_coord = blk_m_coord * BLK_M + (sub_group_id / ATOM_N) * SG_M;
+    const int causal_offset = seq_len_kv - seq_len_qo;
+
+    // Work item i loads the LSE of row seq_coord + i and computes its D = rowsum(dO * O)
+    ElementAccumulator lse_item{0};
+    ElementAccumulator d_item{0};
+    const int item_row = seq_coord + item_id;
+    if (item_row < num_rows) {
+      int64_t const row_offset = static_cast<int64_t>(blk_l_coord) * num_rows + item_row;
+      // The LSE is stored in natural log, P is computed in base 2
+      lse_item = static_cast<ElementAccumulator>(params.ptr_LSE[row_offset]) * static_cast<ElementAccumulator>(M_LOG2E);
+      for (int k = 0; k < head_size; k++) {
+        d_item += static_cast<ElementAccumulator>(params.ptr_dO[row_offset * head_size + k]) *
+                  static_cast<ElementAccumulator>(params.ptr_O[row_offset * head_size + k]);
+      }
+      if (blk_n_coord == 0 && sub_group_id % ATOM_N == 0) {
+        params.ptr_D[row_offset] = d_item;
+      }
+    }
+    ElementAccumulator lse_row[Vec * FragsM];
+    ElementAccumulator d_row[Vec * FragsM];
+    CUTLASS_PRAGMA_UNROLL
+    for (int indx = 0; indx < Vec * FragsM; indx++) {
+      lse_row[indx] = group_broadcast(sg, lse_item, indx);
+      d_row[indx] = group_broadcast(sg, d_item, indx);
+    }
+
+    // Same KV range as the forward pass, see GemmUniversalAttention
+    const int sg_row_begin = seq_coord % seq_len_qo;
+    const bool sg_rows_wrap = sg_row_begin + SG_M > seq_len_qo;
+    const int sg_row_end = sg_rows_wrap ? seq_len_qo : sg_row_begin + SG_M;
+    const int kv_blocks = cute::ceil_div(seq_len_kv, SG_N);
+    const int nblock_limit = CausalMask ? cute::min(kv_blocks, cute::ceil_div(sg_row_end + causal_offset, SG_N))
+                                        : kv_blocks;
+    const ElementAccumulator scale = params.softmax_scale * static_cast<ElementAccumulator>(M_LOG2E);
+
+    TiledMma tiled_mma;
+    Tensor dq_reg = partition_fragment_C(tiled_mma, take<0, 2>(subgroup_shape));
+    clear(dq_reg);
+    CollectiveMainloop collective_mma;
+    static constexpr int barrier_scope = CausalMask ? 3 : 2;
+    for (int nblock = 0; nblock < nblock_limit; nblock++) {
+      barrier_arrive(barrier_scope);
+      Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
+      Tensor tdPr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
+      clear(tSr);
+      clear(tdPr);
+
+      // S = Q K^T and dP = dO V^T
+      collective_mma.mmaQK(tSr, gQ, gK(_, _, nblock, _), tSr, ceil_div(head_size, SG_N), params.mainloop_s);
+      collective_mma.mmaQK(tdPr, gQ, gK(_, _, nblock, _), tdPr, ceil_div(head_size, SG_N), params.mainloop_dp);
+
+      // dS = P * (dP - D) * softmax_scale, with P masked like in the forward pass
+      int col_idx = item_id + nblock * SG_N;
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int m = 0; m < FragsM; m++) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int row = 0; row < Vec; row++) {
+            int indx = m * Vec + row;
+            int row_idx = (seq_coord + indx) % seq_len_qo + causal_offset;
+            bool masked = col_idx >= seq_len_kv || (CausalMask && col_idx > row_idx);
+            ElementAccumulator p = masked ? ElementAccumulator{0}
+                                          : sycl::native::exp2(tSr(row, m, n) * scale - lse_row[indx]);
+            tSr(row, m, n) = p * (tdPr(row, m, n) - d_row[indx]) * params.softmax_scale;
+          }
+        }
+      }
+
+      // dQ += dS K, K being bound as the V operand of mainloop_s
+      collective_mma.mmaPV(dq_reg, tSr, gV(_, _, nblock), dq_reg, params.mainloop_s);
+      barrier_wait(barrier_scope);
+    }
+
+    CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
+    epilogue.store_output(make_shape(batch, num_heads_kv, num_heads_kv, num_rows, seq_len_kv, head_size),
+                          make_coord(blk_m_coord, blk_n_coord, _, blk_l_coord), dq_reg, tiled_mma);
+  }
+
+  CUTLASS_DEVICE
+  void compute_dk_dv(Params const &params, char *smem_buf) {
+    SharedStorage &shared_storage = *reinterpret_cast<SharedStorage *>(smem_buf);
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo_, seq_len_kv_, head_size] = params.problem_shape;
+    int const seq_len_qo = seq_len_qo_;
+    int const seq_len_kv = seq_len_kv_;
+    int const group_size = num_heads_q / num_heads_kv;
+    int const num_rows = get_grouped_seq_len_qo(params.problem_shape);
+
+    int thread_idx = int(ThreadIdxX());
+    int sub_group_id = thread_idx / SubgroupSize;
+    auto sg = syclcompat::get_nd_item<1>().get_sub_group();
+    const int item_id = sg.get_local_id()[0];
+    constexpr auto subgroup_shape = SubgroupTileShape{}; // (SUB_M,SUB_N,SUB_K)
+
+    const int blk_m_coord = BlockIdxY();
+    const int blk_n_coord = BlockIdxX();
+    const int blk_l_coord = BlockIdxZ();
+
+    // The rows are keys and the columns are the packed query rows of the group
+    Tensor mK_mkl = cute::get_pvc_tensor(params.mainloop_s.mQ.shape()); // (m,k,l)
+    Tensor mQ_nkl = cute::get_pvc_tensor(params.mainloop_s.mK.shape()); // (n,k,l)
+    Tensor mO_nkl = cute::get_pvc_tensor(params.mainloop_s.mV.shape()); // (n,k,l)
+    auto gK = local_tile(mK_mkl(_, _, blk_l_coord), subgroup_shape, make_coord(blk_m_coord * ATOM_M, _, _),
+                         Step<_1, X, _1>{});
+    auto gQ = local_tile(mQ_nkl(_, _, blk_l_coord), subgroup_shape, make_coord(_, _, _), Step<X, _1, _1>{});
+    auto gO = local_tile(mO_nkl(_, _, blk_l_coord), subgroup_shape, make_coord(_, _, _), Step<X, _1, _1>{})
+                  (_, _, blk_n_coord * ATOM_N, _); // (64, 64, k)
+
+    const int seq_coord = blk_m_coord * BLK_M + (sub_group_id / ATOM_N) * SG_M;
+    const int causal_offset = seq_len_kv - seq_len_qo;
+    const int q_blocks = cute::ceil_div(num_rows, SG_N);
+    // Key j is only seen by the queries i >= j - causal_offset. With packed query heads every block holds the start
+    // of some head, so blocks can only be skipped when the group has a single head.
+    const int nblock_begin = (CausalMask && group_size == 1)
+                                 ? cute::max(0, seq_coord - causal_offset) / SG_N
+                                 : 0;
+    const ElementAccumulator scale = params.softmax_scale * static_cast<ElementAccumulator>(M_LOG2E);
+
+    TiledMma tiled_mma;
+    Tensor dk_reg = partition_fragment_C(tiled_mma, take<0, 2>(subgroup_shape));
+    Tensor dv_reg = partition_fragment_C(tiled_mma, take<0, 2>(subgroup_shape));
+    clear(dk_reg);
+    clear(dv_reg);
+    CollectiveMainloop collective_mma;
+    static constexpr int barrier_scope = CausalMask ? 3 : 2;
+    for (int nblock = nblock_begin; nblock < q_blocks; nblock++) {
+      barrier_arrive(barrier_scope);
+      Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
+      Tensor tdPr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
+      clear(tSr);
+      clear(tdPr);
+
+      // S^T = K Q^T and dP^T = V dO^T
+      collective_mma.mmaQK(tSr, gK, gQ(_, _, nblock, _), tSr, ceil_div(head_size, SG_N), params.mainloop_s);
+      collective_mma.mmaQK(tdPr, gK, gQ(_, _, nblock, _), tdPr, ceil_div(head_size, SG_N), params.mainloop_dp);
+
+      // Work item i holds column nblock * SG_N + n * 16 + i, i.e. a single query row per fragment column
+      int col_idx = item_id + nblock * SG_N;
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) {
+        bool const col_valid = col_idx < num_rows;
+        int64_t const col_offset = static_cast<int64_t>(blk_l_coord) * num_rows + col_idx;
+        ElementAccumulator lse = col_valid ? static_cast<ElementAccumulator>(params.ptr_LSE[col_offset]) *
+                                                 static_cast<ElementAccumulator>(M_LOG2E)
+                                           : ElementAccumulator{0};
+        ElementAccumulator d = col_valid ? params.ptr_D[col_offset] : ElementAccumulator{0};
+        int const col_limit = col_idx % seq_len_qo + causal_offset;
+        CUTLASS_PRAGMA_UNROLL
+        for (int m = 0; m < FragsM; m++) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int row = 0; row < Vec; row++) {
+            int row_idx = seq_coord + m * Vec + row;
+            bool masked = !col_valid || (CausalMask && row_idx > col_limit);
+            ElementAccumulator p = masked ? ElementAccumulator{0}
+                                          : sycl::native::exp2(tSr(row, m, n) * scale - lse);
+            tSr(row, m, n) = p;
+            tdPr(row, m, n) = p * (tdPr(row, m, n) - d) * params.softmax_scale;
+          }
+        }
+      }
+
+      // dV += P^T dO and dK += dS^T Q, dO and Q being bound as the V operands
+      collective_mma.mmaPV(dv_reg, tSr, gO(_, _, nblock), dv_reg, params.mainloop_s);
+      collective_mma.mmaPV(dk_reg, tdPr, gO(_, _, nblock), dk_reg, params.mainloop_dp);
+      barrier_wait(barrier_scope);
+    }
+
+    auto output_shape = make_shape(batch, num_heads_kv, num_heads_kv, seq_len_kv, num_rows, head_size);
+    auto blk_coord_mnkl = make_coord(blk_m_coord, blk_n_coord, _, blk_l_coord);
+    CollectiveEpilogue epilogue_dk{params.epilogue, shared_storage.epilogue};
+    epilogue_dk.store_output(output_shape, blk_coord_mnkl, dk_reg, tiled_mma);
+    CollectiveEpilogue epilogue_dv{params.epilogue_dv, shared_storage.epilogue};
+    epilogue_dv.store_output(output_shape, blk_coord_mnkl, dv_reg, tiled_mma);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
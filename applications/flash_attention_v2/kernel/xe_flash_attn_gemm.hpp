@@ -34,7 +34,9 @@
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/workspace.h"
 
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_mma.hpp"
 
 namespace cutlass::gemm::kernel {
@@ -53,7 +55,14 @@ public:
   //
   using ProblemShape = ProblemShape_;
 
-  static_assert(rank(ProblemShape{}) == 4, "ProblemShape{} should be <batch, num_heads, seq_len, head_size>");
+  static_assert(rank(ProblemShape{}) == 6,
+                "ProblemShape{} should be <batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size>");
+
+  // seq_len_qo and seq_len_kv may be cutlass::fmha::collective::VariableLength, in which case each batch entry has
+  // its own sequence lengths given by cumulative offsets and the grid is sized for the longest one.
+  static constexpr bool is_var_len =
+      cutlass::fmha::collective::is_variable_length_v<decltype(get<3>(ProblemShape{}))> or
+      cutlass::fmha::collective::is_variable_length_v<decltype(get<4>(ProblemShape{}))>;
 
   // Mainloop derived types
   using CollectiveMainloop = CollectiveMainloop_;
@@ -98,6 +107,7 @@ public:
   static constexpr int SharedStorageSize = 0;
 
   static constexpr bool CausalMask = CollectiveMainloop::CausalMask;
+  using Fusion = typename CollectiveMainloop::Fusion;
   static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
   static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
   using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;           // 8,16,16
@@ -139,6 +149,10 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Number of workgroups sharing the KV sequence of every output tile (flash-decoding). Each split writes its
+    // partial output and LSE to the workspace and the last one to finish merges them. 0 picks the split count
+    // from the number of output tiles and the Xe core count in hw_info.
+    int num_kv_splits = 1;
   };
 
   // Kernel entry point API
@@ -148,38 +162,150 @@ public:
     MainloopParams mainloop;
     SoftmaxParams softmax;
     EpilogueParams epilogue;
+    int num_kv_splits;
+    EpilogueParams epilogue_partial;
+    int *split_counters;
   };
 
   //
   // Methods
   //
 
+  // Extents of the split-KV partial results: every split owns a [seq_len_qo, head_size] slice per (batch, head)
+  CUTLASS_HOST_DEVICE
+  static auto get_partial_problem_shape(ProblemShape const &problem_shape, int num_kv_splits) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    return make_shape(num_kv_splits * batch, num_heads_q, num_heads_kv, static_cast<int>(seq_len_qo),
+                      static_cast<int>(seq_len_kv), head_size);
+  }
+
+  // Query heads sharing a KV head are processed by the same workgroups, stacked along M
+  CUTLASS_HOST_DEVICE
+  static int get_grouped_seq_len_qo(ProblemShape const &problem_shape) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    return num_heads_q / num_heads_kv * static_cast<int>(seq_len_qo);
+  }
+
+  static int get_num_split_counters(ProblemShape const &problem_shape) {
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_shape;
+    return batch * num_heads_kv * cute::ceil_div(get_grouped_seq_len_qo(problem_shape), BLK_M) *
+           cute::ceil_div(static_cast<int>(head_size), BLK_N);
+  }
+
+  // Resolves the split count requested in the arguments. Splitting only pays off when there are too few output
+  // tiles to occupy every Xe core, as in decoding, and each split keeps enough KV blocks to amortize the merge.
+  static int get_num_kv_splits(Arguments const &args) {
+    if (args.num_kv_splits > 0) {
+      return args.num_kv_splits;
+    }
+    int sm_count = args.hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+    }
+    constexpr int MinKVBlocksPerSplit = 4;
+    constexpr int MaxKVSplits = 16;
+    const int num_tiles = get_num_split_counters(args.problem_shape);
+    const int kv_blocks = cute::ceil_div(static_cast<int>(get<4>(args.problem_shape)), SG_N);
+    const int max_splits = cute::min(MaxKVSplits, cute::max(1, kv_blocks / MinKVBlocksPerSplit));
+    return cute::max(1, cute::min(max_splits, sm_count / cute::max(1, num_tiles)));
+  }
+
+  // Workspace layout for split-KV: [partial O | partial LSE | per-tile arrival counters]
+  static size_t get_partial_O_size(Arguments const &args) {
+    if (get_num_kv_splits(args) <= 1) {
+      return 0;
+    }
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] =
+        get_partial_problem_shape(args.problem_shape, get_num_kv_splits(args));
+    return round_nearest(sizeof(ElementO) * batch * num_heads_q * seq_len_qo * head_size, MinWorkspaceAlignment);
+  }
+
+  static size_t get_partial_LSE_size(Arguments const &args) {
+    if (get_num_kv_splits(args) <= 1) {
+      return 0;
+    }
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] =
+        get_partial_problem_shape(args.problem_shape, get_num_kv_splits(args));
+    return round_nearest(sizeof(ElementLSE) * batch * num_heads_q * seq_len_qo, MinWorkspaceAlignment);
+  }
+
+  static size_t get_split_counters_size(Arguments const &args) {
+    if (get_num_kv_splits(args) <= 1) {
+      return 0;
+    }
+    return round_nearest(sizeof(int) * get_num_split_counters(args.problem_shape), MinWorkspaceAlignment);
+  }
+
   // Convert to underlying arguments. In this case, a simple copy for the aliased type.
   static Params to_underlying_arguments(Arguments const &args, void *workspace) {
-    (void)workspace;
+    const int num_kv_splits = get_num_kv_splits(args);
+    EpilogueParams epilogue_partial{};
+    int *split_counters = nullptr;
+    if (num_kv_splits > 1) {
+      auto partial_shape = get_partial_problem_shape(args.problem_shape, num_kv_splits);
+      auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = partial_shape;
+      uint8_t *workspace_ptr = reinterpret_cast<uint8_t *>(workspace);
+      auto ptr_O = reinterpret_cast<ElementO *>(workspace_ptr);
+      auto ptr_LSE = reinterpret_cast<ElementLSE *>(workspace_ptr + get_partial_O_size(args));
+      split_counters = reinterpret_cast<int *>(workspace_ptr + get_partial_O_size(args) + get_partial_LSE_size(args));
+      // Partial outputs are packed row-major like O
+      StrideO stride_O = make_stride(static_cast<int64_t>(head_size), _1{}, static_cast<int64_t>(seq_len_qo) * head_size);
+      epilogue_partial = CollectiveEpilogue::to_underlying_arguments(partial_shape, {ptr_O, stride_O, ptr_LSE}, nullptr);
+    }
+
     return {args.mode, args.problem_shape,
             CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
             CollectiveSoftmaxEpilogue::to_underlying_arguments(args.softmax),
-            CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace)};
+            CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
+            num_kv_splits,
+            epilogue_partial,
+            split_counters};
   }
 
   static bool can_implement(Arguments const &args) {
     bool mode_implementable = args.mode == GemmUniversalMode::kGemm or
-                              (args.mode == GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
+                              (args.mode == GemmUniversalMode::kBatched && rank(ProblemShape{}) == 6);
+    auto [batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = args.problem_shape;
+    // Every KV head serves the same number of query heads
+    mode_implementable &= num_heads_kv > 0 && num_heads_q % num_heads_kv == 0;
+    if constexpr (is_var_len) {
+      if constexpr (cutlass::fmha::collective::is_variable_length_v<decltype(get<3>(ProblemShape{}))>) {
+        mode_implementable &= get<3>(args.problem_shape).cumulative_length != nullptr;
+      }
+      if constexpr (cutlass::fmha::collective::is_variable_length_v<decltype(get<4>(ProblemShape{}))>) {
+        mode_implementable &= get<4>(args.problem_shape).cumulative_length != nullptr;
+      }
+    } else {
+      // The query heads of a group are read and written as one matrix, so they must follow each other in Q and O
+      if (num_heads_kv > 0 && num_heads_q != num_heads_kv) {
+        mode_implementable &= get<2>(args.mainloop.dQ) == get<0>(args.mainloop.dQ) * seq_len_qo;
+        mode_implementable &= get<2>(args.epilogue.dO) == get<0>(args.epilogue.dO) * seq_len_qo;
+      }
+    }
+    mode_implementable &= args.num_kv_splits >= 0;
+    mode_implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     return mode_implementable && TileScheduler::can_implement(args.scheduler);
   }
 
-  static int get_workspace_size(Arguments const &args) { return 0; }
+  static size_t get_workspace_size(Arguments const &args) {
+    return get_partial_O_size(args) + get_partial_LSE_size(args) + get_split_counters_size(args);
+  }
 
   static cutlass::Status initialize_workspace(Arguments const &args, void *workspace = nullptr,
                                               cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    if (get_num_kv_splits(args) <= 1) {
+      return Status::kSuccess;
+    }
+    // The counters are reset by the workgroup merging each tile, so only the first launch relies on this
+    uint8_t *split_counters = reinterpret_cast<uint8_t *>(workspace) + get_partial_O_size(args) +
+                              get_partial_LSE_size(args);
+    return zero_workspace(split_counters, get_split_counters_size(args), stream, cuda_adapter);
   }
 
   static dim3 get_grid_shape(Params const &params) {
-    return dim3(cute::size(cute::ceil_div(cute::shape<3>(params.problem_shape), cute::shape<1>(WorkgroupTileShape{}))),
-                cute::size(cute::ceil_div(cute::shape<2>(params.problem_shape), cute::shape<0>(WorkgroupTileShape{}))),
-                cute::size(cute::shape<0>(params.problem_shape) * cute::shape<1>(params.problem_shape)));
+    return dim3(cute::size(cute::ceil_div(cute::shape<5>(params.problem_shape), cute::shape<1>(WorkgroupTileShape{}))),
+                cute::size(cute::ceil_div(get_grouped_seq_len_qo(params.problem_shape), cute::shape<0>(WorkgroupTileShape{}))),
+                cute::size(cute::shape<0>(params.problem_shape) * cute::shape<2>(params.problem_shape) * params.num_kv_splits));
   }
 
   static dim3 get_block_shape() { return dim3(MaxThreadsPerBlock, 1, 1); }
@@ -191,45 +317,80 @@ public:
     CUTE_STATIC_ASSERT(is_static<WorkgroupTileShape>::value);
     // Separate out problem shape for convenience
     auto batch = get<0>(params.problem_shape);
-    auto num_heads = get<1>(params.problem_shape);
-    auto seq_len = get<2>(params.problem_shape);
-    auto head_size = get<3>(params.problem_shape);
+    auto num_heads_q = get<1>(params.problem_shape);
+    auto num_heads_kv = get<2>(params.problem_shape);
+    auto head_size = get<5>(params.problem_shape);
     // Preconditions
-    static_assert(cute::rank(StrideQ{}) == 3, "StrideQ must be rank-3: [seq_len, head_size, batch * num_heads].");
-    static_assert(cute::rank(StrideK{}) == 3, "StrideK must be rank-3: [head_size, seq_len, batch * num_heads].");
-    static_assert(cute::rank(StrideV{}) == 3, "StrideV must be rank-3: [seq_len, head_size, batch * num_heads].");
+    static_assert(cute::rank(StrideQ{}) == 3, "StrideQ must be rank-3: [seq_len_qo, head_size, batch * num_heads_q].");
+    static_assert(cute::rank(StrideK{}) == 3, "StrideK must be rank-3: [head_size, seq_len_kv, batch * num_heads_kv].");
+    static_assert(cute::rank(StrideV{}) == 3, "StrideV must be rank-3: [seq_len_kv, head_size, batch * num_heads_kv].");
 
     int thread_idx = int(ThreadIdxX());
     int sub_group_id = thread_idx / SubgroupSize;
     constexpr auto subgroup_shape = SubgroupTileShape{};   // (SUB_M,SUB_N,SUB_K)
 
-    auto blk_m_coord = BlockIdxY();
-    auto blk_n_coord = BlockIdxX();
-    auto blk_l_coord = BlockIdxZ();
-
-    Tensor mQ_mkl = cute::get_pvc_tensor(make_shape(seq_len, head_size, batch * num_heads));   //(m,k,l)
-    Tensor mK_nkl = cute::get_pvc_tensor(make_shape(seq_len, head_size, batch * num_heads));   //(m,k,l)
-    Tensor mV_nkl = cute::get_pvc_tensor(make_shape(head_size, seq_len, batch * num_heads));   //(n,k,l)
-    Tensor mQ_mk = mQ_mkl(_,_,blk_l_coord);                                                    // (m,k)
-    Tensor mK_nk = mK_nkl(_,_,blk_l_coord);                                                    // (n,k)
-    Tensor mV_nk = mV_nkl(_,_,blk_l_coord);                                                    // (n,k)
-    
-    auto gQ = local_tile(mQ_mk, subgroup_shape, make_coord(blk_m_coord * ATOM_M, _, _), Step<_1,  X, _1>{}); // subgroup_shape<16, 64, 64> // Atom_M ->8   // 16x64
-    auto gK = local_tile(mK_nk, subgroup_shape, make_coord(_, _ , _), Step<X, _1, _1>{});                    // subgroup_shape<16, 64, 64>                 // 64x64
-    auto gV = local_tile(mV_nk, subgroup_shape, make_coord(_, blk_n_coord * ATOM_N, _), Step<X, _1, _1>{});  // subgroup_shape<16, 64, 64> // Atom_N -> 2  // 64x64
+    const int blk_m_coord = BlockIdxY();
+    const int blk_n_coord = BlockIdxX();
+    // Workgroups are indexed by (batch, KV head) along z and process all the query heads sharing that KV head, so
+    // each K/V tile is loaded once per group. With split-KV, the splits of a tile are batch * num_heads_kv apart.
+    const int blk_l_coord = BlockIdxZ() % (batch * num_heads_kv);
+    const int split_idx = BlockIdxZ() / (batch * num_heads_kv);
+    const int group_size = num_heads_q / num_heads_kv;
+
+    // For variable length sequences the copies are rebound to the current sequence, which then lives at l = 0
+    const int batch_coord = blk_l_coord / num_heads_kv;
+    const int head_coord = blk_l_coord % num_heads_kv;
+    const int seq_len_qo = get<0>(cutlass::fmha::collective::get_sequence_extent(get<3>(params.problem_shape), batch_coord));
+    const int seq_len_kv = get<0>(cutlass::fmha::collective::get_sequence_extent(get<4>(params.problem_shape), batch_coord));
+    // The query heads of the group are stacked along M, row r of head g being row g * seq_len_qo + r
+    const int grouped_seq_len_qo = group_size * seq_len_qo;
+    if constexpr (is_var_len) {
+      if (blk_m_coord * BLK_M >= grouped_seq_len_qo) {
+        return;
+      }
+    }
+    const int l_coord = is_var_len ? 0 : blk_l_coord;
+    auto mainloop_params = CollectiveMainloop::get_updated_copies(params.mainloop, params.problem_shape, blk_l_coord);
 
-    const int seq_coord = blk_m_coord * BLK_M + (sub_group_id / ATOM_N) * SG_M;
-    const int l_coord = blk_l_coord;
-    
-    const int causal_seq_len = seq_coord + get<0>(subgroup_shape);
-    const int non_causal_seq_len = seq_len;
+    Tensor mQ_mkl = cute::get_pvc_tensor(make_shape(grouped_seq_len_qo, head_size, batch * num_heads_kv)); //(m,k,l)
+    // K and V keep their l mode, as the blocks of a paged cache are spread over (page, head) pairs
+    Tensor mK_nkl = cute::get_pvc_tensor(mainloop_params.mK.shape());                             //(n,k,l)
+    Tensor mV_nkl = cute::get_pvc_tensor(mainloop_params.mV.shape());                             //(n,k,l)
+    Tensor mQ_mk = mQ_mkl(_,_,l_coord);                                                           // (m,k)
 
-    const int nblock_limit = CausalMask ? cute::ceil_div(causal_seq_len, SG_N)
-                                        : cute::ceil_div(non_causal_seq_len, SG_N);
+    auto gQ = local_tile(mQ_mk, subgroup_shape, make_coord(blk_m_coord * ATOM_M, _, _), Step<_1,  X, _1>{}); // subgroup_shape<16, 64, 64> // Atom_M ->8   // 16x64
+    auto gK = local_tile(mK_nkl, subgroup_shape, make_coord(_, _ , _), Step<X, _1, _1>{});                   // (64, 64, n, k, l)
+    auto gV = local_tile(mV_nkl, subgroup_shape, make_coord(_, _, _), Step<X, _1, _1>{})
+                  (_, _, blk_n_coord * ATOM_N, _, _);                                                         // (64, 64, k, l)
 
-    auto tiled_prefetch_q =  params.mainloop.gmem_tiled_copy_q.template prefetch_selector<Shape<Int<BLK_M>,Int<BLK_N>>, Num_SGs>(params.mainloop.mQ);   // <M=128 (BLK_M), K=128 (BLK_N)>  // is_reverse_needed=0
-    auto tiled_prefetch_k =  params.mainloop.gmem_tiled_copy_k.template prefetch_selector<Shape<Int<BLK_K>,Int<BLK_N>>, Num_SGs>(params.mainloop.mK);   // <N=64  (BLK_K), K=128 (BLK_N)>  // is_revese_needed=0
-    auto tiled_prefetch_v =  params.mainloop.gmem_tiled_copy_v.template prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, Num_SGs>(params.mainloop.mV);   // <N=128 (BLK_N), K=64  (BLK_K)>  // is_reverse_needed=1 
+    const int seq_coord = blk_m_coord * BLK_M + (sub_group_id / ATOM_N) * SG_M;
+    // The causal mask is aligned to the bottom right corner of S, so that row i sees keys [0, i + causal_offset]
+    const int causal_offset = seq_len_kv - seq_len_qo;
+    // Range of query rows covered by this subgroup. A subgroup straddling two query heads of the group covers
+    // both the first and the last row of a head.
+    const int sg_row_begin = seq_coord % seq_len_qo;
+    const bool sg_rows_wrap = sg_row_begin + SG_M > seq_len_qo;
+    const int sg_row_min = sg_rows_wrap ? 0 : sg_row_begin;
+    const int sg_row_end = sg_rows_wrap ? seq_len_qo : sg_row_begin + SG_M;
+
+    // KV blocks [kv_block_begin, kv_block_end) belong to this split
+    const int kv_blocks = cute::ceil_div(seq_len_kv, SG_N);
+    const int kv_blocks_per_split = cute::ceil_div(kv_blocks, params.num_kv_splits);
+    const int kv_block_begin = split_idx * kv_blocks_per_split;
+    const int kv_block_end = cute::min(kv_blocks, kv_block_begin + kv_blocks_per_split);
+
+    // Blocks fully masked by the fusion for every row of the subgroup are skipped
+    auto const &fusion_params = mainloop_params.fusion;
+    auto [fusion_col_begin, fusion_col_end] =
+        Fusion::get_kv_range(fusion_params, sg_row_min, sg_row_end, causal_offset, seq_len_kv);
+    const int nblock_begin = cute::max(kv_block_begin, fusion_col_begin / SG_N);
+    const int nblock_limit = cute::min(kv_block_end, cute::ceil_div(fusion_col_end, SG_N));
+    // Biases are added to S, before the softmax scale is applied
+    const ElementAccumulator bias_scale = static_cast<ElementAccumulator>(M_LOG2E) / params.softmax.scale;
+
+    auto tiled_prefetch_q =  mainloop_params.gmem_tiled_copy_q.template prefetch_selector<Shape<Int<BLK_M>,Int<BLK_N>>, Num_SGs>(mainloop_params.mQ);   // <M=128 (BLK_M), K=128 (BLK_N)>  // is_reverse_needed=0
+    auto tiled_prefetch_k =  mainloop_params.gmem_tiled_copy_k.template prefetch_selector<Shape<Int<BLK_K>,Int<BLK_N>>, Num_SGs>(mainloop_params.mK);   // <N=64  (BLK_K), K=128 (BLK_N)>  // is_revese_needed=0
+    auto tiled_prefetch_v =  mainloop_params.gmem_tiled_copy_v.template prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, Num_SGs>(mainloop_params.mV);   // <N=128 (BLK_N), K=64  (BLK_K)>  // is_reverse_needed=1 
     auto thr_prefetch_Q = tiled_prefetch_q.get_slice(thread_idx);
     auto thr_prefetch_K = tiled_prefetch_k.get_slice(thread_idx);
     auto thr_prefetch_V = tiled_prefetch_v.get_slice(thread_idx);
@@ -243,9 +404,11 @@ public:
     }
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < DispatchPolicy::Stages; i++) {
+      auto [kv_block, kv_l_coord] = CollectiveMainloop::get_kv_block_coord(mainloop_params, nblock_begin + i,
+                                                                           batch_coord, head_coord, num_heads_kv, l_coord);
       CUTLASS_PRAGMA_UNROLL
       for (int j = 0; j < size<4>(pKgK); j++) {
-        prefetch(tiled_prefetch_k, pKgK(_, _, _ , i, j));
+        prefetch(tiled_prefetch_k, pKgK(_, _, _ , kv_block, j, kv_l_coord));
       }
     }
 
@@ -262,75 +425,105 @@ public:
     clear(out_reg);
     // Perform the collective scoped MMA
     CollectiveMainloop collective_mma;
-    // when causal mask is true. It is not possible to set the scope
-    // of the barrier to workgroup level as the number n block is
-    // different for each subgroup due to triangular nature of causal based operation
-    static constexpr int barrier_scope = CausalMask ? 3 : 2;
+    // When the KV range of the fusion depends on the rows (e.g. causal mask), it is not possible to set the scope
+    // of the barrier to workgroup level as the number n block is different for each subgroup
+    static constexpr int barrier_scope = Fusion::HasRowDependentRange ? 3 : 2;
     // MAIN LOOP: loop over K and V, perform fused attention + online softmax
-    for (int nblock = 0, load_idx = 0; nblock < nblock_limit - static_cast<int>(CausalMask); nblock++, 
-         load_idx += SG_N) {
+    for (int nblock = nblock_begin; nblock < nblock_limit; nblock++) {
       barrier_arrive(barrier_scope);
+      // Location of the KV block in the (possibly paged) K/V tensors
+      auto [kv_block, kv_l_coord] = CollectiveMainloop::get_kv_block_coord(mainloop_params, nblock, batch_coord,
+                                                                           head_coord, num_heads_kv, l_coord);
       // 1) Load K (performed inside mmaQK)
       // 2) Create Tensor S
       Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
       clear(tSr);
 
       // 3) Perform GEMM S = Q*K
-      collective_mma.mmaQK(tSr, gQ, gK(_, _, nblock, _), tSr, ceil_div(head_size , SG_N), params.mainloop);
-      
+      collective_mma.mmaQK(tSr, gQ, gK(_, _, kv_block, _, kv_l_coord), tSr, ceil_div(head_size , SG_N), mainloop_params);
+
+      // Mask the KV columns past the end of the sequence, which are read as zero, and let the fusion mask or bias
+      // the scores. Masks only touch the blocks crossing their boundaries.
+      const int block_end = (nblock + 1) * SG_N;
+      if (block_end > seq_len_kv ||
+          Fusion::needs_update(fusion_params, sg_row_min, sg_row_end, nblock * SG_N, block_end, causal_offset)) {
+        const int item_id = thread_idx % SubgroupSize;
+        int col_idx = item_id + nblock * SG_N;
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) { // 4
+          CUTLASS_PRAGMA_UNROLL
+          for (int m = 0; m < FragsM; m++) { // 2
+            CUTLASS_PRAGMA_UNROLL
+            for (int row = 0; row < Vec; row++) { // 8
+              // Rows past the end of the group are never stored
+              int grouped_row = m * Vec + seq_coord + row;
+              if (col_idx >= seq_len_kv) {
+                tSr(row, m, n) = -INFINITY;
+              } else if (grouped_row < grouped_seq_len_qo) {
+                int head_q = head_coord * group_size + grouped_row / seq_len_qo;
+                tSr(row, m, n) = Fusion::update(fusion_params, tSr(row, m, n), grouped_row % seq_len_qo, col_idx,
+                                                causal_offset, head_q, batch_coord, bias_scale);
+              }
+            }
+          }
+        }
+      }
+
       // we only need one block ahead, there is enough gap to prefetch it while doing softmax. because the gap between the two MMA is big,
       // prefetching it the same way as cutlass K matrix does not make sense
-      prefetch(tiled_prefetch_v, pVgV(_, _, _ , nblock));
+      prefetch(tiled_prefetch_v, pVgV(_, _, _ , kv_block, kv_l_coord));
 
       CollectiveSoftmaxEpilogue softmax(params.softmax);
-      softmax(nblock == 0, tSr, max_reg, sum_reg, out_reg);
+      softmax(nblock == nblock_begin, tSr, max_reg, sum_reg, out_reg);
 
-      collective_mma.mmaPV(out_reg, tSr, gV(_, _ , nblock), out_reg, params.mainloop);
+      collective_mma.mmaPV(out_reg, tSr, gV(_, _ , kv_block, kv_l_coord), out_reg, mainloop_params);
       
       // Prefetch the next K tile
-     // there is no need to gaurd it with if statememt as prefetch will ignore out of bound reading
-        CUTLASS_PRAGMA_UNROLL
-        for (int j = 0; j < size<4>(pKgK); j++) {
-          prefetch(tiled_prefetch_k, pKgK(_, _, _, nblock + DispatchPolicy::Stages, j));
-        }
-      barrier_wait(barrier_scope);
-    }
-    if constexpr (CausalMask) {
-      // BAND Matrix
-      // 1) Load K (performed inside mmaQK)
-      // 2) Create Tensor S
-      Tensor tSr = make_tensor<ElementAccumulator>(Shape<Int<Vec>, Int<FragsM>, Int<FragsN>>{});
-      clear(tSr);
-      // 3) Perform GEMM S = Q*K
-      collective_mma.mmaQK(tSr, gQ,  gK(_, _, nblock_limit - 1, _), tSr, ceil_div(head_size , SG_N), params.mainloop);
-      // we only need one block ahead, there is enough gap to prefetch it while doing softmax. because the gap between the two MMA is big,
-      // prefetching it the same way as cutlass K matrix does not make sense
-      prefetch(tiled_prefetch_v, pVgV(_, _, _ , nblock_limit - 1));
-      // mask the elements of each tile where j > i
-      const int item_id = thread_idx % SubgroupSize;
-      int col_idx = item_id + (nblock_limit - 1) * SG_N;
+      // there is no need to gaurd it with if statememt as prefetch will ignore out of bound reading
+      auto [next_kv_block, next_kv_l_coord] = CollectiveMainloop::get_kv_block_coord(
+          mainloop_params, nblock + DispatchPolicy::Stages, batch_coord, head_coord, num_heads_kv, l_coord);
       CUTLASS_PRAGMA_UNROLL
-      for (int n = 0; n < FragsN; n++, col_idx += get<1>(MmaAtomShape())) { // 4
-        CUTLASS_PRAGMA_UNROLL
-        for (int m = 0; m < FragsM; m++) { // 2
-          int row_idx = m * Vec + seq_coord;
-          CUTLASS_PRAGMA_UNROLL
-          for (int row = 0; row < Vec; row++, row_idx++) { // 8
-            if (col_idx > row_idx)
-              tSr(row, m, n) = -INFINITY;
-          }
-        }
+      for (int j = 0; j < size<4>(pKgK); j++) {
+        prefetch(tiled_prefetch_k, pKgK(_, _, _, next_kv_block, j, next_kv_l_coord));
       }
+      barrier_wait(barrier_scope);
+    }
 
-      CollectiveSoftmaxEpilogue softmax(params.softmax);
-      softmax((nblock_limit - 1) == 0, tSr, max_reg, sum_reg, out_reg);
+    // The epilogue works on the extents of the current sequence
+    auto sequence_shape = make_shape(batch, num_heads_q, num_heads_kv, seq_len_qo, seq_len_kv, head_size);
+    auto blk_coord_mnkl = make_coord(blk_m_coord, blk_n_coord, _, l_coord);
+    auto epilogue_params = CollectiveEpilogue::get_updated_copies(params.epilogue, params.problem_shape, blk_l_coord);
+    CollectiveEpilogue epilogue{epilogue_params, shared_storage.epilogue};
 
-      collective_mma.mmaPV(out_reg, tSr,  gV(_, _ , nblock_limit - 1), out_reg, params.mainloop);
+    if (params.num_kv_splits == 1) {
+      epilogue(sequence_shape, blk_coord_mnkl, out_reg, max_reg, sum_reg, tiled_mma, params.softmax.scale);
+      return;
     }
 
-    CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
-    auto blk_coord_mnkl = make_coord(blk_m_coord, blk_n_coord, _, blk_l_coord);
-    epilogue(params.problem_shape, blk_coord_mnkl, out_reg, max_reg, sum_reg, tiled_mma, params.softmax.scale);
+    // Split-KV: store the partial result of this split, then let the last split to arrive merge all of them
+    auto partial_shape = get_partial_problem_shape(params.problem_shape, params.num_kv_splits);
+    const int partial_l_coord = split_idx * batch * num_heads_kv + blk_l_coord;
+    CollectiveEpilogue partial_epilogue{params.epilogue_partial, shared_storage.epilogue};
+    partial_epilogue(partial_shape, make_coord(blk_m_coord, blk_n_coord, _, partial_l_coord), out_reg, max_reg,
+                     sum_reg, tiled_mma, params.softmax.scale);
+
+    const int tile_idx = (blk_l_coord * GridDimY() + blk_m_coord) * GridDimX() + blk_n_coord;
+    threadfence();
+    syncthreads();
+    int arrived = 0;
+    if (thread_idx == 0) {
+      arrived = atomicAdd(params.split_counters + tile_idx, 1);
+    }
+    arrived = sycl::group_broadcast(syclcompat::get_nd_item<1>().get_group(), arrived, 0);
+    if (arrived != params.num_kv_splits - 1) {
+      return;
+    }
+    if (thread_idx == 0) {
+      params.split_counters[tile_idx] = 0;
+    }
+    threadfence();
+    epilogue.reduce_kv_splits(sequence_shape, partial_shape, blk_coord_mnkl, params.epilogue_partial,
+                              params.num_kv_splits, blk_l_coord, out_reg, tiled_mma);
   }
 };
 
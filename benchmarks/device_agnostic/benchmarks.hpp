@@ -0,0 +1,74 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "../benchmark_runner.hpp"
+#include "gemm_configuration.hpp"
+
+using DeviceAgnosticGemmFP32FP32FP32_RRR = cutlass::gemm::device::DeviceAgnosticGemmConfiguration<
+        float, cutlass::layout::RowMajor, 1,
+        float, cutlass::layout::RowMajor, 1,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_16, _16, _8>,
+        cutlass::gemm::collective::KernelScheduleAuto>;
+
+using DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_1 = cutlass::gemm::device::DeviceAgnosticGemmConfiguration<
+        float, cutlass::layout::RowMajor, 4,
+        float, cutlass::layout::RowMajor, 4,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_64, _64, _16>,
+        cutlass::gemm::KernelDeviceAgnosticRegisterBlocked>;
+
+using DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_2 = cutlass::gemm::device::DeviceAgnosticGemmConfiguration<
+        float, cutlass::layout::RowMajor, 4,
+        float, cutlass::layout::RowMajor, 4,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_128, _128, _16>,
+        cutlass::gemm::KernelDeviceAgnosticRegisterBlocked>;
+
+using DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RCR_1 = cutlass::gemm::device::DeviceAgnosticGemmConfiguration<
+        float, cutlass::layout::RowMajor, 4,
+        float, cutlass::layout::ColumnMajor, 4,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_64, _64, _16>,
+        cutlass::gemm::KernelDeviceAgnosticRegisterBlocked>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RRR);
+CUTLASS_CREATE_GEMM_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_1);
+CUTLASS_CREATE_GEMM_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_2);
+CUTLASS_CREATE_GEMM_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RCR_1);
+
+static void register_device_agnostic_benchmarks() {
+  CUTLASS_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RRR);
+  CUTLASS_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_1);
+  CUTLASS_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RRR_2);
+  CUTLASS_BENCHMARK(DeviceAgnosticGemmFP32FP32FP32_RegisterBlocked_RCR_1);
+}
@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
+#include "cutlass/layout/layout.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+
+using namespace cute;
+
+namespace cutlass {
+namespace gemm {
+namespace device {
+
+// GEMMs built from the device agnostic collectives, which run on any SYCL device including CPUs.
+// KernelSchedule selects between the SM70 based mainloop (KernelScheduleAuto) and the register
+// blocked one (KernelDeviceAgnosticRegisterBlocked).
+template<
+  class ElementA, class LayoutA, int AlignmentA,
+  class ElementB, class LayoutB, int AlignmentB,
+  class ElementC, class LayoutC,
+  class ElementAccumulator,
+  class TileShape,
+  class KernelSchedule>
+struct DeviceAgnosticGemmConfiguration {
+  using CollectiveMainloop = typename collective::CollectiveBuilder<
+    arch::Agnostic, arch::OpMultiplyAdd,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, Shape<_1, _1, _1>,
+    collective::StageCountAuto,
+    KernelSchedule
+  >::CollectiveOp;
+
+  using CollectiveEpilogue = typename epilogue::collective::CollectiveBuilder<
+    arch::Agnostic, arch::OpMultiplyAdd,
+    TileShape, Shape<_1, _1, _1>,
+    epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, 1,
+    ElementC, LayoutC, 1,
+    epilogue::collective::EpilogueScheduleAuto,
+    epilogue::fusion::LinearCombination<ElementC, ElementAccumulator, ElementC, ElementAccumulator>
+  >::CollectiveOp;
+
+  using GemmKernel = kernel::GemmUniversal<
+    Shape<int, int, int, int>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+  >;
+
+  using Gemm = GemmUniversalAdapter<GemmKernel>;
+
+  constexpr static typename GemmKernel::Arguments defaultArguments() {
+    return {};
+  }
+};
+
+} // namespace device
+} // namespace gemm
+} // namespace cutlass
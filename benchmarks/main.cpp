@@ -39,6 +39,10 @@
 #elif defined(SYCL_INTEL_TARGET)
 #include "pvc/benchmarks.hpp"
 #include "pvc/flash_attention_v2/benchmarks.hpp"
+#include "pvc/convolution/benchmarks.hpp"
+#endif
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "device_agnostic/benchmarks.hpp"
 #endif
 
 #include <benchmark/benchmark.h>
@@ -137,6 +141,9 @@ int main(int argc, const char** argv) {
   }
 
   register_benchmarks();
+#if defined(CUTLASS_ENABLE_SYCL)
+  register_device_agnostic_benchmarks();
+#endif
 
   std::string line;
   while (std::getline(file, line)) {
@@ -163,6 +170,10 @@ int main(int argc, const char** argv) {
       // Call the secondary main function with the parsed arguments
       if(benchmark_config.find("Gemm") != std::string::npos) {
         benchmark_main<cutlass::benchmark::GEMMOptions>(line_argc, line_argv.data());
+      } else if(benchmark_config.find("Conv") != std::string::npos) {
+#if defined SYCL_INTEL_TARGET
+        benchmark_main<cutlass::benchmark::ConvOptions>(line_argc, line_argv.data());
+#endif
       } else {
 #if defined SYCL_INTEL_TARGET
         benchmark_main<cutlass::benchmark::FMHAOptions>(line_argc, line_argv.data());
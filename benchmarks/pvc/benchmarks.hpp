@@ -34,6 +34,7 @@
 #include "../benchmark_runner.hpp"
 #include "gemm_configuration.hpp"
 #include "flash_attention_v2/benchmarks.hpp"
+#include "convolution/benchmarks.hpp"
 
 using Scheduler = cutlass::gemm::device::Scheduler;
 
@@ -191,6 +192,91 @@ using PvcGemmBF16BF16FP32_SplitK_RRR_1 = cutlass::gemm::device::GemmConfiguratio
 
 CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_SplitK_RRR_1);
 
+// Stream-K on the non-cooperative kernel
+using PvcGemmBF16BF16FP32_StreamK_RRR_2 = cutlass::gemm::device::GemmConfiguration<
+        cutlass::arch::IntelPVC,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_256, _256, _32>,
+        TiledMMA<MMAAtom, 
+                 Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>, 
+                 Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                      Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, 
+                      _32>>,
+        XE_2D_U16x32x32_LD_N, XE_2D_U16x32x32_LD_V,
+        Scheduler::GemmStreamK, cutlass::gemm::KernelPVC>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_StreamK_RRR_2);
+
+// Split-K on the non-cooperative kernel
+using PvcGemmBF16BF16FP32_SplitK_RRR_2 = cutlass::gemm::device::GemmConfiguration<
+        cutlass::arch::IntelPVC,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_256, _256, _32>,
+        TiledMMA<MMAAtom, 
+                 Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>, 
+                 Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                      Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, 
+                      _32>>,
+        XE_2D_U16x32x32_LD_N, XE_2D_U16x32x32_LD_V,
+        Scheduler::GemmSplitK, cutlass::gemm::KernelPVC>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_SplitK_RRR_2);
+
+// A and B staged through shared local memory instead of loaded per subgroup
+using PvcGemmBF16BF16FP32_Slm_RRR_1 = cutlass::gemm::device::GemmConfiguration<
+        cutlass::arch::IntelPVC,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_256, _256, _32>,
+        TiledMMA<MMAAtom, 
+                 Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>, 
+                 Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                      Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, 
+                      _32>>,
+        XE_2D_U16x32x32_LD_N, XE_2D_U16x32x32_LD_V,
+        Scheduler::Gemm, cutlass::gemm::device::KernelPVCSlm>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_Slm_RRR_1);
+
+// Persistent workgroups, one per Xe core, pulling tiles from a global work queue
+using PvcGemmBF16BF16FP32_Persistent_RRR_1 = cutlass::gemm::device::GemmConfiguration<
+        cutlass::arch::IntelPVC,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        cutlass::bfloat16_t, cutlass::layout::RowMajor,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_256, _256, _32>,
+        TiledMMA<MMAAtom, 
+                 Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>, 
+                 Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                      Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, 
+                      _32>>,
+        XE_2D_U16x32x32_LD_N, XE_2D_U16x32x32_LD_V,
+        Scheduler::GemmPersistent>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmBF16BF16FP32_Persistent_RRR_1);
+
+// Int4 weights (B) with half activations, the decoding workload of the mixed-input mainloop
+using PvcGemmFP16S4FP32_RRR_1 = cutlass::gemm::device::GemmConfiguration<
+        cutlass::arch::IntelPVC,
+        cutlass::half_t, cutlass::layout::RowMajor,
+        cutlass::int4b_t, cutlass::layout::RowMajor,
+        float, cutlass::layout::RowMajor,
+        float, Shape<_256, _256, _64>,
+        TiledMMA<MMA_Atom<XE_8x16x16_F32F16F16F32_TT>,
+                 Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>,
+                 Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                      Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>,
+                      _64>>,
+        XE_2D_U16x32x32_LD_N, XE_2D_U4x32x64_LD_N,
+        Scheduler::Gemm>;
+
+CUTLASS_CREATE_GEMM_BENCHMARK(PvcGemmFP16S4FP32_RRR_1);
+
 static void register_benchmarks() {
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RRR_1);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_RRR_2);
@@ -202,6 +288,11 @@ static void register_benchmarks() {
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_CCR_8);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_StreamK_RRR_1);
   CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_SplitK_RRR_1);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_StreamK_RRR_2);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_SplitK_RRR_2);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_Slm_RRR_1);
+  CUTLASS_BENCHMARK(PvcGemmBF16BF16FP32_Persistent_RRR_1);
+  CUTLASS_BENCHMARK(PvcGemmFP16S4FP32_RRR_1);
 
   CUTLASS_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h64_Causal);
   CUTLASS_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h64_NonCausal);
@@ -211,4 +302,13 @@ static void register_benchmarks() {
   CUTLASS_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h64_NonCausal);
   CUTLASS_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h128_Causal);
   CUTLASS_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h128_NonCausal);
+  CUTLASS_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h128_SlidingWindow);
+  CUTLASS_FMHA_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h64_Causal);
+  CUTLASS_FMHA_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h64_NonCausal);
+  CUTLASS_FMHA_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h128_Causal);
+  CUTLASS_FMHA_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h128_NonCausal);
+
+  CUTLASS_CONV_BENCHMARK(PvcConvFpropBF16BF16FP32_1);
+  CUTLASS_CONV_BENCHMARK(PvcConvDgradBF16BF16FP32_1);
+  CUTLASS_CONV_BENCHMARK(PvcConvWgradBF16BF16FP32_1);
 }
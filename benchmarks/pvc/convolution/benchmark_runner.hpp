@@ -0,0 +1,347 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/util/GPU_Clock.hpp"
+#include "cutlass/util/sycl_event_manager.hpp"
+
+#include <cute/tensor.hpp>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/host/conv.hpp"
+
+#include "../benchmarks/benchmark_runner.hpp"
+
+using namespace cute;
+
+namespace cutlass::benchmark {
+
+// Command line options parsing, for 2D convolutions with NHWC activations and KRSC filters
+struct ConvOptions {
+
+  bool error;
+
+  int n, h, w, c, k, r, s;
+  int pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w;
+  float alpha, beta;
+  std::string bm_name;
+
+  ConvOptions()
+      : error(false), n(32), h(56), w(56), c(64), k(64), r(3), s(3), pad_h(1), pad_w(1), stride_h(1), stride_w(1),
+        dilation_h(1), dilation_w(1), alpha(1.f), beta(0.f), bm_name("Convolution") {}
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    cmd.get_cmd_line_argument("n", n, 32);
+    cmd.get_cmd_line_argument("h", h, 56);
+    cmd.get_cmd_line_argument("w", w, 56);
+    cmd.get_cmd_line_argument("c", c, 64);
+    cmd.get_cmd_line_argument("k", k, 64);
+    cmd.get_cmd_line_argument("r", r, 3);
+    cmd.get_cmd_line_argument("s", s, 3);
+    int pad, stride, dilation;
+    cmd.get_cmd_line_argument("pad", pad, 1);
+    cmd.get_cmd_line_argument("pad_h", pad_h, pad);
+    cmd.get_cmd_line_argument("pad_w", pad_w, pad);
+    cmd.get_cmd_line_argument("stride", stride, 1);
+    cmd.get_cmd_line_argument("stride_h", stride_h, stride);
+    cmd.get_cmd_line_argument("stride_w", stride_w, stride);
+    cmd.get_cmd_line_argument("dilation", dilation, 1);
+    cmd.get_cmd_line_argument("dilation_h", dilation_h, dilation);
+    cmd.get_cmd_line_argument("dilation_w", dilation_w, dilation);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Convolution"));
+  }
+
+  int p() const { return (h + 2 * pad_h - dilation_h * (r - 1) - 1) / stride_h + 1; }
+  int q() const { return (w + 2 * pad_w - dilation_w * (s - 1) - 1) / stride_w + 1; }
+
+  std::string benchmark_name() const {
+    std::stringstream full_name;
+    full_name << bm_name << "/";
+    full_name << n << "x" << h << "x" << w << "x" << c << "_" << k << "x" << r << "x" << s;
+    full_name << "_p" << pad_h << "x" << pad_w << "_s" << stride_h << "x" << stride_w;
+    if (dilation_h != 1 || dilation_w != 1) {
+      full_name << "_d" << dilation_h << "x" << dilation_w;
+    }
+    return full_name.str();
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ConvConfiguration> struct BenchmarkRunnerConv {
+
+  using Conv = typename ConvConfiguration::Conv;
+  using ConvKernel = typename Conv::ConvKernel;
+  using ProblemShape = typename ConvKernel::ProblemShape;
+  static constexpr conv::Operator ConvOp = Conv::kConvolutionalOperator;
+  static constexpr int NumSpatialDimensions = ProblemShape::NumSpatialDimensions;
+
+  using ElementA = typename Conv::ElementA;
+  using ElementB = typename Conv::ElementB;
+  using ElementC = typename Conv::ElementC;
+  using ElementD = typename Conv::ElementD;
+  using ElementAccumulator = typename Conv::ElementAccumulator;
+  using ElementCompute = typename Conv::CollectiveEpilogue::ElementCompute;
+  using StrideC = typename ConvKernel::StrideC;
+  using StrideD = typename ConvKernel::StrideD;
+
+  int32_t count;
+
+  //
+  // Data members
+  //
+
+  uint64_t seed = 0;
+
+  std::vector<DeviceAllocation<ElementA>> block_A;
+  std::vector<DeviceAllocation<ElementB>> block_B;
+  DeviceAllocation<ElementC> block_C;
+  DeviceAllocation<ElementD> block_D;
+
+  //
+  // Methods
+  //
+
+  static ProblemShape make_problem_shape(ConvOptions const& options) {
+    return ProblemShape(conv::Mode::kCrossCorrelation,
+                        {options.n, options.h, options.w, options.c},
+                        {options.k, options.r, options.s, options.c},
+                        {options.pad_h, options.pad_w},
+                        {options.pad_h, options.pad_w},
+                        {options.stride_h, options.stride_w},
+                        {options.dilation_h, options.dilation_w},
+                        1);
+  }
+
+  // The output of all three operators is a row-major (M,N) matrix of the linearized GEMM
+  static auto make_stride_D(ProblemShape const& problem_shape) {
+    auto [M, N, K, L] = ConvKernel::CollectiveMainloop::get_problem_shape_MNKL(problem_shape);
+    return cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, 1));
+  }
+
+  // Cute tensor of an operand in the (channel, spatial..., outer, group) order of the host reference
+  template <class Element>
+  static auto make_reference_tensor(Element* ptr, cute::array<int, NumSpatialDimensions + 2> const& shape,
+                                    cute::array<int64_t, NumSpatialDimensions + 2> const& stride) {
+    auto shape_g = cute::append(cute::reverse(shape), 1);
+    auto stride_g = cute::append(cute::reverse(stride), int64_t(shape[0] * stride[0]));
+    return make_tensor(ptr, make_layout(cute::to_array<int32_t>(shape_g), cute::to_array<int64_t>(stride_g)));
+  }
+
+  bool verify(ProblemShape const& problem_shape, ElementCompute alpha, ElementCompute beta) {
+    std::vector<ElementA> host_A(problem_shape.size_A());
+    std::vector<ElementB> host_B(problem_shape.size_B());
+    std::vector<ElementC> host_C(problem_shape.size_C());
+    std::vector<ElementD> host_D(problem_shape.size_C());
+    std::vector<ElementD> host_ref_D(problem_shape.size_C());
+    syclcompat::memcpy<ElementA>(host_A.data(), block_A[0].get(), host_A.size());
+    syclcompat::memcpy<ElementB>(host_B.data(), block_B[0].get(), host_B.size());
+    syclcompat::memcpy<ElementC>(host_C.data(), block_C.get(), host_C.size());
+    syclcompat::memcpy<ElementD>(host_D.data(), block_D.get(), host_D.size());
+    syclcompat::wait();
+
+    auto mA = make_reference_tensor(host_A.data(), problem_shape.shape_A, problem_shape.stride_A);
+    auto mB = make_reference_tensor(host_B.data(), problem_shape.shape_B, problem_shape.stride_B);
+    auto mC = make_reference_tensor(host_C.data(), problem_shape.shape_C, problem_shape.stride_C);
+    auto mD_ref = make_reference_tensor(host_ref_D.data(), problem_shape.shape_C, problem_shape.stride_C);
+    auto mScale = make_tensor(static_cast<ElementCompute*>(nullptr), make_layout(make_shape(0)));
+
+    cutlass::reference::host::ConvEpilogueFusionParams<
+      ElementAccumulator, ElementCompute, ElementCompute, ElementC, ElementD,
+      decltype(mScale), decltype(mScale), decltype(mScale)> epilogue_fusion_params{};
+    epilogue_fusion_params.alpha = alpha;
+    epilogue_fusion_params.beta = beta;
+
+    auto padding = cute::reverse(problem_shape.lower_padding);
+    auto tstride = cute::reverse(problem_shape.traversal_stride);
+    auto dilation = cute::reverse(problem_shape.dilation);
+
+    cutlass::reference::host::ConvReferenceImpl<
+      ConvOp, NumSpatialDimensions,
+      decltype(mA), decltype(mB), decltype(mC), decltype(mD_ref),
+      decltype(padding), decltype(tstride), decltype(dilation),
+      decltype(epilogue_fusion_params)>
+        reference_impl(mA, mB, mC, mD_ref, padding, tstride, dilation, epilogue_fusion_params);
+    reference_impl.compute_reference();
+
+    // bf16 products are exact in fp32, only the summation order differs from the reference
+    for (size_t i = 0; i < host_D.size(); ++i) {
+      float ref = static_cast<float>(host_ref_D[i]);
+      float diff = std::abs(static_cast<float>(host_D[i]) - ref);
+      if (diff > 1e-3f * std::max(1.f, std::abs(ref))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Initialize the operands of the convolution
+  void initialize(ProblemShape const& problem_shape) {
+    std::size_t mem_occupied_AB = problem_shape.size_A() * sizeof(ElementA) +
+                                  problem_shape.size_B() * sizeof(ElementB);
+    count = std::ceil(static_cast<float>(cutlass::get_llc_size()) / static_cast<float>(mem_occupied_AB)) + 1;
+
+    for (int i = 0; i < count; i++) {
+      block_A.emplace_back();
+      block_B.emplace_back();
+    }
+
+    for (int i = 0; i < count; i++) {
+      block_A[i].reset(problem_shape.size_A());
+      block_B[i].reset(problem_shape.size_B());
+      initialize_block(block_A[i], seed + i);
+      initialize_block(block_B[i], seed + i);
+    }
+
+    block_C.reset(problem_shape.size_C());
+    block_D.reset(problem_shape.size_C());
+    initialize_block(block_C, seed);
+  }
+
+  void run(::benchmark::State& state, ConvOptions const& options, KernelHardwareInfo const& hw_info) {
+    ProblemShape problem_shape = make_problem_shape(options);
+
+    initialize(problem_shape);
+
+    StrideD stride_D = make_stride_D(problem_shape);
+    typename Conv::Arguments arguments{
+      problem_shape,
+      {block_A[0].get(), block_B[0].get()},
+      {{options.alpha, options.beta}, block_C.get(), stride_D, block_D.get(), stride_D},
+      hw_info
+    };
+
+    Conv conv_op;
+
+    size_t workspace_size = Conv::get_workspace_size(arguments);
+    device_memory::allocation<uint8_t> workspace(workspace_size);
+
+    if (conv_op.can_implement(arguments) != Status::kSuccess) {
+      state.SkipWithError("Problem size not supported by the kernel.");
+      return;
+    }
+
+    conv_op.initialize(arguments, workspace.get());
+
+    // Run the convolution
+    conv_op.run();
+
+    syclcompat::wait();
+
+    // Verify that the result is correct
+    bool passed = verify(problem_shape, options.alpha, options.beta);
+    if (not passed) {
+      state.SkipWithError("Disposition Failed.");
+    }
+
+    state.counters["n"] = options.n;
+    state.counters["h"] = options.h;
+    state.counters["w"] = options.w;
+    state.counters["c"] = options.c;
+    state.counters["k"] = options.k;
+    state.counters["r"] = options.r;
+    state.counters["s"] = options.s;
+
+    std::stringstream extra_label;
+    extra_label << (ConvOp == conv::Operator::kFprop ? "fprop " : ConvOp == conv::Operator::kDgrad ? "dgrad " : "wgrad ");
+    extra_label << "layoutAct=NHWC layoutFlt=KRSC ";
+    state.SetLabel(extra_label.str());
+
+    // All three operators perform the same number of MACs
+    double gflop = 2.0 * options.n * options.p() * options.q() * options.k * options.r * options.s * options.c * 1e-9;
+    double mega_bytes_transferred = static_cast<double>(
+        problem_shape.size_A() * sizeof(ElementA) +
+        problem_shape.size_B() * sizeof(ElementB) +
+        (options.beta != 0 ? 2 : 1) * problem_shape.size_C() * sizeof(ElementD)) * 1e-6;
+
+    initialize_counters(state);
+    int32_t counter = 1;
+    for (auto _ : state) {
+      state.PauseTiming();
+      int input_num = std::max(int(0), counter % count);
+      arguments.mainloop = {block_A[input_num].get(), block_B[input_num].get()};
+      conv_op.initialize(arguments, workspace.get());
+      state.ResumeTiming();
+
+      GPU_Clock timer;
+      timer.start();
+      conv_op.run();
+      auto ms_elapsed = timer.milliseconds();
+      update_counters(state, ms_elapsed);
+      state.SetIterationTime(ms_elapsed / 1000);
+      counter++;
+    }
+    finalize_counters(state, gflop, mega_bytes_transferred);
+  }
+
+private:
+  static void initialize_counters(::benchmark::State& state) {
+    state.counters["avg_runtime_ms"] = 0;
+    state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
+  }
+
+  static void update_counters(::benchmark::State& state, double ms_elapsed) {
+    state.PauseTiming();
+    state.counters["total_runtime_ms"] += ms_elapsed;
+    state.counters["best_runtime_ms"] = std::min<double>(state.counters["best_runtime_ms"], ms_elapsed);
+    state.ResumeTiming();
+  }
+
+  static void finalize_counters(::benchmark::State& state,  double gflop, double mega_bytes_transferred) {
+    state.counters["avg_runtime_ms"] =
+      state.counters["total_runtime_ms"] / static_cast<double>(state.iterations());
+    state.counters["avg_tflops"] = gflop / state.counters["avg_runtime_ms"];
+    state.counters["avg_throughput"] = mega_bytes_transferred / state.counters["avg_runtime_ms"];
+    state.counters["best_tflop"] = gflop / state.counters["best_runtime_ms"];
+    state.counters["best_bandwidth"] = mega_bytes_transferred / state.counters["best_runtime_ms"];
+  }
+};
+
+}
+
+#define CUTLASS_CONV_BENCHMARK(F) cutlass::benchmark::BenchmarkRegistry<cutlass::benchmark::ConvOptions>::Register(#F, &F##_func)
+
+#define CUTLASS_CREATE_CONV_BENCHMARK(F)                          \
+  static void F##_func(                                           \
+      ::benchmark::State& state,                                  \
+      cutlass::benchmark::ConvOptions const& options,             \
+      cutlass::KernelHardwareInfo const& hw_info) {               \
+    auto bench = cutlass::benchmark::BenchmarkRunnerConv<F>();    \
+    bench.run(state, options, hw_info);                           \
+  }
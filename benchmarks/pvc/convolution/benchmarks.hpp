@@ -0,0 +1,69 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "benchmark_runner.hpp"
+#include "conv_configuration.hpp"
+
+using MMAAtomConvBF16 = MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>;
+
+using TiledMmaConvBF16_256x128 = TiledMMA<MMAAtomConvBF16, Layout<Shape<_8,_4,_1>, Stride<_4,_1,_0>>,
+                                   Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                                        Layout<Shape<_16, _4, _2>, Stride<_1, _32, _16>>,
+                                        _32>>;
+
+using TiledMmaConvBF16_128x128 = TiledMMA<MMAAtomConvBF16, Layout<Shape<_4,_4,_1>, Stride<_4,_1,_0>>,
+                                   Tile<Layout<Shape<_8, _4, _4>, Stride<_1, _32, _8>>,
+                                        Layout<Shape<_16, _4, _2>, Stride<_1, _32, _16>>,
+                                        _32>>;
+
+using PvcConvFpropBF16BF16FP32_1 = cutlass::conv::device::ConvConfiguration<
+        cutlass::arch::IntelPVC, cutlass::conv::Operator::kFprop,
+        cutlass::bfloat16_t, cutlass::bfloat16_t,
+        float, float,
+        Shape<_256, _128, _32>, TiledMmaConvBF16_256x128>;
+
+using PvcConvDgradBF16BF16FP32_1 = cutlass::conv::device::ConvConfiguration<
+        cutlass::arch::IntelPVC, cutlass::conv::Operator::kDgrad,
+        cutlass::bfloat16_t, cutlass::bfloat16_t,
+        float, float,
+        Shape<_256, _128, _32>, TiledMmaConvBF16_256x128>;
+
+// Wgrad has M = K and N = RSC, which are both small for typical layers
+using PvcConvWgradBF16BF16FP32_1 = cutlass::conv::device::ConvConfiguration<
+        cutlass::arch::IntelPVC, cutlass::conv::Operator::kWgrad,
+        cutlass::bfloat16_t, cutlass::bfloat16_t,
+        float, float,
+        Shape<_128, _128, _32>, TiledMmaConvBF16_128x128>;
+
+CUTLASS_CREATE_CONV_BENCHMARK(PvcConvFpropBF16BF16FP32_1);
+CUTLASS_CREATE_CONV_BENCHMARK(PvcConvDgradBF16BF16FP32_1);
+CUTLASS_CREATE_CONV_BENCHMARK(PvcConvWgradBF16BF16FP32_1);
@@ -0,0 +1,115 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_atom.hpp"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
+#include "cutlass/layout/layout.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/dispatch_policy.hpp"
+#include "cutlass/conv/collective/collective_conv.hpp"
+#include "cutlass/conv/kernel/conv_universal.hpp"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+using namespace cute;
+
+namespace cutlass {
+namespace conv {
+namespace device {
+
+template<
+  class ArchTag,
+  conv::Operator ConvOp,
+  class ElementA, class ElementB,
+  class ElementC, class ElementAccumulator,
+  class TileShape, class TiledMma,
+  int NumSpatialDimensions = 2>
+struct ConvConfiguration {
+  static_assert(sizeof(ElementA) == 0, "No valid ConvConfiguration configuration exists.");
+};
+
+/////////////////////////////////////////////////////////////////////////
+
+// bfloat16 implicit GEMM, with the output of fprop, dgrad and wgrad written as a row-major (M,N) matrix
+
+template<conv::Operator ConvOp, class TileShape, class TiledMma, int NumSpatialDimensions>
+struct ConvConfiguration<
+      arch::IntelPVC, ConvOp,
+      bfloat16_t, bfloat16_t,
+      float, float,
+      TileShape, TiledMma, NumSpatialDimensions> {
+  using ProblemShape = ConvProblemShape<ConvOp, NumSpatialDimensions>;
+
+  // Mainloop
+  using CollectiveMainloop = collective::CollectiveConv<
+    MainloopIntelPVCImplicitGemm<ConvOp, 2, NumSpatialDimensions>, TileShape,
+    bfloat16_t, bfloat16_t,
+    TiledMma,
+    void, void>;
+
+  // Epilogue
+  using EpilogueDispatchPolicy = epilogue::IntelPVCEpilogue;
+  using EpilogueOp = epilogue::fusion::LinearCombination<float, float, float, float, FloatRoundStyle::round_to_nearest>;
+  using FusionCallBacks = epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+
+  using CollectiveEpilogue = epilogue::collective::CollectiveEpilogue<
+        EpilogueDispatchPolicy,
+        TileShape,
+        float,
+        gemm::TagToStrideC_t<layout::RowMajor>,
+        float,
+        gemm::TagToStrideC_t<layout::RowMajor>,
+        FusionCallBacks,
+        XE_2D_U32x8x16_LD_N,
+        void, void,
+        XE_2D_U32x8x16_ST_N,
+        void, void>;
+
+  using ConvKernel = kernel::ConvUniversal<
+    ProblemShape,
+    CollectiveMainloop,
+    CollectiveEpilogue
+  >;
+
+  using Conv = ConvUniversalAdapter<ConvKernel>;
+};
+
+} // namespace device
+} // namespace conv
+} // namespace cutlass
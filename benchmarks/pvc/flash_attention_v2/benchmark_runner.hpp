@@ -34,6 +34,7 @@
 #include "cutlass/epilogue/fusion/xe_callbacks.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 #include "flash_attention_v2/kernel/xe_flash_attn_gemm.hpp"
+#include "flash_attention_v2/kernel/xe_flash_attn_bwd_gemm.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_epilogue.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_softmax_epilogue.hpp"
 #include "cutlass/util/GPU_Clock.hpp"
@@ -60,13 +61,13 @@ struct FMHAOptions {
 
   bool error;
 
-  int batch, num_heads, seq_len, head_size, iterations;
+  int batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size, window_size, num_kv_splits, iterations;
   float softmax_scale;
   std::string bm_name;
 
   FMHAOptions()
-      : error(false), batch(32), num_heads(16), seq_len(512), head_size(128),
-        iterations(100), softmax_scale(1.f), bm_name("Flash Attention v2") {}
+      : error(false), batch(32), num_heads(16), num_heads_kv(16), seq_len_qo(512), seq_len_kv(512), head_size(128),
+        window_size(-1), num_kv_splits(1), iterations(100), softmax_scale(1.f), bm_name("Flash Attention v2") {}
 
   // Parses the command line
   void parse(int argc, char const **args) {
@@ -74,8 +75,16 @@ struct FMHAOptions {
 
     cmd.get_cmd_line_argument("batch", batch, 32);
     cmd.get_cmd_line_argument("num_heads", num_heads, 16);
+    cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, num_heads);
+    int seq_len;
     cmd.get_cmd_line_argument("seq_len", seq_len, 512);
+    cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, seq_len);
+    cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, seq_len);
     cmd.get_cmd_line_argument("head_size", head_size, 128);
+    // Number of previous keys seen by every query in sliding window benchmarks, negative for unbounded
+    cmd.get_cmd_line_argument("window_size", window_size, -1);
+    // Number of workgroups splitting the KV sequence of every output tile, 0 to pick it from the device
+    cmd.get_cmd_line_argument("num_kv_splits", num_kv_splits, 1);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
     cmd.get_cmd_line_argument("bm_name", bm_name, std::string("Flash Attention v2"));
 
@@ -87,9 +96,17 @@ struct FMHAOptions {
     full_name << bm_name << "/";
     std::string const test_name_suffix = std::to_string(batch) + "x" +
                                    std::to_string(num_heads) + "x" +
-                                   std::to_string(seq_len) + "x" +
+                                   std::to_string(num_heads_kv) + "x" +
+                                   std::to_string(seq_len_qo) + "x" +
+                                   std::to_string(seq_len_kv) + "x" +
                                    std::to_string(head_size);
     full_name << test_name_suffix;
+    if (window_size >= 0) {
+      full_name << "xw" << window_size;
+    }
+    if (num_kv_splits != 1) {
+      full_name << "xs" << num_kv_splits;
+    }
 
     return full_name.str();
   }
@@ -123,6 +140,12 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
 
   using ProblemShapeType = typename GemmKernel::ProblemShape;
   static constexpr bool Causal = FMHAConfiguration::Causal;
+  using Fusion = typename FMHAConfiguration::Fusion;
+  // The reference applies the fusion on the host, which is only possible for masks
+  static_assert(cute::is_same_v<Fusion, cutlass::fmha::collective::NoFusion> ||
+                cute::is_same_v<Fusion, cutlass::fmha::collective::CausalFusion> ||
+                cute::is_same_v<Fusion, cutlass::fmha::collective::SlidingWindowFusion>,
+                "Unsupported fusion for the FMHA benchmarks.");
 
   int32_t count;
 
@@ -147,116 +170,129 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
   // Methods
   //
 
-  bool verify(const ProblemShapeType &problem_size) {
-    auto [batch, num_heads, seq_len, head_size] = problem_size;
+  static typename Fusion::Arguments get_fusion_arguments(const FMHAOptions &options) {
+    if constexpr (cute::is_same_v<Fusion, cutlass::fmha::collective::SlidingWindowFusion>) {
+      // Causal sliding window
+      return {options.window_size, 0};
+    } else {
+      return {};
+    }
+  }
 
-    int batch_size = batch * num_heads;
+  bool verify(const ProblemShapeType &problem_size, typename Fusion::Arguments const &fusion_args) {
+    auto [batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_size;
+    auto fusion_params = Fusion::to_underlying_arguments(fusion_args);
+    int group_size = num_heads / num_heads_kv;
 
     // loop over the batch dimension to compute the output
     // to avoid the risk of running out of device memory
-    for (int b = 0, offset = 0; b < batch_size; b++, offset += seq_len * head_size) {
-
-      cutlass::DeviceAllocation<ElementOutput> block_S;
-      block_S.reset(seq_len * seq_len);
-
-      cutlass::TensorRef ref_Q(block_Q[0].get() + offset, LayoutQ::packed({seq_len, head_size}));
-      cutlass::TensorRef ref_K(block_K[0].get() + offset, LayoutK::packed({head_size, seq_len}));
-      cutlass::TensorRef ref_V(block_V[0].get() + offset, LayoutV::packed({seq_len, head_size}));
-      cutlass::TensorRef ref_S(block_S.get(), LayoutQ::packed({seq_len, seq_len}));
-      cutlass::TensorRef ref_O(block_ref_O.get() + offset, LayoutO::packed({seq_len, head_size}));
-
-      cutlass::reference::device::GemmComplex({seq_len, seq_len, head_size}, 1.f, ref_Q,
-                                              cutlass::ComplexTransform::kNone, ref_K, cutlass::ComplexTransform::kNone,
-                                              0.f, ref_S, ref_S, ElementAccumulator(0),
-                                              1,                   // batch_count
-                                              seq_len * head_size, // batch_stride_Q
-                                              seq_len * head_size, // batch_stride_K
-                                              seq_len * seq_len,   // batch_stride_S
-                                              seq_len * seq_len    // batch_stride_S
-      );
-
-      syclcompat::wait();
-
-      std::vector<ElementOutput> host_S(seq_len * seq_len);
-      syclcompat::memcpy<ElementOutput>(host_S.data(), block_S.get(), host_S.size());
-      syclcompat::wait();
-
-      // delete this memory as it is no longer needed
-      block_S.reset();
-
-      if (Causal) {
-        // apply mask to S
-        for (int row = 0; row < seq_len; row++) {
-          for (int col = 0; col < seq_len; col++) {
-            if (col > row)
-              host_S[col + row * seq_len] = -INFINITY;
+    int offset_qo = 0;
+    for (int b = 0; b < batch; b++) {
+      for (int h = 0; h < num_heads; h++, offset_qo += seq_len_qo * head_size) {
+        // query head h reads KV head h / group_size
+        int offset_kv = (b * num_heads_kv + h / group_size) * seq_len_kv * head_size;
+
+        cutlass::DeviceAllocation<ElementOutput> block_S;
+        block_S.reset(seq_len_qo * seq_len_kv);
+
+        cutlass::TensorRef ref_Q(block_Q[0].get() + offset_qo, LayoutQ::packed({seq_len_qo, head_size}));
+        cutlass::TensorRef ref_K(block_K[0].get() + offset_kv, LayoutK::packed({head_size, seq_len_kv}));
+        cutlass::TensorRef ref_V(block_V[0].get() + offset_kv, LayoutV::packed({seq_len_kv, head_size}));
+        cutlass::TensorRef ref_S(block_S.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
+        cutlass::TensorRef ref_O(block_ref_O.get() + offset_qo, LayoutO::packed({seq_len_qo, head_size}));
+
+        cutlass::reference::device::GemmComplex({seq_len_qo, seq_len_kv, head_size}, 1.f, ref_Q,
+                                                cutlass::ComplexTransform::kNone, ref_K, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_S, ref_S, ElementAccumulator(0),
+                                                1,                      // batch_count
+                                                seq_len_qo * head_size, // batch_stride_Q
+                                                seq_len_kv * head_size, // batch_stride_K
+                                                seq_len_qo * seq_len_kv, // batch_stride_S
+                                                seq_len_qo * seq_len_kv  // batch_stride_S
+        );
+
+        syclcompat::wait();
+
+        std::vector<ElementOutput> host_S(seq_len_qo * seq_len_kv);
+        syclcompat::memcpy<ElementOutput>(host_S.data(), block_S.get(), host_S.size());
+        syclcompat::wait();
+
+        // delete this memory as it is no longer needed
+        block_S.reset();
+
+        // apply the mask of the fusion to S, aligned to the bottom right corner
+        int causal_offset = seq_len_kv - seq_len_qo;
+        for (int row = 0; row < seq_len_qo; row++) {
+          for (int col = 0; col < seq_len_kv; col++) {
+            host_S[col + row * seq_len_kv] = Fusion::update(fusion_params, host_S[col + row * seq_len_kv], row, col,
+                                                            causal_offset, h, b, ElementOutput{1});
           }
         }
-      }
 
-      // compute max element per row of S
-      std::vector<ElementOutput> max_vec(seq_len, -INFINITY);
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int max_idx = row;
-        max_vec[max_idx] = host_S[idx++];
-        for (int col = 1; col < seq_len; col++, idx++) {
-          if (max_vec[max_idx] < host_S[idx])
-            max_vec[max_idx] = host_S[idx];
+        // compute max element per row of S
+        std::vector<ElementOutput> max_vec(seq_len_qo, -INFINITY);
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int max_idx = row;
+          max_vec[max_idx] = host_S[idx++];
+          for (int col = 1; col < seq_len_kv; col++, idx++) {
+            if (max_vec[max_idx] < host_S[idx])
+              max_vec[max_idx] = host_S[idx];
+          }
         }
-      }
 
-      // compute exp of S
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int max_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          host_S[idx] = expf((host_S[idx] - max_vec[max_idx]) / std::sqrt(static_cast<ElementOutput>((head_size))));
+        // compute exp of S
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int max_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            host_S[idx] = expf((host_S[idx] - max_vec[max_idx]) / std::sqrt(static_cast<ElementOutput>((head_size))));
+          }
         }
-      }
 
-      // compute sum per row of S
-      std::vector<ElementOutput> sum_vec(seq_len, ElementOutput{0});
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int sum_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          sum_vec[sum_idx] += host_S[idx];
-        }
+        // compute sum per row of S
+        std::vector<ElementOutput> sum_vec(seq_len_qo, ElementOutput{0});
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int sum_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            sum_vec[sum_idx] += host_S[idx];
+          }
 
-        // scale each row with the sum to compute softmax
-        idx = row * seq_len;
-        sum_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          host_S[idx] /= sum_vec[sum_idx];
+          // scale each row with the sum to compute softmax
+          idx = row * seq_len_kv;
+          sum_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            host_S[idx] /= sum_vec[sum_idx];
+          }
         }
-      }
 
-      std::vector<ElementV> host_P(host_S.size());
-      for (int p = 0; p < host_P.size(); p++)
-        host_P[p] = static_cast<ElementV>(host_S[p]);
+        std::vector<ElementV> host_P(host_S.size());
+        for (int p = 0; p < host_P.size(); p++)
+          host_P[p] = static_cast<ElementV>(host_S[p]);
 
-      cutlass::DeviceAllocation<ElementV> block_P;
-      block_P.reset(host_P.size());
+        cutlass::DeviceAllocation<ElementV> block_P;
+        block_P.reset(host_P.size());
 
-      syclcompat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
-      syclcompat::wait();
+        syclcompat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        syclcompat::wait();
 
-      cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len, seq_len}));
+        cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
 
-      cutlass::reference::device::GemmComplex({seq_len, head_size, seq_len}, 1.f, ref_P,
-                                              cutlass::ComplexTransform::kNone, ref_V, cutlass::ComplexTransform::kNone,
-                                              0.f, ref_O, ref_O, ElementAccumulator(0),
-                                              1,                   // batch_count
-                                              seq_len * seq_len,   // batch_stride_P
-                                              seq_len * head_size, // batch_stride_V
-                                              seq_len * head_size, // batch_stride_O
-                                              seq_len * head_size  // batch_stride_O
-      );
+        cutlass::reference::device::GemmComplex({seq_len_qo, head_size, seq_len_kv}, 1.f, ref_P,
+                                                cutlass::ComplexTransform::kNone, ref_V, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_O, ref_O, ElementAccumulator(0),
+                                                1,                       // batch_count
+                                                seq_len_qo * seq_len_kv, // batch_stride_P
+                                                seq_len_kv * head_size,  // batch_stride_V
+                                                seq_len_qo * head_size,  // batch_stride_O
+                                                seq_len_qo * head_size   // batch_stride_O
+        );
 
-      syclcompat::wait();
-      // delete this memory as it is no longer needed
-      block_P.reset();
+        syclcompat::wait();
+        // delete this memory as it is no longer needed
+        block_P.reset();
+      }
     }
 
     syclcompat::wait();
@@ -270,18 +306,18 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
 
   /// Initialize operands to be used in the GEMM and reference GEMM
   void initialize(const ProblemShapeType &problem_size) {
-    // auto problem_shape = cute::append<4>(problem_size, 1);
-    auto [batch, num_heads, seq_len, head_size] = problem_size;
+    auto [batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_size;
 
-    stride_Q = cutlass::make_cute_packed_stride(StrideQ{}, cute::make_shape(seq_len, head_size, batch * num_heads));
-    stride_K = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(seq_len, head_size, batch * num_heads));
-    stride_V = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size, seq_len, batch * num_heads));
-    stride_O = cutlass::make_cute_packed_stride(StrideO{}, cute::make_shape(seq_len, head_size, batch * num_heads));
+    stride_Q = cutlass::make_cute_packed_stride(StrideQ{}, cute::make_shape(seq_len_qo, head_size, batch * num_heads));
+    stride_K = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(seq_len_kv, head_size, batch * num_heads_kv));
+    stride_V = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size, seq_len_kv, batch * num_heads_kv));
+    stride_O = cutlass::make_cute_packed_stride(StrideO{}, cute::make_shape(seq_len_qo, head_size, batch * num_heads));
 
-    auto mem_size = batch * num_heads * seq_len * head_size;
+    auto mem_size_qo = batch * num_heads * seq_len_qo * head_size;
+    auto mem_size_kv = batch * num_heads_kv * seq_len_kv * head_size;
 
-    std::size_t mem_occupied_QKV = (mem_size * sizeof(ElementQ)) + (mem_size * sizeof(ElementK)) + 
-                                   (mem_size * sizeof(ElementV));
+    std::size_t mem_occupied_QKV = (mem_size_qo * sizeof(ElementQ)) + (mem_size_kv * sizeof(ElementK)) + 
+                                   (mem_size_kv * sizeof(ElementV));
 
     count = std::ceil(static_cast<float>(cutlass::get_llc_size()) / static_cast<float>(mem_occupied_QKV)) + 1;
 
@@ -293,33 +329,34 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
 
     
     for(int i = 0; i < count; i++) {
-      block_Q[i].reset(mem_size);
-      block_K[i].reset(mem_size);
-      block_V[i].reset(mem_size);
+      block_Q[i].reset(mem_size_qo);
+      block_K[i].reset(mem_size_kv);
+      block_V[i].reset(mem_size_kv);
 
       initialize_block(block_Q[i], seed + i);
       initialize_block(block_K[i], seed + i);
       initialize_block(block_V[i], seed + i);
     }
 
-    block_O.reset(mem_size);
-    block_ref_O.reset(mem_size);
+    block_O.reset(mem_size_qo);
+    block_ref_O.reset(mem_size_qo);
   }
 
-  static void run(typename GemmKernel::Params params) {
-    dim3 const block = GemmKernel::get_block_shape();
-    dim3 const grid = GemmKernel::get_grid_shape(params);
+  template <class Kernel = GemmKernel>
+  static void run(typename Kernel::Params params) {
+    dim3 const block = Kernel::get_block_shape();
+    dim3 const grid = Kernel::get_grid_shape(params);
 
     // configure smem size and carveout
-    int smem_size = GemmKernel::SharedStorageSize;
+    int smem_size = Kernel::SharedStorageSize;
 
     const auto sycl_block = syclcompat::dim3(block.x, block.y, block.z);
     const auto sycl_grid = syclcompat::dim3(grid.x, grid.y, grid.z);
 
     using namespace syclcompat::experimental;
-    auto event = launch<cutlass::device_kernel<GemmKernel>>(
+    auto event = launch<cutlass::device_kernel<Kernel>>(
         launch_policy{sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)},
-                      kernel_properties{sycl_exp::sub_group_size<GemmKernel::DispatchPolicy::SubgroupSize>}},
+                      kernel_properties{sycl_exp::sub_group_size<Kernel::DispatchPolicy::SubgroupSize>}},
         params);
 
     EventManager::getInstance().addEvent(event);
@@ -327,17 +364,21 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
 
   void run(::benchmark::State& state, const FMHAOptions &options, const cutlass::KernelHardwareInfo &hw_info) {
     ProblemShapeType problem_size =
-        ProblemShapeType{options.batch, options.num_heads, options.seq_len, options.head_size};
+        ProblemShapeType{options.batch,      options.num_heads,  options.num_heads_kv,
+                         options.seq_len_qo, options.seq_len_kv, options.head_size};
 
     initialize(problem_size);
 
     typename GemmKernel::Arguments arguments{
         cutlass::gemm::GemmUniversalMode::kGemm,
         problem_size,
-        {block_Q[0].get(), stride_Q, block_K[0].get(), stride_K, block_V[0].get(), stride_V},
+        {block_Q[0].get(), stride_Q, block_K[0].get(), stride_K, block_V[0].get(), stride_V, nullptr, 0, 0, 0,
+         get_fusion_arguments(options)},
         {options.softmax_scale},
         {block_O.get(), stride_O},
-        hw_info};
+        hw_info,
+        {},
+        options.num_kv_splits};
 
     // GemmKernel gemm_op;
 
@@ -360,14 +401,16 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
     syclcompat::wait();
 
     // Verify that the result is correct
-    bool passed = verify(problem_size);
+    bool passed = verify(problem_size, get_fusion_arguments(options));
     if(not passed) {
       state.SkipWithError("Disposition Failed.");
     }
 
     state.counters["batch"] = options.batch;
     state.counters["num_heads"] = options.num_heads;
-    state.counters["seq_len"] = options.seq_len;
+    state.counters["num_heads_kv"] = options.num_heads_kv;
+    state.counters["seq_len_qo"] = options.seq_len_qo;
+    state.counters["seq_len_kv"] = options.seq_len_kv;
     state.counters["head_size"] = options.head_size;
     state.counters["scale"] = options.softmax_scale;
     state.counters["causal"] = Causal;
@@ -379,12 +422,13 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
 
     state.SetLabel(extra_label.str());
 
-    double flops_qk = 2.0 * options.batch * options.num_heads * options.seq_len * options.seq_len * options.head_size;
-    double flops_pv = 2.0 * options.batch * options.num_heads * options.seq_len * options.head_size * options.seq_len;
+    double flops_qk = 2.0 * options.batch * options.num_heads * options.seq_len_qo * options.seq_len_kv * options.head_size;
+    double flops_pv = 2.0 * options.batch * options.num_heads * options.seq_len_qo * options.head_size * options.seq_len_kv;
     double gflops = (flops_qk + flops_pv) * 1e-9;
 
-    double mega_bytes_transferred = options.batch * options.num_heads *
-                  (options.seq_len * options.head_size + options.seq_len * options.head_size) * 2 * 2 * (1e-6);
+    double mega_bytes_transferred = options.batch *
+                  (options.num_heads * options.seq_len_qo + options.num_heads_kv * options.seq_len_kv) *
+                  options.head_size * 2 * 2 * (1e-6);
 
     initialize_counters(state);
     int32_t counter = 1;
@@ -395,10 +439,13 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
       typename GemmKernel::Arguments arguments{
           cutlass::gemm::GemmUniversalMode::kGemm,
           problem_size,
-          {block_Q[input_num].get(), stride_Q, block_K[input_num].get(), stride_K, block_V[input_num].get(), stride_V},
+          {block_Q[input_num].get(), stride_Q, block_K[input_num].get(), stride_K, block_V[input_num].get(), stride_V,
+           nullptr, 0, 0, 0, get_fusion_arguments(options)},
           {options.softmax_scale},
           {block_O.get(), stride_O},
-          hw_info};
+          hw_info,
+          {},
+          options.num_kv_splits};
 
       size_t workspace_size = GemmKernel::get_workspace_size(arguments);
       cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
@@ -426,7 +473,7 @@ template <class FMHAConfiguration> struct BenchmarkRunnerFMHA {
     finalize_counters(state, gflops, mega_bytes_transferred);
   }
 
-private:
+protected:
   static void initialize_counters(::benchmark::State& state) {
     state.counters["avg_runtime_ms"] = 0;
     state.counters["best_runtime_ms"] = std::numeric_limits<double>::max();
@@ -449,6 +496,290 @@ private:
   }
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Times the backward pass. Every input set is run through the forward kernel first to produce the O and LSE it reads.
+template <class FMHAConfiguration> struct BenchmarkRunnerFMHABwd : BenchmarkRunnerFMHA<FMHAConfiguration> {
+
+  using Base = BenchmarkRunnerFMHA<FMHAConfiguration>;
+  using GemmKernel = typename Base::GemmKernel;
+  using GemmKernelDQ = typename FMHAConfiguration::GemmKernelDQ;
+  using GemmKernelDKDV = typename FMHAConfiguration::GemmKernelDKDV;
+
+  using ElementQ = typename Base::ElementQ;
+  using ElementOutput = typename Base::ElementOutput;
+  using ElementAccumulator = typename Base::ElementAccumulator;
+  using ProblemShapeType = typename Base::ProblemShapeType;
+  static constexpr bool Causal = Base::Causal;
+
+  //
+  // Data members
+  //
+
+  std::vector<cutlass::DeviceAllocation<ElementQ>> block_dO;
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_fwd_O;
+  std::vector<cutlass::DeviceAllocation<ElementOutput>> block_fwd_LSE;
+  cutlass::DeviceAllocation<ElementOutput> block_dQ;
+  cutlass::DeviceAllocation<ElementOutput> block_dK;
+  cutlass::DeviceAllocation<ElementOutput> block_dV;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_dQ;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_dK;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_dV;
+
+  //
+  // Methods
+  //
+
+  // Computes the reference gradients of every head from scratch, with D = rowsum(P * dP) = rowsum(dO * O)
+  bool verify(const ProblemShapeType &problem_size, float softmax_scale) {
+    auto [batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_size;
+    int group_size = num_heads / num_heads_kv;
+    using RowMajor = cutlass::layout::RowMajor;
+    using ColumnMajor = cutlass::layout::ColumnMajor;
+
+    for (int b = 0; b < batch; b++) {
+      for (int h = 0; h < num_heads; h++) {
+        int offset_qo = (b * num_heads + h) * seq_len_qo * head_size;
+        int offset_kv = (b * num_heads_kv + h / group_size) * seq_len_kv * head_size;
+        // the query heads of a group accumulate into the same dK and dV
+        float beta_kv = h % group_size == 0 ? 0.f : 1.f;
+
+        cutlass::DeviceAllocation<ElementOutput> block_S;
+        cutlass::DeviceAllocation<ElementOutput> block_dP;
+        block_S.reset(seq_len_qo * seq_len_kv);
+        block_dP.reset(seq_len_qo * seq_len_kv);
+
+        cutlass::TensorRef ref_Q(this->block_Q[0].get() + offset_qo, RowMajor::packed({seq_len_qo, head_size}));
+        cutlass::TensorRef ref_Kt(this->block_K[0].get() + offset_kv, ColumnMajor::packed({head_size, seq_len_kv}));
+        cutlass::TensorRef ref_K(this->block_K[0].get() + offset_kv, RowMajor::packed({seq_len_kv, head_size}));
+        cutlass::TensorRef ref_Vt(this->block_V[0].get() + offset_kv, ColumnMajor::packed({head_size, seq_len_kv}));
+        cutlass::TensorRef ref_dO(block_dO[0].get() + offset_qo, RowMajor::packed({seq_len_qo, head_size}));
+        cutlass::TensorRef ref_S(block_S.get(), RowMajor::packed({seq_len_qo, seq_len_kv}));
+        cutlass::TensorRef ref_dP(block_dP.get(), RowMajor::packed({seq_len_qo, seq_len_kv}));
+        cutlass::TensorRef ref_dQ(block_ref_dQ.get() + offset_qo, RowMajor::packed({seq_len_qo, head_size}));
+        cutlass::TensorRef ref_dK(block_ref_dK.get() + offset_kv, RowMajor::packed({seq_len_kv, head_size}));
+        cutlass::TensorRef ref_dV(block_ref_dV.get() + offset_kv, RowMajor::packed({seq_len_kv, head_size}));
+
+        // S = Q K^T and dP = dO V^T
+        cutlass::reference::device::GemmComplex({seq_len_qo, seq_len_kv, head_size}, 1.f, ref_Q,
+                                                cutlass::ComplexTransform::kNone, ref_Kt, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_S, ref_S, ElementAccumulator(0));
+        cutlass::reference::device::GemmComplex({seq_len_qo, seq_len_kv, head_size}, 1.f, ref_dO,
+                                                cutlass::ComplexTransform::kNone, ref_Vt, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_dP, ref_dP, ElementAccumulator(0));
+        syclcompat::wait();
+
+        std::vector<ElementOutput> host_S(seq_len_qo * seq_len_kv);
+        std::vector<ElementOutput> host_dP(seq_len_qo * seq_len_kv);
+        syclcompat::memcpy<ElementOutput>(host_S.data(), block_S.get(), host_S.size());
+        syclcompat::memcpy<ElementOutput>(host_dP.data(), block_dP.get(), host_dP.size());
+        syclcompat::wait();
+        block_S.reset();
+        block_dP.reset();
+
+        // P = softmax(S * softmax_scale) with the causal mask aligned to the bottom right corner, and
+        // dS = P * (dP - D) * softmax_scale
+        std::vector<ElementQ> host_P(host_S.size());
+        std::vector<ElementQ> host_dS(host_S.size());
+        int causal_offset = seq_len_kv - seq_len_qo;
+        for (int row = 0; row < seq_len_qo; row++) {
+          int row_end = Causal ? std::min(seq_len_kv, row + causal_offset + 1) : seq_len_kv;
+          ElementOutput *S = host_S.data() + row * seq_len_kv;
+          ElementOutput *dP = host_dP.data() + row * seq_len_kv;
+          ElementOutput max = -INFINITY;
+          for (int col = 0; col < row_end; col++) {
+            max = std::max(max, S[col]);
+          }
+          ElementOutput sum{0};
+          for (int col = 0; col < seq_len_kv; col++) {
+            S[col] = col < row_end ? expf((S[col] - max) * softmax_scale) : ElementOutput{0};
+            sum += S[col];
+          }
+          ElementOutput D{0};
+          for (int col = 0; col < seq_len_kv; col++) {
+            S[col] /= sum;
+            D += S[col] * dP[col];
+          }
+          for (int col = 0; col < seq_len_kv; col++) {
+            host_P[row * seq_len_kv + col] = static_cast<ElementQ>(S[col]);
+            host_dS[row * seq_len_kv + col] = static_cast<ElementQ>(S[col] * (dP[col] - D) * softmax_scale);
+          }
+        }
+
+        cutlass::DeviceAllocation<ElementQ> block_P;
+        cutlass::DeviceAllocation<ElementQ> block_dS;
+        block_P.reset(host_P.size());
+        block_dS.reset(host_dS.size());
+        syclcompat::memcpy<ElementQ>(block_P.get(), host_P.data(), host_P.size());
+        syclcompat::memcpy<ElementQ>(block_dS.get(), host_dS.data(), host_dS.size());
+        syclcompat::wait();
+
+        cutlass::TensorRef ref_Pt(block_P.get(), ColumnMajor::packed({seq_len_kv, seq_len_qo}));
+        cutlass::TensorRef ref_dS(block_dS.get(), RowMajor::packed({seq_len_qo, seq_len_kv}));
+        cutlass::TensorRef ref_dSt(block_dS.get(), ColumnMajor::packed({seq_len_kv, seq_len_qo}));
+
+        // dQ = dS K, dK += dS^T Q and dV += P^T dO
+        cutlass::reference::device::GemmComplex({seq_len_qo, head_size, seq_len_kv}, 1.f, ref_dS,
+                                                cutlass::ComplexTransform::kNone, ref_K, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_dQ, ref_dQ, ElementAccumulator(0));
+        cutlass::reference::device::GemmComplex({seq_len_kv, head_size, seq_len_qo}, 1.f, ref_dSt,
+                                                cutlass::ComplexTransform::kNone, ref_Q, cutlass::ComplexTransform::kNone,
+                                                beta_kv, ref_dK, ref_dK, ElementAccumulator(0));
+        cutlass::reference::device::GemmComplex({seq_len_kv, head_size, seq_len_qo}, 1.f, ref_Pt,
+                                                cutlass::ComplexTransform::kNone, ref_dO, cutlass::ComplexTransform::kNone,
+                                                beta_kv, ref_dV, ref_dV, ElementAccumulator(0));
+        syclcompat::wait();
+      }
+    }
+
+    bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dQ.get(), block_dQ.get(),
+                                                                          block_dQ.size(), 0.5f, 0.5f);
+    passed &= cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dK.get(), block_dK.get(),
+                                                                       block_dK.size(), 0.5f, 0.5f);
+    passed &= cutlass::reference::device::BlockCompareRelativelyEqual(block_ref_dV.get(), block_dV.get(),
+                                                                       block_dV.size(), 0.5f, 0.5f);
+    return passed;
+  }
+
+  /// Initialize the inputs and run the forward pass on each of them
+  void initialize(const ProblemShapeType &problem_size, float softmax_scale,
+                  const cutlass::KernelHardwareInfo &hw_info) {
+    Base::initialize(problem_size);
+    auto [batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size] = problem_size;
+
+    auto mem_size_qo = batch * num_heads * seq_len_qo * head_size;
+    auto mem_size_kv = batch * num_heads_kv * seq_len_kv * head_size;
+    auto mem_size_lse = batch * num_heads * seq_len_qo;
+
+    for (int i = 0; i < this->count; i++) {
+      block_dO.emplace_back();
+      block_fwd_O.emplace_back();
+      block_fwd_LSE.emplace_back();
+      block_dO[i].reset(mem_size_qo);
+      block_fwd_O[i].reset(mem_size_qo);
+      block_fwd_LSE[i].reset(mem_size_lse);
+      initialize_block(block_dO[i], this->seed + this->count + i);
+
+      typename GemmKernel::Arguments arguments{
+          cutlass::gemm::GemmUniversalMode::kGemm,
+          problem_size,
+          {this->block_Q[i].get(), this->stride_Q, this->block_K[i].get(), this->stride_K, this->block_V[i].get(),
+           this->stride_V},
+          {softmax_scale},
+          {block_fwd_O[i].get(), this->stride_O, block_fwd_LSE[i].get()},
+          hw_info};
+      cutlass::device_memory::allocation<uint8_t> workspace(GemmKernel::get_workspace_size(arguments));
+      GemmKernel::initialize_workspace(arguments, workspace.get());
+      Base::run(GemmKernel::to_underlying_arguments(arguments, workspace.get()));
+      syclcompat::wait();
+    }
+
+    block_dQ.reset(mem_size_qo);
+    block_dK.reset(mem_size_kv);
+    block_dV.reset(mem_size_kv);
+    block_ref_dQ.reset(mem_size_qo);
+    block_ref_dK.reset(mem_size_kv);
+    block_ref_dV.reset(mem_size_kv);
+  }
+
+  template <class Kernel>
+  typename Kernel::Arguments make_arguments(const ProblemShapeType &problem_size, int input_num,
+                                            float softmax_scale, const cutlass::KernelHardwareInfo &hw_info) {
+    return {cutlass::gemm::GemmUniversalMode::kGemm,
+            problem_size,
+            this->block_Q[input_num].get(),
+            this->block_K[input_num].get(),
+            this->block_V[input_num].get(),
+            block_fwd_O[input_num].get(),
+            block_fwd_LSE[input_num].get(),
+            block_dO[input_num].get(),
+            block_dQ.get(),
+            block_dK.get(),
+            block_dV.get(),
+            softmax_scale,
+            hw_info};
+  }
+
+  void run(::benchmark::State& state, const FMHAOptions &options, const cutlass::KernelHardwareInfo &hw_info) {
+    ProblemShapeType problem_size =
+        ProblemShapeType{options.batch,      options.num_heads,  options.num_heads_kv,
+                         options.seq_len_qo, options.seq_len_kv, options.head_size};
+
+    initialize(problem_size, options.softmax_scale, hw_info);
+
+    auto arguments_dq = make_arguments<GemmKernelDQ>(problem_size, 0, options.softmax_scale, hw_info);
+    auto arguments_dkdv = make_arguments<GemmKernelDKDV>(problem_size, 0, options.softmax_scale, hw_info);
+    if (not GemmKernelDQ::can_implement(arguments_dq) or not GemmKernelDKDV::can_implement(arguments_dkdv)) {
+      state.SkipWithError("Invalid Problem Size");
+      return;
+    }
+
+    // Both kernels share the workspace holding D
+    cutlass::device_memory::allocation<uint8_t> workspace(GemmKernelDQ::get_workspace_size(arguments_dq));
+
+    Base::template run<GemmKernelDQ>(GemmKernelDQ::to_underlying_arguments(arguments_dq, workspace.get()));
+    Base::template run<GemmKernelDKDV>(GemmKernelDKDV::to_underlying_arguments(arguments_dkdv, workspace.get()));
+
+    syclcompat::wait();
+
+    // Verify that the result is correct
+    bool passed = verify(problem_size, options.softmax_scale);
+    if(not passed) {
+      state.SkipWithError("Disposition Failed.");
+    }
+
+    state.counters["batch"] = options.batch;
+    state.counters["num_heads"] = options.num_heads;
+    state.counters["num_heads_kv"] = options.num_heads_kv;
+    state.counters["seq_len_qo"] = options.seq_len_qo;
+    state.counters["seq_len_kv"] = options.seq_len_kv;
+    state.counters["head_size"] = options.head_size;
+    state.counters["scale"] = options.softmax_scale;
+    state.counters["causal"] = Causal;
+
+    std::stringstream extra_label;
+    extra_label << "layoutQ=RowMajor ";
+    extra_label << "layoutK=ColumnMajor ";
+    extra_label << "layoutV=RowMajor ";
+
+    state.SetLabel(extra_label.str());
+
+    // S = Q K^T, dP = dO V^T, dV = P^T dO, dQ = dS K and dK = dS^T Q
+    double flops_gemm = 2.0 * options.batch * options.num_heads * options.seq_len_qo * options.seq_len_kv * options.head_size;
+    double gflops = 5 * flops_gemm * 1e-9;
+
+    // Q, dO, O and dQ per query head, K, V, dK and dV per KV head
+    double mega_bytes_transferred = options.batch * options.head_size *
+                  (options.num_heads * options.seq_len_qo * (2 * sizeof(ElementQ) + 2 * sizeof(ElementOutput)) +
+                   options.num_heads_kv * options.seq_len_kv * (2 * sizeof(ElementQ) + 2 * sizeof(ElementOutput))) *
+                  (1e-6);
+
+    Base::initialize_counters(state);
+    int32_t counter = 1;
+    for(auto _ : state) {
+      state.PauseTiming();
+      int input_num = std::max(int(0), counter % this->count);
+
+      auto params_dq = GemmKernelDQ::to_underlying_arguments(
+          make_arguments<GemmKernelDQ>(problem_size, input_num, options.softmax_scale, hw_info), workspace.get());
+      auto params_dkdv = GemmKernelDKDV::to_underlying_arguments(
+          make_arguments<GemmKernelDKDV>(problem_size, input_num, options.softmax_scale, hw_info), workspace.get());
+
+      state.ResumeTiming();
+
+      GPU_Clock timer;
+      timer.start();
+      Base::template run<GemmKernelDQ>(params_dq);
+      Base::template run<GemmKernelDKDV>(params_dkdv);
+      auto ms_elapsed = timer.milliseconds();
+      Base::update_counters(state, ms_elapsed);
+      state.SetIterationTime(ms_elapsed / 1000);
+      counter++;
+    }
+    Base::finalize_counters(state, gflops, mega_bytes_transferred);
+  }
+};
+
 }
 
 #define CUTLASS_FMHA_BENCHMARK(F) cutlass::benchmark::BenchmarkRegistry<cutlass::benchmark::FMHAOptions>::Register(#F, &F##_func)
@@ -461,3 +792,12 @@ private:
     auto bench = cutlass::benchmark::BenchmarkRunnerFMHA<F>();    \
     bench.run(state, options, hw_info);                           \
   }
+
+#define CUTLASS_CREATE_FMHA_BWD_BENCHMARK(F)                      \
+  static void F##_func(                                           \
+      ::benchmark::State& state,                                  \
+      cutlass::benchmark::FMHAOptions const& options,             \
+      cutlass::KernelHardwareInfo const& hw_info) {               \
+    auto bench = cutlass::benchmark::BenchmarkRunnerFMHABwd<F>(); \
+    bench.run(state, options, hw_info);                           \
+  }
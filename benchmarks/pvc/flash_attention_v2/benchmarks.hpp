@@ -128,6 +128,54 @@ using PvcFMHAFP16FP16FP32_RCR_h128_NonCausal = cutlass::flash_attention::FMHACon
         false, Shape<_128, _128, _64>,
         TiledMmaFP16_h128>;
 
+// Mistral-style causal sliding window, the KV blocks outside of the window are skipped
+using PvcFMHABF16BF16FP32_RCR_h128_SlidingWindow = cutlass::flash_attention::FMHAConfig<
+        cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+        cutlass::layout::RowMajor,
+        cutlass::layout::ColumnMajor,
+        cutlass::layout::RowMajor,
+        cutlass::layout::RowMajor,
+        false, Shape<_128, _128, _64>,
+        TiledMmaBF16_h128,
+        cutlass::fmha::collective::SlidingWindowFusion>;
+
+//bfloat16 backward benchmarks
+using PvcFMHABwdBF16BF16FP32_RCR_h64_Causal = cutlass::flash_attention::FMHABwdConfig<
+        cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+        cutlass::layout::RowMajor,
+        cutlass::layout::ColumnMajor,
+        cutlass::layout::RowMajor,
+        cutlass::layout::RowMajor,
+        true, Shape<_128, _64, _64>,
+        TiledMmaBF16_h64>;
+
+using PvcFMHABwdBF16BF16FP32_RCR_h64_NonCausal = cutlass::flash_attention::FMHABwdConfig<
+        cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+        cutlass::layout::RowMajor,
+        cutlass::layout::ColumnMajor,
+        cutlass::layout::RowMajor,
+        cutlass::layout::RowMajor,
+        false, Shape<_128, _64, _64>,
+        TiledMmaBF16_h64>;
+
+using PvcFMHABwdBF16BF16FP32_RCR_h128_Causal = cutlass::flash_attention::FMHABwdConfig<
+        cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+        cutlass::layout::RowMajor,
+        cutlass::layout::ColumnMajor,
+        cutlass::layout::RowMajor,
+        cutlass::layout::RowMajor,
+        true, Shape<_128, _128, _64>,
+        TiledMmaBF16_h128>;
+
+using PvcFMHABwdBF16BF16FP32_RCR_h128_NonCausal = cutlass::flash_attention::FMHABwdConfig<
+        cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+        cutlass::layout::RowMajor,
+        cutlass::layout::ColumnMajor,
+        cutlass::layout::RowMajor,
+        cutlass::layout::RowMajor,
+        false, Shape<_128, _128, _64>,
+        TiledMmaBF16_h128>;
+
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h64_Causal);
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h64_NonCausal);
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h128_Causal);
@@ -136,3 +184,8 @@ CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h64_Causal);
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h64_NonCausal);
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h128_Causal);
 CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHAFP16FP16FP32_RCR_h128_NonCausal);
+CUTLASS_CREATE_FMHA_BENCHMARK(PvcFMHABF16BF16FP32_RCR_h128_SlidingWindow);
+CUTLASS_CREATE_FMHA_BWD_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h64_Causal);
+CUTLASS_CREATE_FMHA_BWD_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h64_NonCausal);
+CUTLASS_CREATE_FMHA_BWD_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h128_Causal);
+CUTLASS_CREATE_FMHA_BWD_BENCHMARK(PvcFMHABwdBF16BF16FP32_RCR_h128_NonCausal);
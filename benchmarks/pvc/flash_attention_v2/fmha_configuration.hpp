@@ -35,7 +35,9 @@ namespace flash_attention{
 
 template <typename ElementQ_, typename ElementK_, typename ElementV_, typename LayoutQ_,
           typename LayoutK_, typename LayoutV_, typename LayoutO_, bool Causal_,
-          typename TileShape_, typename TiledMma_> 
+          typename TileShape_, typename TiledMma_,
+          typename Fusion_ = cute::conditional_t<Causal_, cutlass::fmha::collective::CausalFusion,
+                                                 cutlass::fmha::collective::NoFusion>>
 struct FMHAConfig {
 
   using ElementO = float;     // <- data type of accumulator
@@ -52,6 +54,7 @@ struct FMHAConfig {
   using TiledMma = TiledMma_;
 
   static constexpr bool Causal = Causal_;
+  using Fusion = Fusion_;
   
   static constexpr int PipelineStages = 2;
   using GEMMDispatchPolicy = cutlass::gemm::MainloopIntelPVC<PipelineStages>;
@@ -74,11 +77,29 @@ struct FMHAConfig {
       GmemTiledCopyQ, // Q
       GmemTiledCopyK, // K
       GmemTiledCopyV, // V,
-      Causal>;
+      Causal, Fusion>;
 
-  using GemmKernel = cutlass::gemm::kernel::GemmUniversalAttention<Shape<int, int, int, int>, CollectiveMainloop,
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversalAttention<Shape<int, int, int, int, int, int>, CollectiveMainloop,
                                                                     CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
 };
 
+// Backward pass of an FMHAConfig. GemmKernel produces the O and LSE consumed by the gradient kernels, which must be
+// launched in order: GemmKernelDQ computes dQ and the row sums D used by GemmKernelDKDV.
+template <typename ElementQ_, typename ElementK_, typename ElementV_, typename LayoutQ_,
+          typename LayoutK_, typename LayoutV_, typename LayoutO_, bool Causal_,
+          typename TileShape_, typename TiledMma_>
+struct FMHABwdConfig : FMHAConfig<ElementQ_, ElementK_, ElementV_, LayoutQ_, LayoutK_, LayoutV_, LayoutO_, Causal_,
+                                  TileShape_, TiledMma_> {
+  using Base = FMHAConfig<ElementQ_, ElementK_, ElementV_, LayoutQ_, LayoutK_, LayoutV_, LayoutO_, Causal_,
+                          TileShape_, TiledMma_>;
+
+  using GemmKernelDQ = cutlass::gemm::kernel::GemmUniversalAttentionBwd<
+      Shape<int, int, int, int, int, int>, typename Base::CollectiveMainloop, typename Base::CollectiveEpilogue,
+      cutlass::gemm::kernel::FlashAttnBwdDQ>;
+  using GemmKernelDKDV = cutlass::gemm::kernel::GemmUniversalAttentionBwd<
+      Shape<int, int, int, int, int, int>, typename Base::CollectiveMainloop, typename Base::CollectiveEpilogue,
+      cutlass::gemm::kernel::FlashAttnBwdDKDV>;
+};
+
 } // namespace flash_attention
 } // namespace cutlass
@@ -52,7 +52,10 @@ namespace cutlass {
 namespace gemm {
 namespace device {
 
-enum class Scheduler { Gemm, GemmSplitK, GemmStreamK };
+enum class Scheduler { Gemm, GemmSplitK, GemmStreamK, GemmPersistent };
+
+// Passed as the kernel schedule to select the mainloop that stages A and B through shared local memory
+struct KernelPVCSlm : cutlass::gemm::KernelPVC { };
 
 template<
   class ArchTag,
@@ -62,7 +65,8 @@ template<
   class ElementAccumulator,
   class TileShape, class TiledMma,
   class GmemTiledCopyA, class GmemTiledCopyB,
-  Scheduler TileScheduler>
+  Scheduler TileScheduler,
+  class KernelSchedule = void>
 struct GemmConfiguration {
   static_assert(sizeof(ElementA) == 0, "No valid GemmConfiguration configuration exists.");
 };
@@ -72,15 +76,21 @@ struct GemmConfiguration {
 // bfloat16
 
 template<typename LayoutA, typename LayoutB, typename LayoutC,
-  class TileShape, class TiledMma, class GmemTiledCopyA, class GmemTiledCopyB, Scheduler TileScheduler>
+  class TileShape, class TiledMma, class GmemTiledCopyA, class GmemTiledCopyB, Scheduler TileScheduler,
+  class KernelSchedule>
 struct GemmConfiguration<
       arch::IntelPVC,
       bfloat16_t, LayoutA,
       bfloat16_t, LayoutB,
       float, LayoutC,
       float, TileShape, TiledMma,
-      GmemTiledCopyA, GmemTiledCopyB, TileScheduler> {
-  using DispatchPolicy = MainloopIntelPVC<3, std::conditional_t<TileScheduler == Scheduler::Gemm, cutlass::gemm::KernelPVC, cutlass::gemm::KernelPVCCooperative>>;
+      GmemTiledCopyA, GmemTiledCopyB, TileScheduler, KernelSchedule> {
+  // Unless a kernel schedule is given, split-K, stream-K and the persistent work queue run on the cooperative kernel
+  using DefaultKernelSchedule = std::conditional_t<TileScheduler == Scheduler::Gemm,
+                                                   cutlass::gemm::KernelPVC, cutlass::gemm::KernelPVCCooperative>;
+  using DispatchPolicy = std::conditional_t<std::is_same_v<KernelSchedule, KernelPVCSlm>,
+    MainloopIntelPVCSlm<2>,
+    MainloopIntelPVC<3, std::conditional_t<std::is_void_v<KernelSchedule>, DefaultKernelSchedule, KernelSchedule>>>;
 
   // Mainloop
   using CollectiveMainloop = collective::CollectiveMma<
@@ -115,7 +125,9 @@ struct GemmConfiguration<
     Shape<int, int, int, int>,
     CollectiveMainloop,
     CollectiveEpilogue,
-    std::conditional_t<TileScheduler == Scheduler::Gemm, void, cutlass::gemm::StreamKScheduler>
+    std::conditional_t<TileScheduler == Scheduler::Gemm, void,
+      std::conditional_t<TileScheduler == Scheduler::GemmPersistent, cutlass::gemm::DynamicPersistentScheduler,
+                         cutlass::gemm::StreamKScheduler>>
   >;
 
   using Gemm = GemmUniversalAdapter<GemmKernel>;
@@ -123,18 +135,78 @@ struct GemmConfiguration<
   constexpr static typename GemmKernel::Arguments defaultArguments() {
     using StreamKMode =
       cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
-    if constexpr (TileScheduler == Scheduler::Gemm) {
-      return {};
+    // Let the kernels group up to 8 tiles to keep the operand panels in L2
+    constexpr int MaxSwizzleSize = 8;
+    typename GemmKernel::Arguments arguments{};
+    if constexpr (TileScheduler == Scheduler::Gemm || TileScheduler == Scheduler::GemmPersistent) {
+      arguments.scheduler.max_swizzle_size = MaxSwizzleSize;
     } else if constexpr (TileScheduler == Scheduler::GemmStreamK) {
-      typename GemmKernel::Arguments arguments{};
       arguments.scheduler = {1, StreamKMode::StreamK};
-      return arguments;
+      arguments.scheduler.max_swizzle_size = MaxSwizzleSize;
     } else {
       static_assert(TileScheduler == Scheduler::GemmSplitK);
-      typename GemmKernel::Arguments arguments{};
       arguments.scheduler = {1, StreamKMode::SplitK};
-      return arguments;
+      arguments.scheduler.max_swizzle_size = MaxSwizzleSize;
     }
+    return arguments;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////
+
+// half x int4 weights, upconverted to half in registers by the mixed-input mainloop
+
+template<typename LayoutA, typename LayoutB, typename LayoutC,
+  class TileShape, class TiledMma, class GmemTiledCopyA, class GmemTiledCopyB, Scheduler TileScheduler,
+  class KernelSchedule>
+struct GemmConfiguration<
+      arch::IntelPVC,
+      half_t, LayoutA,
+      int4b_t, LayoutB,
+      float, LayoutC,
+      float, TileShape, TiledMma,
+      GmemTiledCopyA, GmemTiledCopyB, TileScheduler, KernelSchedule> {
+  static_assert(TileScheduler == Scheduler::Gemm, "The mixed-input mainloop only runs on the basic Xe GEMM kernel.");
+
+  // Mainloop
+  using CollectiveMainloop = collective::CollectiveMma<
+    MainloopIntelPVCMixedPrecision<3>, TileShape,
+    half_t, TagToStrideA_t<LayoutA>,
+    int4b_t, TagToStrideB_t<LayoutB>,
+    TiledMma,
+    GmemTiledCopyA, void, void, identity, // A
+    GmemTiledCopyB, void, void, identity // B
+  >;
+
+  // Epilogue
+  using EpilogueDispatchPolicy = epilogue::IntelPVCEpilogue;
+  using EpilogueOp = epilogue::fusion::LinearCombination<float, float, float, float, FloatRoundStyle::round_to_nearest>;
+  using FusionCallBacks = epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+
+  using CollectiveEpilogue = epilogue::collective::CollectiveEpilogue<
+        EpilogueDispatchPolicy,
+        TileShape,
+        float,
+        TagToStrideC_t<LayoutC>,
+        float,
+        TagToStrideC_t<LayoutC>,
+        FusionCallBacks,
+        XE_2D_U32x8x16_LD_N,
+        void, void,
+        XE_2D_U32x8x16_ST_N,
+        void, void>;
+
+  using GemmKernel = kernel::GemmUniversal<
+    Shape<int, int, int, int>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+  >;
+
+  using Gemm = GemmUniversalAdapter<GemmKernel>;
+
+  constexpr static typename GemmKernel::Arguments defaultArguments() {
+    return {};
   }
 };
 
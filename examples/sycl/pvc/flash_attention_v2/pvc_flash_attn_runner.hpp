@@ -32,6 +32,7 @@
 
 #include "cutlass/epilogue/collective/default_epilogue.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "flash_attention_v2/collective/fmha_fusion.hpp"
 #include "flash_attention_v2/kernel/xe_flash_attn_gemm.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_epilogue.hpp"
 #include "flash_attention_v2/collective/xe_flash_attn_softmax_epilogue.hpp"
@@ -39,6 +40,8 @@
 #include "cutlass/util/sycl_event_manager.hpp"
 
 #include <cute/tensor.hpp>
+#include <algorithm>
+#include <numeric>
 #include <random>
 
 #include "cutlass/util/command_line.h"
@@ -56,13 +59,14 @@ struct Options {
   bool help;
   bool error;
   bool is_causal;
+  bool varlen;
 
-  int batch, num_heads, seq_len, head_size, iterations;
+  int batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size, num_kv_splits, page_size, iterations;
   float softmax_scale;
 
   Options()
-      : help(false), error(false), is_causal(false), batch(32), num_heads(16), seq_len(512), head_size(128),
-        iterations(100), softmax_scale(1.f) {}
+      : help(false), error(false), is_causal(false), varlen(false), batch(32), num_heads(16), num_heads_kv(16),
+        seq_len_qo(512), seq_len_kv(512), head_size(128), num_kv_splits(1), page_size(0), iterations(100), softmax_scale(1.f) {}
 
   // Parses the command line
   void parse(int argc, char const **args) {
@@ -77,10 +81,20 @@ struct Options {
       is_causal = true;
     }
 
+    if (cmd.check_cmd_line_flag("varlen")) {
+      varlen = true;
+    }
+
     cmd.get_cmd_line_argument("batch", batch, 32);
     cmd.get_cmd_line_argument("num_heads", num_heads, 16);
+    cmd.get_cmd_line_argument("num_heads_kv", num_heads_kv, num_heads);
+    int seq_len;
     cmd.get_cmd_line_argument("seq_len", seq_len, 512);
+    cmd.get_cmd_line_argument("seq_len_qo", seq_len_qo, seq_len);
+    cmd.get_cmd_line_argument("seq_len_kv", seq_len_kv, seq_len);
     cmd.get_cmd_line_argument("head_size", head_size, 128);
+    cmd.get_cmd_line_argument("num_kv_splits", num_kv_splits, 1);
+    cmd.get_cmd_line_argument("page_size", page_size, 0);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
 
     softmax_scale = 1 / sqrt(static_cast<float>(head_size));
@@ -93,10 +107,16 @@ struct Options {
         << "Options:\n\n"
         << "  --help                      If specified, displays this usage statement\n\n"
         << "  --is_causal                 Apply Causal Mask to the output of first Matmul\n"
+        << "  --varlen                    Draw random sequence lengths in [1, seq_len_qo/kv] for each batch entry\n"
         << "  --batch=<int>               Sets the Batch Size of the Multi-Head Self Attention module\n"
         << "  --num_heads=<int>           Sets the Number of Attention Heads of the Multi-Head Self Attention module\n"
-        << "  --seq_len=<int>             Sets the Sequence length of the Multi-Head Self Attention module\n"
+        << "  --num_heads_kv=<int>        Sets the Number of Key/Value Heads, shared by groups of query heads (GQA/MQA)\n"
+        << "  --seq_len=<int>             Sets both the Query and the Key/Value Sequence lengths\n"
+        << "  --seq_len_qo=<int>          Sets the Query Sequence length of the Multi-Head Self Attention module\n"
+        << "  --seq_len_kv=<int>          Sets the Key/Value Sequence length of the Multi-Head Self Attention module\n"
         << "  --head_size=<int>           Sets the Attention Head dimension of the Multi-Head Self Attention module\n"
+        << "  --num_kv_splits=<int>       Splits the Key/Value sequence across this many workgroups (flash-decoding)\n"
+        << "  --page_size=<int>           Reads K/V from a paged cache with pages of this many tokens (multiple of 64)\n"
         << "  --iterations=<int>          Iterations\n\n";
 
     return out;
@@ -128,6 +148,7 @@ template <class GemmKernel> struct ExampleRunner {
   using ElementAccumulator = typename CollectiveEpilogue::ElementAccumulator;
 
   using ProblemShapeType = typename GemmKernel::ProblemShape;
+  static constexpr bool isVarLen = GemmKernel::is_var_len;
 
   //
   // Data members
@@ -146,120 +167,151 @@ template <class GemmKernel> struct ExampleRunner {
   cutlass::DeviceAllocation<ElementOutput> block_O;
   cutlass::DeviceAllocation<ElementOutput> block_ref_O;
 
+  // Paged copies of K and V, only used when page_size is set
+  StrideK stride_K_cache;
+  StrideV stride_V_cache;
+  int num_pages_per_seq = 0;
+  int num_pages = 0;
+  cutlass::DeviceAllocation<ElementK> block_K_cache;
+  cutlass::DeviceAllocation<ElementV> block_V_cache;
+  cutlass::DeviceAllocation<int> block_page_table;
+
+  // Cumulative sequence lengths, only used for variable length problems
+  std::vector<int> cumulative_seqlen_qo;
+  std::vector<int> cumulative_seqlen_kv;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_qo;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_kv;
+
   //
   // Methods
   //
 
-  bool verify(const ProblemShapeType &problem_size, bool is_causal) {
-    auto [batch, num_heads, seq_len, head_size] = problem_size;
+  int sequence_length(std::vector<int> const &cumulative_seqlen, int seq_len, int batch_coord) const {
+    if constexpr (isVarLen) {
+      return cumulative_seqlen[batch_coord + 1] - cumulative_seqlen[batch_coord];
+    } else {
+      return seq_len;
+    }
+  }
 
-    int batch_size = batch * num_heads;
+  bool verify(const ProblemShapeType &problem_size, bool is_causal) {
+    auto [batch, num_heads, num_heads_kv, max_seq_len_qo, max_seq_len_kv, head_size] = problem_size;
+    int group_size = num_heads / num_heads_kv;
 
     // loop over the batch dimension to compute the output
     // to avoid the risk of running out of device memory
-    for (int b = 0, offset = 0; b < batch_size; b++, offset += seq_len * head_size) {
-
-      cutlass::DeviceAllocation<ElementOutput> block_S;
-      block_S.reset(seq_len * seq_len);
-
-      cutlass::TensorRef ref_Q(block_Q.get() + offset, LayoutQ::packed({seq_len, head_size}));
-      cutlass::TensorRef ref_K(block_K.get() + offset, LayoutK::packed({head_size, seq_len}));
-      cutlass::TensorRef ref_V(block_V.get() + offset, LayoutV::packed({seq_len, head_size}));
-      cutlass::TensorRef ref_S(block_S.get(), LayoutQ::packed({seq_len, seq_len}));
-      cutlass::TensorRef ref_O(block_ref_O.get() + offset, LayoutO::packed({seq_len, head_size}));
-
-      cutlass::reference::device::GemmComplex({seq_len, seq_len, head_size}, 1.f, ref_Q,
-                                              cutlass::ComplexTransform::kNone, ref_K, cutlass::ComplexTransform::kNone,
-                                              0.f, ref_S, ref_S, ElementAccumulator(0),
-                                              1,                   // batch_count
-                                              seq_len * head_size, // batch_stride_Q
-                                              seq_len * head_size, // batch_stride_K
-                                              seq_len * seq_len,   // batch_stride_S
-                                              seq_len * seq_len    // batch_stride_S
-      );
-
-      syclcompat::wait();
-
-      std::vector<ElementOutput> host_S(seq_len * seq_len);
-      syclcompat::memcpy<ElementOutput>(host_S.data(), block_S.get(), host_S.size());
-      syclcompat::wait();
-
-      // delete this memory as it is no longer needed
-      block_S.reset();
-
-      if (is_causal) {
-        // apply mask to S
-        for (int row = 0; row < seq_len; row++) {
-          for (int col = 0; col < seq_len; col++) {
-            if (col > row)
-              host_S[col + row * seq_len] = -INFINITY;
+    int offset_qo = 0, offset_kv_batch = 0;
+    for (int b = 0; b < batch; b++) {
+      int seq_len_qo = sequence_length(cumulative_seqlen_qo, max_seq_len_qo, b);
+      int seq_len_kv = sequence_length(cumulative_seqlen_kv, max_seq_len_kv, b);
+      for (int h = 0; h < num_heads; h++, offset_qo += seq_len_qo * head_size) {
+        // query head h reads KV head h / group_size
+        int offset_kv = offset_kv_batch + (h / group_size) * seq_len_kv * head_size;
+
+        cutlass::DeviceAllocation<ElementOutput> block_S;
+        block_S.reset(seq_len_qo * seq_len_kv);
+
+        cutlass::TensorRef ref_Q(block_Q.get() + offset_qo, LayoutQ::packed({seq_len_qo, head_size}));
+        cutlass::TensorRef ref_K(block_K.get() + offset_kv, LayoutK::packed({head_size, seq_len_kv}));
+        cutlass::TensorRef ref_V(block_V.get() + offset_kv, LayoutV::packed({seq_len_kv, head_size}));
+        cutlass::TensorRef ref_S(block_S.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
+        cutlass::TensorRef ref_O(block_ref_O.get() + offset_qo, LayoutO::packed({seq_len_qo, head_size}));
+
+        cutlass::reference::device::GemmComplex({seq_len_qo, seq_len_kv, head_size}, 1.f, ref_Q,
+                                                cutlass::ComplexTransform::kNone, ref_K, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_S, ref_S, ElementAccumulator(0),
+                                                1,                      // batch_count
+                                                seq_len_qo * head_size, // batch_stride_Q
+                                                seq_len_kv * head_size, // batch_stride_K
+                                                seq_len_qo * seq_len_kv, // batch_stride_S
+                                                seq_len_qo * seq_len_kv  // batch_stride_S
+        );
+
+        syclcompat::wait();
+
+        std::vector<ElementOutput> host_S(seq_len_qo * seq_len_kv);
+        syclcompat::memcpy<ElementOutput>(host_S.data(), block_S.get(), host_S.size());
+        syclcompat::wait();
+
+        // delete this memory as it is no longer needed
+        block_S.reset();
+
+        if (is_causal) {
+          // apply mask to S, aligned to the bottom right corner
+          int causal_offset = seq_len_kv - seq_len_qo;
+          for (int row = 0; row < seq_len_qo; row++) {
+            for (int col = 0; col < seq_len_kv; col++) {
+              if (col > row + causal_offset)
+                host_S[col + row * seq_len_kv] = -INFINITY;
+            }
           }
         }
-      }
 
-      // compute max element per row of S
-      std::vector<ElementOutput> max_vec(seq_len, -INFINITY);
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int max_idx = row;
-        max_vec[max_idx] = host_S[idx++];
-        for (int col = 1; col < seq_len; col++, idx++) {
-          if (max_vec[max_idx] < host_S[idx])
-            max_vec[max_idx] = host_S[idx];
+        // compute max element per row of S
+        std::vector<ElementOutput> max_vec(seq_len_qo, -INFINITY);
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int max_idx = row;
+          max_vec[max_idx] = host_S[idx++];
+          for (int col = 1; col < seq_len_kv; col++, idx++) {
+            if (max_vec[max_idx] < host_S[idx])
+              max_vec[max_idx] = host_S[idx];
+          }
         }
-      }
 
-      // compute exp of S
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int max_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          host_S[idx] = expf((host_S[idx] - max_vec[max_idx]) / sqrt(static_cast<ElementOutput>((head_size))));
+        // compute exp of S
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int max_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            host_S[idx] = expf((host_S[idx] - max_vec[max_idx]) / sqrt(static_cast<ElementOutput>((head_size))));
+          }
         }
-      }
 
-      // compute sum per row of S
-      std::vector<ElementOutput> sum_vec(seq_len, ElementOutput{0});
-      for (int row = 0; row < seq_len; row++) {
-        int idx = row * seq_len;
-        int sum_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          sum_vec[sum_idx] += host_S[idx];
-        }
+        // compute sum per row of S
+        std::vector<ElementOutput> sum_vec(seq_len_qo, ElementOutput{0});
+        for (int row = 0; row < seq_len_qo; row++) {
+          int idx = row * seq_len_kv;
+          int sum_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            sum_vec[sum_idx] += host_S[idx];
+          }
 
-        // scale each row with the sum to compute softmax
-        idx = row * seq_len;
-        sum_idx = row;
-        for (int col = 0; col < seq_len; col++, idx++) {
-          host_S[idx] /= sum_vec[sum_idx];
+          // scale each row with the sum to compute softmax
+          idx = row * seq_len_kv;
+          sum_idx = row;
+          for (int col = 0; col < seq_len_kv; col++, idx++) {
+            host_S[idx] /= sum_vec[sum_idx];
+          }
         }
-      }
 
-      std::vector<ElementV> host_P(host_S.size());
-      for (int p = 0; p < host_P.size(); p++)
-        host_P[p] = static_cast<ElementV>(host_S[p]);
+        std::vector<ElementV> host_P(host_S.size());
+        for (int p = 0; p < host_P.size(); p++)
+          host_P[p] = static_cast<ElementV>(host_S[p]);
 
-      cutlass::DeviceAllocation<ElementV> block_P;
-      block_P.reset(host_P.size());
+        cutlass::DeviceAllocation<ElementV> block_P;
+        block_P.reset(host_P.size());
 
-      syclcompat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
-      syclcompat::wait();
+        syclcompat::memcpy<ElementV>(block_P.get(), host_P.data(), host_P.size());
+        syclcompat::wait();
 
-      cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len, seq_len}));
+        cutlass::TensorRef ref_P(block_P.get(), LayoutQ::packed({seq_len_qo, seq_len_kv}));
 
-      cutlass::reference::device::GemmComplex({seq_len, head_size, seq_len}, 1.f, ref_P,
-                                              cutlass::ComplexTransform::kNone, ref_V, cutlass::ComplexTransform::kNone,
-                                              0.f, ref_O, ref_O, ElementAccumulator(0),
-                                              1,                   // batch_count
-                                              seq_len * seq_len,   // batch_stride_P
-                                              seq_len * head_size, // batch_stride_V
-                                              seq_len * head_size, // batch_stride_O
-                                              seq_len * head_size  // batch_stride_O
-      );
+        cutlass::reference::device::GemmComplex({seq_len_qo, head_size, seq_len_kv}, 1.f, ref_P,
+                                                cutlass::ComplexTransform::kNone, ref_V, cutlass::ComplexTransform::kNone,
+                                                0.f, ref_O, ref_O, ElementAccumulator(0),
+                                                1,                       // batch_count
+                                                seq_len_qo * seq_len_kv, // batch_stride_P
+                                                seq_len_kv * head_size,  // batch_stride_V
+                                                seq_len_qo * head_size,  // batch_stride_O
+                                                seq_len_qo * head_size   // batch_stride_O
+        );
 
-      syclcompat::wait();
-      // delete this memory as it is no longer needed
-      block_P.reset();
+        syclcompat::wait();
+        // delete this memory as it is no longer needed
+        block_P.reset();
+      }
+      offset_kv_batch += num_heads_kv * seq_len_kv * head_size;
     }
 
     syclcompat::wait();
@@ -272,25 +324,124 @@ template <class GemmKernel> struct ExampleRunner {
   }
 
   /// Initialize operands to be used in the GEMM and reference GEMM
-  void initialize(const ProblemShapeType &problem_size) {
-    // auto problem_shape = cute::append<4>(problem_size, 1);
-    auto [batch, num_heads, seq_len, head_size] = problem_size;
-
-    stride_Q = cutlass::make_cute_packed_stride(StrideQ{}, cute::make_shape(seq_len, head_size, batch * num_heads));
-    stride_K = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(seq_len, head_size, batch * num_heads));
-    stride_V = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size, seq_len, batch * num_heads));
-    stride_O = cutlass::make_cute_packed_stride(StrideO{}, cute::make_shape(seq_len, head_size, batch * num_heads));
-
-    auto count = batch * num_heads * seq_len * head_size;
-    block_Q.reset(count);
-    block_K.reset(count);
-    block_V.reset(count);
-    block_O.reset(count);
-    block_ref_O.reset(count);
+  ProblemShapeType initialize(const Options &options) {
+    int batch = options.batch;
+    int num_heads = options.num_heads;
+    int num_heads_kv = options.num_heads_kv;
+    int seq_len_qo = options.seq_len_qo;
+    int seq_len_kv = options.seq_len_kv;
+    int head_size = options.head_size;
+
+    ProblemShapeType problem_size;
+    int total_seq_len_qo = batch * seq_len_qo;
+    int total_seq_len_kv = batch * seq_len_kv;
+    if constexpr (isVarLen) {
+      std::mt19937 rng(seed);
+      std::uniform_int_distribution<int> dist_qo(1, seq_len_qo);
+      std::uniform_int_distribution<int> dist_kv(1, seq_len_kv);
+      cumulative_seqlen_qo.assign(1, 0);
+      cumulative_seqlen_kv.assign(1, 0);
+      for (int b = 0; b < batch; b++) {
+        int len_qo = dist_qo(rng);
+        int len_kv = dist_kv(rng);
+        // every query needs at least one key under the causal mask
+        if (options.is_causal) {
+          len_kv = std::max(len_kv, len_qo);
+        }
+        cumulative_seqlen_qo.push_back(cumulative_seqlen_qo.back() + len_qo);
+        cumulative_seqlen_kv.push_back(cumulative_seqlen_kv.back() + len_kv);
+      }
+      total_seq_len_qo = cumulative_seqlen_qo.back();
+      total_seq_len_kv = cumulative_seqlen_kv.back();
+      if (options.is_causal) {
+        seq_len_kv = std::max(seq_len_kv, seq_len_qo);
+      }
+
+      device_cumulative_seqlen_qo.reset(cumulative_seqlen_qo.size());
+      device_cumulative_seqlen_qo.copy_from_host(cumulative_seqlen_qo.data(), cumulative_seqlen_qo.size());
+      device_cumulative_seqlen_kv.reset(cumulative_seqlen_kv.size());
+      device_cumulative_seqlen_kv.copy_from_host(cumulative_seqlen_kv.data(), cumulative_seqlen_kv.size());
+
+      problem_size = ProblemShapeType{
+          batch, num_heads, num_heads_kv,
+          cutlass::fmha::collective::VariableLength{seq_len_qo, device_cumulative_seqlen_qo.get()},
+          cutlass::fmha::collective::VariableLength{seq_len_kv, device_cumulative_seqlen_kv.get()},
+          head_size};
+    } else {
+      problem_size = ProblemShapeType{batch, num_heads, num_heads_kv, seq_len_qo, seq_len_kv, head_size};
+    }
+
+    stride_Q = cutlass::make_cute_packed_stride(StrideQ{}, cute::make_shape(seq_len_qo, head_size, batch * num_heads));
+    stride_K = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(seq_len_kv, head_size, batch * num_heads_kv));
+    stride_V = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size, seq_len_kv, batch * num_heads_kv));
+    stride_O = cutlass::make_cute_packed_stride(StrideO{}, cute::make_shape(seq_len_qo, head_size, batch * num_heads));
+
+    block_Q.reset(total_seq_len_qo * num_heads * head_size);
+    block_K.reset(total_seq_len_kv * num_heads_kv * head_size);
+    block_V.reset(total_seq_len_kv * num_heads_kv * head_size);
+    block_O.reset(total_seq_len_qo * num_heads * head_size);
+    block_ref_O.reset(total_seq_len_qo * num_heads * head_size);
 
     initialize_block(block_Q, seed + 2023);
     initialize_block(block_K, seed + 2022); // assume K is already transposed
     initialize_block(block_V, seed + 2021);
+
+    if (options.page_size > 0) {
+      initialize_paged_kv_cache(options, seq_len_kv);
+    }
+
+    return problem_size;
+  }
+
+  /// Scatters the dense K and V into a [num_pages, num_heads_kv, page_size, head_size] cache through a shuffled
+  /// page table, so that the reference can keep using the dense copies
+  void initialize_paged_kv_cache(const Options &options, int max_seq_len_kv) {
+    int batch = options.batch;
+    int num_heads_kv = options.num_heads_kv;
+    int head_size = options.head_size;
+    int page_size = options.page_size;
+
+    num_pages_per_seq = cute::ceil_div(max_seq_len_kv, page_size);
+    num_pages = batch * num_pages_per_seq;
+
+    std::vector<int> page_table(num_pages);
+    std::iota(page_table.begin(), page_table.end(), 0);
+    std::shuffle(page_table.begin(), page_table.end(), std::mt19937(seed));
+
+    std::vector<ElementK> host_K(block_K.size());
+    std::vector<ElementV> host_V(block_V.size());
+    block_K.copy_to_host(host_K.data());
+    block_V.copy_to_host(host_V.data());
+
+    // Unused page slots stay zero, the kernel masks them out
+    size_t cache_size = static_cast<size_t>(num_pages) * num_heads_kv * page_size * head_size;
+    std::vector<ElementK> host_K_cache(cache_size, ElementK{0});
+    std::vector<ElementV> host_V_cache(cache_size, ElementV{0});
+
+    int offset_kv = 0;
+    for (int b = 0; b < batch; b++) {
+      int seq_len_kv = sequence_length(cumulative_seqlen_kv, max_seq_len_kv, b);
+      for (int h = 0; h < num_heads_kv; h++) {
+        for (int token = 0; token < seq_len_kv; token++) {
+          int page = page_table[b * num_pages_per_seq + token / page_size];
+          size_t src = static_cast<size_t>(offset_kv) + static_cast<size_t>(h * seq_len_kv + token) * head_size;
+          size_t dst = ((static_cast<size_t>(page) * num_heads_kv + h) * page_size + token % page_size) * head_size;
+          std::copy_n(host_K.begin() + src, head_size, host_K_cache.begin() + dst);
+          std::copy_n(host_V.begin() + src, head_size, host_V_cache.begin() + dst);
+        }
+      }
+      offset_kv += seq_len_kv * num_heads_kv * head_size;
+    }
+
+    block_K_cache.reset(cache_size);
+    block_V_cache.reset(cache_size);
+    block_page_table.reset(page_table.size());
+    block_K_cache.copy_from_host(host_K_cache.data(), cache_size);
+    block_V_cache.copy_from_host(host_V_cache.data(), cache_size);
+    block_page_table.copy_from_host(page_table.data(), page_table.size());
+
+    stride_K_cache = cutlass::make_cute_packed_stride(StrideK{}, cute::make_shape(page_size, head_size, num_pages * num_heads_kv));
+    stride_V_cache = cutlass::make_cute_packed_stride(StrideV{}, cute::make_shape(head_size, page_size, num_pages * num_heads_kv));
   }
 
   static void run(typename GemmKernel::Params params) {
@@ -313,10 +464,7 @@ template <class GemmKernel> struct ExampleRunner {
   }
 
   void run(const Options &options, const cutlass::KernelHardwareInfo &hw_info) {
-    ProblemShapeType problem_size =
-        ProblemShapeType{options.batch, options.num_heads, options.seq_len, options.head_size};
-
-    initialize(problem_size);
+    ProblemShapeType problem_size = initialize(options);
 
     typename GemmKernel::Arguments arguments{
         cutlass::gemm::GemmUniversalMode::kGemm,
@@ -325,13 +473,23 @@ template <class GemmKernel> struct ExampleRunner {
         {options.softmax_scale},
         {block_O.get(), stride_O},
         hw_info};
+    arguments.num_kv_splits = options.num_kv_splits;
+    if (options.page_size > 0) {
+      arguments.mainloop = {block_Q.get(), stride_Q, block_K_cache.get(), stride_K_cache, block_V_cache.get(),
+                            stride_V_cache, block_page_table.get(), options.page_size, num_pages_per_seq, num_pages};
+    }
 
     // GemmKernel gemm_op;
 
     size_t workspace_size = GemmKernel::get_workspace_size(arguments);
     cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
 
-    GemmKernel::can_implement(arguments);
+    if (!GemmKernel::can_implement(arguments)) {
+      std::cout << "Invalid Problem Size: " << options.batch << 'x' << options.num_heads << 'x' << options.num_heads_kv
+                << 'x' << options.seq_len_qo
+                << 'x' << options.seq_len_kv << 'x' << options.head_size << std::endl;
+      return;
+    }
 
     // Initialize the workspace
     auto status = GemmKernel::initialize_workspace(arguments, workspace.get());
@@ -359,14 +517,27 @@ template <class GemmKernel> struct ExampleRunner {
       syclcompat::wait();
 
       double cute_time = timer.seconds() / options.iterations;
-      double flops_qk = 2.0 * options.batch * options.num_heads * options.seq_len * options.seq_len * options.head_size;
-      double flops_pv = 2.0 * options.batch * options.num_heads * options.seq_len * options.head_size * options.seq_len;
+      double seq_len_qk = 0.0, seq_len_qo_sum = 0.0, seq_len_kv_sum = 0.0;
+      for (int b = 0; b < options.batch; b++) {
+        double seq_len_qo = sequence_length(cumulative_seqlen_qo, options.seq_len_qo, b);
+        double seq_len_kv = sequence_length(cumulative_seqlen_kv, options.seq_len_kv, b);
+        seq_len_qk += seq_len_qo * seq_len_kv;
+        seq_len_qo_sum += seq_len_qo;
+        seq_len_kv_sum += seq_len_kv;
+      }
+      double flops_qk = 2.0 * options.num_heads * seq_len_qk * options.head_size;
+      double flops_pv = 2.0 * options.num_heads * seq_len_qk * options.head_size;
       double tflops = ((flops_qk + flops_pv) * 1e-12) / cute_time;
-      double gbps_qk = 2.0 * options.batch * options.num_heads * (options.seq_len * options.head_size + options.seq_len * options.head_size);
-      double gbps_pv = 2.0 * options.batch * options.num_heads * (options.seq_len * options.head_size + options.seq_len * options.head_size);
+      double gbps_qk = 2.0 * (options.num_heads * seq_len_qo_sum + options.num_heads_kv * seq_len_kv_sum) * options.head_size;
+      double gbps_pv = 2.0 * (options.num_heads_kv * seq_len_kv_sum + options.num_heads * seq_len_qo_sum) * options.head_size;
       double gbps = ((gbps_qk + gbps_pv)  * 1e-9) / (cute_time);
-      std::cout << "Problem Size: " << options.batch << 'x' << options.num_heads << 'x' << options.seq_len << 'x'
-                << options.head_size << (options.is_causal ? "xCausal" : "xNonCausal");
+      std::cout << "Problem Size: " << options.batch << 'x' << options.num_heads << 'x' << options.num_heads_kv << 'x'
+                << options.seq_len_qo << 'x'
+                << options.seq_len_kv << 'x'
+                << options.head_size << (options.is_causal ? "xCausal" : "xNonCausal")
+                << (isVarLen ? "xVarLen" : "")
+                << (options.num_kv_splits > 1 ? "xSplitKV" + std::to_string(options.num_kv_splits) : std::string())
+                << (options.page_size > 0 ? "xPaged" + std::to_string(options.page_size) : std::string());
       printf(":   %4.3f  GB/s   ,    %4.3f  TFlop/s   ,   %6.4f  ms\n", gbps, tflops, cute_time * 1000);
     }
 
@@ -374,7 +545,7 @@ template <class GemmKernel> struct ExampleRunner {
   }
 };
 
-template <bool Causal, typename TileShape, typename TiledMma> struct FMHAConfig {
+template <bool Causal, bool isVarLen, typename TileShape, typename TiledMma> struct FMHAConfig {
   static int run(const Options &options) {
 
     //
@@ -415,7 +586,11 @@ template <bool Causal, typename TileShape, typename TiledMma> struct FMHAConfig
         GmemTiledCopyV, // V,
         Causal>;
 
-    using GemmKernel = cutlass::gemm::kernel::GemmUniversalAttention<Shape<int, int, int, int>, CollectiveMainloop,
+    using ProblemShape = cute::conditional_t<isVarLen,
+                                             cute::tuple<int, int, int, cutlass::fmha::collective::VariableLength,
+                                                         cutlass::fmha::collective::VariableLength, int>,
+                                             Shape<int, int, int, int, int, int>>;
+    using GemmKernel = cutlass::gemm::kernel::GemmUniversalAttention<ProblemShape, CollectiveMainloop,
                                                                      CollectiveSoftmaxEpilogue, CollectiveEpilogue>;
 
     ExampleRunner<GemmKernel> runner;
@@ -424,3 +599,12 @@ template <bool Causal, typename TileShape, typename TiledMma> struct FMHAConfig
     return 0;
   }
 };
+
+template <typename TileShape, typename TiledMma> int run_fmha(const Options &options) {
+  if (options.is_causal) {
+    return options.varlen ? FMHAConfig<true, true, TileShape, TiledMma>::run(options)
+                          : FMHAConfig<true, false, TileShape, TiledMma>::run(options);
+  }
+  return options.varlen ? FMHAConfig<false, true, TileShape, TiledMma>::run(options)
+                        : FMHAConfig<false, false, TileShape, TiledMma>::run(options);
+}
@@ -59,12 +59,14 @@ struct Options {
   bool error;
 
   int m, n, k, l, iterations;
+  int mode, g;
   float alpha, beta;
 
   Options():
     help(false),
     error(false),
     m(5120), n(4096), k(4096), l(1), iterations(20),
+    mode(0), g(128),
     alpha(1.f), beta(0.f)
   { }
 
@@ -84,6 +86,12 @@ struct Options {
     cmd.get_cmd_line_argument("alpha", alpha, 1.f);
     cmd.get_cmd_line_argument("beta", beta, 0.f);
     cmd.get_cmd_line_argument("iterations", iterations, 100);
+    cmd.get_cmd_line_argument("mode", mode, 0);
+    cmd.get_cmd_line_argument("g", g, 128);
+
+    if (mode < 0 || mode > 2) {
+      error = true;
+    }
   }
 
   /// Prints the usage statement.
@@ -98,6 +106,10 @@ struct Options {
       << "  --l=<int>                   Sets the L extent (batch count) of the GEMM\n"
       << "  --alpha=<s32>               Epilogue scalar alpha\n"
       << "  --beta=<s32>                Epilogue scalar beta\n\n"
+      << "  --mode=<int>                The mode to run the gemm. 0 does (A @ B), 1 means A is scaled group-wise\n"
+      << "                              ((scale * A) @ B), 2 means A is scaled and shifted ((scale * A + zero) @ B)\n"
+      << "  --g=<int>                   The size of the groups along K that share a scale (and zero). Must be K\n"
+      << "                              or a multiple of the tile K\n\n"
       << "  --iterations=<int>          Iterations\n\n";
 
     return out;
@@ -135,6 +147,12 @@ struct ExampleRunner {
 
   using TiledMma = typename Gemm::CollectiveMainloop::TiledMma;
 
+  using CollectiveMainloop = typename Gemm::CollectiveMainloop;
+  using ElementScale = typename CollectiveMainloop::NonVoidElementScale;
+  using ElementZero = typename CollectiveMainloop::NonVoidElementZero;
+  using StrideScale = typename CollectiveMainloop::StrideScale;
+  static constexpr auto KernelConversionMode = CollectiveMainloop::KernelConversionMode;
+
   //
   // Data members
   //
@@ -144,6 +162,7 @@ struct ExampleRunner {
   StrideB stride_B;
   StrideC stride_C;
   StrideD stride_D;
+  StrideScale stride_S;
   uint64_t seed = 0;
 
   cutlass::DeviceAllocation<ElementA> block_A;
@@ -153,6 +172,8 @@ struct ExampleRunner {
   cutlass::DeviceAllocation<ElementC> block_C;
   cutlass::DeviceAllocation<ElementOutput> block_D;
   cutlass::DeviceAllocation<ElementOutput> block_ref_D;
+  cutlass::DeviceAllocation<ElementScale> block_scale;
+  cutlass::DeviceAllocation<ElementZero> block_zero;
 
   //
   // Methods
@@ -238,6 +259,55 @@ struct ExampleRunner {
     return passed;
   }
 
+  /// Generates the group-wise scales (and zeros) of A and applies them to the dequantized copy of A used
+  /// by the reference GEMM. Scales are powers of two and zeros small integers, so that the dequantized values
+  /// are exactly representable and the kernel and reference agree bit for bit on the inputs.
+  void initialize_scales(const Options& options) {
+    int M = options.m, K = options.k, L = options.l;
+    int scale_k = cute::ceil_div(K, options.g);
+
+    stride_S = cutlass::make_cute_packed_stride(StrideScale{}, cute::make_shape(M, scale_k, L));
+
+    std::ranlux24_base rng(seed + 2020);
+    std::uniform_int_distribution<> scale_dist(-2, 1);
+    std::uniform_int_distribution<> zero_dist(-2, 2);
+
+    std::vector<ElementScale> scale_host(M * scale_k * L);
+    std::vector<ElementZero> zero_host(M * scale_k * L, ElementZero(0));
+    for (size_t i = 0; i < scale_host.size(); ++i) {
+      scale_host[i] = static_cast<ElementScale>(std::ldexp(1.f, scale_dist(rng)));
+      if constexpr (KernelConversionMode == CollectiveMainloop::ConversionMode::ConvertAndScaleWithZero) {
+        zero_host[i] = static_cast<ElementZero>(zero_dist(rng));
+      }
+    }
+
+    using ElementMma = typename TiledMma::ValTypeA;
+    std::vector<ElementMma> A_dq_host(block_A_dq.size());
+    block_A_dq.copy_to_host(A_dq_host.data());
+    for (int l = 0; l < L; ++l) {
+      for (int m = 0; m < M; ++m) {
+        for (int k = 0; k < K; ++k) {
+          // A is row-major, the scales are M-major with one column per group
+          int64_t a_idx = int64_t(l) * M * K + int64_t(m) * K + k;
+          int64_t s_idx = int64_t(l) * M * scale_k + int64_t(k / options.g) * M + m;
+          ElementScale value = static_cast<ElementScale>(A_dq_host[a_idx]) * scale_host[s_idx];
+          if constexpr (KernelConversionMode == CollectiveMainloop::ConversionMode::ConvertAndScaleWithZero) {
+            value = value + zero_host[s_idx];
+          }
+          A_dq_host[a_idx] = static_cast<ElementMma>(value);
+        }
+      }
+    }
+    block_A_dq.copy_from_host(A_dq_host.data());
+
+    block_scale.reset(scale_host.size());
+    block_scale.copy_from_host(scale_host.data());
+    if constexpr (KernelConversionMode == CollectiveMainloop::ConversionMode::ConvertAndScaleWithZero) {
+      block_zero.reset(zero_host.size());
+      block_zero.copy_from_host(zero_host.data());
+    }
+  }
+
   /// Initialize operands to be used in the GEMM and reference GEMM
   void initialize(const ProblemShapeType& problem_size) {
     auto problem_shape_MNKL = cute::append<4>(problem_size, 1);
@@ -265,11 +335,14 @@ struct ExampleRunner {
     ProblemShapeType problem_size = ProblemShapeType{options.m, options.n, options.k, options.l};
 
     initialize(problem_size);
+    if constexpr (CollectiveMainloop::ModeHasScales) {
+      initialize_scales(options);
+    }
 
     typename Gemm::GemmKernel::Arguments arguments{
       cutlass::gemm::GemmUniversalMode::kGemm,
       problem_size,
-      {block_A.get(), stride_A, block_B.get(), stride_B},
+      {block_A.get(), stride_A, block_B.get(), stride_B, block_scale.get(), stride_S, options.g, block_zero.get()},
       {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D},
       hw_info
     };
@@ -316,45 +389,16 @@ struct ExampleRunner {
 
 };
 
-int main(int argc, const char** argv)
+// A is either the narrow input type on its own (the conversion only mode), or a tuple of the narrow input
+// type and the type of its group-wise scales (and zeros).
+template <class ElementAOptionalTuple>
+int launch(const Options& options, const cutlass::KernelHardwareInfo& hw_info)
 {
-  //
-  // Parse options
-  //
-
-  Options options;
-
-  options.parse(argc, argv);
-
-  if (options.help) {
-    options.print_usage(std::cout) << std::endl;
-    return 0;
-  }
-
-  if (options.error) {
-    std::cerr << "Aborting execution." << std::endl;
-    return -1;
-  }
-
-  //
-  // Run examples
-  //
-
-  // The KernelHardwareInfo struct holds the number of EUs on the GPU with a given device ID. This
-  // information is used by the underlying kernel.
-  cutlass::KernelHardwareInfo hw_info;
-
-  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
-  // to use a GPU other than that with device ID 0.
-  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
-
-  bool passed;
-
   // The code section below describes datatype for input, output matrices and computation between
   // elements in input matrices.
   using ElementAccumulator = float;                   // <- data type of accumulator
   using ElementComputeEpilogue = float;               // <- data type of epilogue operations
-  using ElementInputA = cutlass::int8_t;              // <- data type of elements in input matrix A
+  using ElementInputA = cutlass::gemm::collective::detail::deduce_mixed_width_dtype_t<0, ElementAOptionalTuple>;
   using ElementInputB = bfloat16_t;                   // <- data type of elements in input matrix B
   using ElementOutput = float;                        // <- data type of elements in output matrix D
 
@@ -403,7 +447,7 @@ int main(int argc, const char** argv)
   using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
           GEMMDispatchPolicy,
           TileShape,
-          ElementInputA,
+          ElementAOptionalTuple,
           cutlass::gemm::TagToStrideA_t<LayoutA>,
           ElementInputB,
           cutlass::gemm::TagToStrideB_t<LayoutB>,
@@ -426,3 +470,51 @@ int main(int argc, const char** argv)
 
   return 0;
 }
+
+int main(int argc, const char** argv)
+{
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    std::cerr << "Aborting execution." << std::endl;
+    return -1;
+  }
+
+  //
+  // Run examples
+  //
+
+  // The KernelHardwareInfo struct holds the number of EUs on the GPU with a given device ID. This
+  // information is used by the underlying kernel.
+  cutlass::KernelHardwareInfo hw_info;
+
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  // The narrow type of A, and the type of its scales and zeros
+  using ElementInputA = cutlass::int8_t;
+  using ElementScale = bfloat16_t;
+
+  if (options.mode == 1) {
+    std::cout << "Running in ConvertAndScale mode with group size " << options.g << std::endl;
+    return launch<cute::tuple<ElementInputA, ElementScale>>(options, hw_info);
+  }
+  else if (options.mode == 2) {
+    std::cout << "Running in ConvertAndScaleWithZero mode with group size " << options.g << std::endl;
+    return launch<cute::tuple<ElementInputA, ElementScale, ElementScale>>(options, hw_info);
+  }
+  std::cout << "Running in DirectConvert mode" << std::endl;
+  return launch<ElementInputA>(options, hw_info);
+}
@@ -60,4 +60,7 @@ struct CollectiveConv {
 
 #include "sm90_implicit_gemm_gmma_ss_warpspecialized.hpp"
 #include "sm100_implicit_gemm_umma_warpspecialized.hpp" 
+#if defined(SYCL_INTEL_TARGET)
+#include "xe_implicit_gemm_slm.hpp"
+#endif
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,539 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+#include "cutlass/conv/detail.hpp"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/xe_slm_staging.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Implicit GEMM mainloop for Intel PVC. The convolution is linearized as in conv::detail::get_linearized_problem_shape_MNKL,
+// except for dgrad, which is computed as a single GEMM over the whole activation gradient:
+//
+// |     |   Fprop               |   Dgrad                 |   Wgrad               |
+// | --- | --------------------- | ----------------------- | --------------------- |
+// | M   | N * Z * P * Q         | N * D * H * W           | K                     |
+// | N   | K                     | C                       | T * R * S * C         |
+// | K   | T * R * S * C         | T * R * S * K           | N * Z * P * Q         |
+// | A   | im2col(act), K-major  | im2col(xformed), K-major| xformed, M-major      |
+// | B   | flt, K-major          | flt, N-major            | im2col(act), N-major  |
+//
+// The channel modes are innermost, so each operand is gathered in 128-bit vectors along its contiguous mode and
+// a whole vector is either in the image or in the padding. Out of bounds vectors, and for strided dgrad the taps
+// that do not land on an output pixel, are zero filled. The gathered tiles are staged through SLM as in the
+// MainloopIntelPVCSlm GEMM mainloop. TileTraitsA/B are unused: the SLM layouts and copies follow from the tile
+// shape and the majorness of each operand.
+template <
+  conv::Operator ConvOp,
+  int Stages,
+  int NumSpatialDims,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class ElementB_,
+  class TiledMma_,
+  class TileTraitsA_,
+  class TileTraitsB_>
+struct CollectiveConv<
+    MainloopIntelPVCImplicitGemm<ConvOp, Stages, NumSpatialDims, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    ElementB_,
+    TiledMma_,
+    TileTraitsA_,
+    TileTraitsB_>
+{
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCImplicitGemm<ConvOp, Stages, NumSpatialDims, KernelSchedule>;
+  using TileShape = TileShape_;
+  using WorkgroupTileShape = TileShape;
+  using ElementA = ElementA_;
+  using ElementB = ElementB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+  static constexpr int NumSpatialDimensions = DispatchPolicy::NumSpatialDimensions;
+  static constexpr int NumTensorDimensions = NumSpatialDimensions + 2;
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using ProblemShape = ConvProblemShape<ConvOp, NumSpatialDimensions>;
+
+  static_assert(platform::is_same<ElementA, ElementB>::value, "MainloopIntelPVCImplicitGemm requires that A and B have same type.");
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+
+  static constexpr int CopyBits = gemm::collective::detail::XeSlmCopyBits;
+  static constexpr int AlignmentA = CopyBits / sizeof_bits_v<ElementA>;
+  static constexpr int AlignmentB = CopyBits / sizeof_bits_v<ElementB>;
+  static constexpr bool IsKMajorA = ConvOp != conv::Operator::kWgrad;
+  static constexpr bool IsKMajorB = ConvOp == conv::Operator::kFprop;
+
+  using SmemLayoutA = decltype(gemm::collective::detail::make_xe_slm_layout<IsKMajorA, BLK_M, BLK_K, Stages>());
+  using SmemLayoutB = decltype(gemm::collective::detail::make_xe_slm_layout<IsKMajorB, BLK_N, BLK_K, Stages>());
+  using SlmTiledCopyA = decltype(gemm::collective::detail::make_xe_slm_tiled_copy<
+                                   ElementA, IsKMajorA, BLK_M, BLK_K, MaxThreadsPerBlock>());
+  using SlmTiledCopyB = decltype(gemm::collective::detail::make_xe_slm_tiled_copy<
+                                   ElementB, IsKMajorB, BLK_N, BLK_K, MaxThreadsPerBlock>());
+  // Every global load is a gather, so the tiled copies that fill SLM are also the gmem copies
+  using GmemTiledCopyA = SlmTiledCopyA;
+  using GmemTiledCopyB = SlmTiledCopyB;
+
+  // Allocated by the kernel
+  struct SharedStorage {
+    cute::array_aligned<ElementA, cute::cosize_v<SmemLayoutA>> smem_A;
+    cute::array_aligned<ElementB, cute::cosize_v<SmemLayoutB>> smem_B;
+  };
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A{nullptr};
+    ElementB const* ptr_B{nullptr};
+  };
+
+  // Extents, strides and divisors of the activation (act), filter (flt) and output (xformed) tensors, indexed
+  // from the outermost spatial mode, from which the gathers recover tensor coordinates
+  struct Params {
+    ElementA const* ptr_A{nullptr};
+    ElementB const* ptr_B{nullptr};
+    int64_t stride_act[NumTensorDimensions]{};
+    int64_t stride_flt[NumTensorDimensions]{};
+    int64_t stride_xformed[NumTensorDimensions]{};
+    int extent_act[NumSpatialDimensions]{};
+    int extent_flt[NumSpatialDimensions]{};
+    int extent_xformed[NumSpatialDimensions]{};
+    int lower_padding[NumSpatialDimensions]{};
+    int traversal_stride[NumSpatialDimensions]{};
+    int dilation[NumSpatialDimensions]{};
+    FastDivmod divmod_act[NumSpatialDimensions];
+    FastDivmod divmod_flt[NumSpatialDimensions];
+    FastDivmod divmod_xformed[NumSpatialDimensions];
+    FastDivmod divmod_traversal_stride[NumSpatialDimensions];
+    FastDivmod divmod_channels;          // C
+    FastDivmod divmod_filters;           // K
+    bool flip_filter{false};
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveConv() = default;
+
+  // (M,N,K,L) of the linearized GEMM in the table above
+  static constexpr auto
+  get_problem_shape_MNKL(ProblemShape const& problem_shape) {
+    auto const& [shape_act, stride_act] = get_act(problem_shape);
+    auto const& [shape_flt, stride_flt] = get_flt(problem_shape);
+    auto const& [shape_xformed, stride_xformed] = get_xformed(problem_shape);
+    int pixels_act = 1;
+    int pixels_xformed = 1;
+    int taps = 1;
+    for (int i = 0; i < NumTensorDimensions - 1; ++i) {
+      pixels_act *= shape_act[i];
+      pixels_xformed *= shape_xformed[i];
+    }
+    for (int i = 1; i < NumTensorDimensions - 1; ++i) {
+      taps *= shape_flt[i];
+    }
+    int channels = shape_act[NumTensorDimensions - 1];
+    int filters = shape_flt[0];
+
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      return make_shape(pixels_xformed, filters, taps * channels, _1{});
+    } else if constexpr (ConvOp == conv::Operator::kDgrad) {
+      return make_shape(pixels_act, channels, taps * filters, _1{});
+    } else {
+      return make_shape(filters, taps * channels, pixels_xformed, _1{});
+    }
+  }
+
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    // ConvProblemShape stores the operands of the linearized GEMM, map them back to the convolution tensors
+    auto const& [shape_act, stride_act] = get_act(problem_shape);
+    auto const& [shape_flt, stride_flt] = get_flt(problem_shape);
+    auto const& [shape_xformed, stride_xformed] = get_xformed(problem_shape);
+
+    Params params;
+    params.ptr_A = args.ptr_A;
+    params.ptr_B = args.ptr_B;
+    for (int i = 0; i < NumTensorDimensions; ++i) {
+      params.stride_act[i] = stride_act[i];
+      params.stride_flt[i] = stride_flt[i];
+      params.stride_xformed[i] = stride_xformed[i];
+    }
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      params.extent_act[i] = shape_act[i + 1];
+      params.extent_flt[i] = shape_flt[i + 1];
+      params.extent_xformed[i] = shape_xformed[i + 1];
+      params.lower_padding[i] = problem_shape.lower_padding[i];
+      params.traversal_stride[i] = problem_shape.traversal_stride[i];
+      params.dilation[i] = problem_shape.dilation[i];
+      params.divmod_act[i] = FastDivmod(shape_act[i + 1]);
+      params.divmod_flt[i] = FastDivmod(shape_flt[i + 1]);
+      params.divmod_xformed[i] = FastDivmod(shape_xformed[i + 1]);
+      params.divmod_traversal_stride[i] = FastDivmod(problem_shape.traversal_stride[i]);
+    }
+    params.divmod_channels = FastDivmod(shape_act[NumTensorDimensions - 1]);
+    params.divmod_filters = FastDivmod(shape_flt[0]);
+    params.flip_filter = problem_shape.mode == conv::Mode::kConvolution;
+    return params;
+  }
+
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      Arguments const& args) {
+    auto const& [shape_act, stride_act] = get_act(problem_shape);
+    auto const& [shape_flt, stride_flt] = get_flt(problem_shape);
+    auto const& [shape_xformed, stride_xformed] = get_xformed(problem_shape);
+
+    bool implementable = problem_shape.groups == 1;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped convolutions are not supported.\n");
+      return false;
+    }
+
+    // Each vector is gathered as a whole, so the channel modes must be packed multiples of the vector width and
+    // every other stride must keep the vectors aligned
+    implementable &= stride_act[NumTensorDimensions - 1] == 1;
+    implementable &= stride_flt[NumTensorDimensions - 1] == 1;
+    implementable &= stride_xformed[NumTensorDimensions - 1] == 1;
+    implementable &= shape_act[NumTensorDimensions - 1] % AlignmentA == 0;
+    implementable &= shape_flt[0] % AlignmentA == 0;
+    for (int i = 0; i < NumTensorDimensions - 1; ++i) {
+      implementable &= stride_act[i] % AlignmentA == 0;
+      implementable &= stride_flt[i] % AlignmentA == 0;
+      implementable &= stride_xformed[i] % AlignmentA == 0;
+    }
+    implementable &= (reinterpret_cast<uintptr_t>(args.ptr_A) % (CopyBits / 8)) == 0;
+    implementable &= (reinterpret_cast<uintptr_t>(args.ptr_B) % (CopyBits / 8)) == 0;
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for 128-bit gathers.\n");
+    }
+    return implementable;
+  }
+
+  /// Perform a workgroup-scoped implicit GEMM with operands gathered into SLM
+  template <class FrgTensorD, class BlkCoord, class ProblemShapeMNKL>
+  CUTLASS_DEVICE void operator()(FrgTensorD &accum, BlkCoord const &blk_coord, ProblemShapeMNKL const &problem_shape_MNKL,
+                                 int k_tile_count, int thread_idx, char *smem_buf, Params const &mainloop) {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+
+    auto [M, N, K, L] = problem_shape_MNKL;
+    auto m_coord = get<0>(blk_coord);
+    auto n_coord = get<1>(blk_coord);
+
+    // Coordinates of the linearized GEMM, for predication and for the gathers
+    Tensor cA_mk = local_tile(make_identity_tensor(make_shape(M, K)), select<0,2>(WorkgroupTileShape{}),
+                              make_coord(m_coord,_));                                      // (BLK_M,BLK_K,k)
+    Tensor cB_nk = local_tile(make_identity_tensor(make_shape(N, K)), select<1,2>(WorkgroupTileShape{}),
+                              make_coord(n_coord,_));                                      // (BLK_N,BLK_K,k)
+
+    SharedStorage& storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    Tensor sA = make_tensor(make_smem_ptr(storage.smem_A.data()), SmemLayoutA{});         // (BLK_M,BLK_K,PIPE)
+    Tensor sB = make_tensor(make_smem_ptr(storage.smem_B.data()), SmemLayoutB{});         // (BLK_N,BLK_K,PIPE)
+
+    SlmTiledCopyA slm_copy_a;
+    SlmTiledCopyB slm_copy_b;
+    auto thr_slm_copy_A = slm_copy_a.get_slice(thread_idx);
+    auto thr_slm_copy_B = slm_copy_b.get_slice(thread_idx);
+
+    Tensor tAcA = thr_slm_copy_A.partition_S(cA_mk);                                       // (CPY,CPY_M,CPY_K,k)
+    Tensor tAsA = thr_slm_copy_A.partition_D(sA);                                          // (CPY,CPY_M,CPY_K,PIPE)
+    Tensor tArA = make_fragment_like(tAsA(_,_,_,0));                                       // (CPY,CPY_M,CPY_K)
+    Tensor tBcB = thr_slm_copy_B.partition_S(cB_nk);
+    Tensor tBsB = thr_slm_copy_B.partition_D(sB);
+    Tensor tBrB = make_fragment_like(tBsB(_,_,_,0));
+
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(thread_idx);
+    Tensor tCsA = thr_mma.partition_A(sA);                                                 // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCsB = thr_mma.partition_B(sB);                                                 // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tCrA = thr_mma.make_fragment_A(tCsA(_,_,_,0));                                  // (MMA,MMA_M,MMA_K)
+    Tensor tCrB = thr_mma.make_fragment_B(tCsB(_,_,_,0));                                  // (MMA,MMA_N,MMA_K)
+
+    auto const shape_MK = make_shape(M, K);
+    auto const shape_NK = make_shape(N, K);
+
+    auto gather = [](auto const& slm_copy, auto const* ptr, int64_t offset, auto&& frg) {
+      if (offset >= 0) {
+        copy(slm_copy, make_tensor(make_gmem_ptr(ptr + offset), make_layout(shape(frg))), frg);
+      } else {
+        clear(frg);
+      }
+    };
+
+    auto load_k_tile = [&](int k_tile) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int m = 0; m < size<1>(tArA); ++m) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < size<2>(tArA); ++k) {
+          auto [mi, ki] = tAcA(0,m,k,k_tile);
+          gather(slm_copy_a, mainloop.ptr_A,
+                 elem_less(make_coord(mi, ki), shape_MK) ? offset_A(mainloop, mi, ki) : int64_t(-1), tArA(_,m,k));
+        }
+      }
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < size<1>(tBrB); ++n) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < size<2>(tBrB); ++k) {
+          auto [ni, ki] = tBcB(0,n,k,k_tile);
+          gather(slm_copy_b, mainloop.ptr_B,
+                 elem_less(make_coord(ni, ki), shape_NK) ? offset_B(mainloop, ni, ki) : int64_t(-1), tBrB(_,n,k));
+        }
+      }
+    };
+
+    auto store_k_tile = [&](int stage) {
+      copy(slm_copy_a, tArA, tAsA(_,_,_,stage));
+      copy(slm_copy_b, tBrB, tBsB(_,_,_,stage));
+    };
+
+    //
+    // Mainloop
+    //
+    int read_stage = 0;
+    if (k_tile_count > 0) {
+      load_k_tile(0);
+      store_k_tile(read_stage);
+    }
+    syncthreads();
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int k_tile = 0; k_tile < k_tile_count; k_tile++) {
+      int const write_stage = (read_stage + 1) % DispatchPolicy::Stages;
+      bool const has_next = k_tile + 1 < k_tile_count;
+
+      // Issue the gathers of the next k-tile before computing on the current one
+      if (has_next) {
+        load_k_tile(k_tile + 1);
+      }
+
+      copy(tCsA(_,_,_,read_stage), tCrA);
+      copy(tCsB(_,_,_,read_stage), tCrB);
+      cute::gemm(tiled_mma, tCrA, tCrB, accum);
+
+      // The write stage was last read in the previous iteration, which every work-item has left
+      if (has_next) {
+        store_k_tile(write_stage);
+      }
+      syncthreads();
+      read_stage = write_stage;
+    }
+  }
+
+private:
+  static constexpr auto
+  get_act(ProblemShape const& problem_shape) {
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      return cute::make_tuple(problem_shape.shape_A, problem_shape.stride_A);
+    } else if constexpr (ConvOp == conv::Operator::kDgrad) {
+      return cute::make_tuple(problem_shape.shape_C, problem_shape.stride_C);
+    } else {
+      return cute::make_tuple(problem_shape.shape_B, problem_shape.stride_B);
+    }
+  }
+
+  static constexpr auto
+  get_flt(ProblemShape const& problem_shape) {
+    if constexpr (ConvOp == conv::Operator::kWgrad) {
+      return cute::make_tuple(problem_shape.shape_C, problem_shape.stride_C);
+    } else {
+      return cute::make_tuple(problem_shape.shape_B, problem_shape.stride_B);
+    }
+  }
+
+  static constexpr auto
+  get_xformed(ProblemShape const& problem_shape) {
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      return cute::make_tuple(problem_shape.shape_C, problem_shape.stride_C);
+    } else {
+      return cute::make_tuple(problem_shape.shape_A, problem_shape.stride_A);
+    }
+  }
+
+  // Splits a linearized index over (outer, spatial..., inner) into its spatial coordinates, returning the outer one
+  CUTLASS_DEVICE static int
+  split_spatial(int idx, FastDivmod const (&divmod)[NumSpatialDimensions], int (&coord)[NumSpatialDimensions]) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = NumSpatialDimensions - 1; i >= 0; --i) {
+      int quotient;
+      divmod[i](quotient, coord[i], idx);
+      idx = quotient;
+    }
+    return idx;
+  }
+
+  // Splits a linearized (t, r, s, channel) index, flipping the filter taps for true convolutions
+  CUTLASS_DEVICE static int
+  split_filter(Params const& params, int idx, FastDivmod const& divmod_channel, int (&tap)[NumSpatialDimensions]) {
+    int trs, channel;
+    divmod_channel(trs, channel, idx);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = NumSpatialDimensions - 1; i > 0; --i) {
+      int quotient;
+      params.divmod_flt[i](quotient, tap[i], trs);
+      trs = quotient;
+    }
+    tap[0] = trs;
+    if (params.flip_filter) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        tap[i] = params.extent_flt[i] - 1 - tap[i];
+      }
+    }
+    return channel;
+  }
+
+  // Offset of an activation vector read by output pixel `pixel` through filter tap `tap`, or -1 in the padding
+  CUTLASS_DEVICE static int64_t
+  offset_act_im2col(Params const& params, int pixel, int const (&tap)[NumSpatialDimensions], int channel) {
+    int pos[NumSpatialDimensions];
+    int n = split_spatial(pixel, params.divmod_xformed, pos);
+    int64_t offset = n * params.stride_act[0] + channel;
+    bool valid = true;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      int x = pos[i] * params.traversal_stride[i] - params.lower_padding[i] + tap[i] * params.dilation[i];
+      valid &= x >= 0 && x < params.extent_act[i];
+      offset += x * params.stride_act[i + 1];
+    }
+    return valid ? offset : int64_t(-1);
+  }
+
+  CUTLASS_DEVICE static int64_t
+  offset_flt(Params const& params, int filter, int const (&tap)[NumSpatialDimensions], int channel) {
+    int64_t offset = filter * params.stride_flt[0] + channel;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      offset += tap[i] * params.stride_flt[i + 1];
+    }
+    return offset;
+  }
+
+  // Offset of the vector of operand A at linearized coordinate (m, k)
+  CUTLASS_DEVICE static int64_t
+  offset_A(Params const& params, int m, int k) {
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      int tap[NumSpatialDimensions];
+      int c = split_filter(params, k, params.divmod_channels, tap);
+      return offset_act_im2col(params, m, tap, c);
+    } else if constexpr (ConvOp == conv::Operator::kDgrad) {
+      // The activation pixel x receives the gradient of output pixel (x + pad - tap * dilation) / stride when
+      // that lands on the output grid
+      int tap[NumSpatialDimensions];
+      int pos[NumSpatialDimensions];
+      int kout = split_filter(params, k, params.divmod_filters, tap);
+      int n = split_spatial(m, params.divmod_act, pos);
+      int64_t offset = n * params.stride_xformed[0] + kout;
+      bool valid = true;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        int z = pos[i] + params.lower_padding[i] - tap[i] * params.dilation[i];
+        int residue = 0;
+        if (z >= 0) {
+          params.divmod_traversal_stride[i](z, residue, z);
+        }
+        valid &= z >= 0 && residue == 0 && z < params.extent_xformed[i];
+        offset += z * params.stride_xformed[i + 1];
+      }
+      return valid ? offset : int64_t(-1);
+    } else {
+      int pos[NumSpatialDimensions];
+      int n = split_spatial(k, params.divmod_xformed, pos);
+      int64_t offset = n * params.stride_xformed[0] + m;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        offset += pos[i] * params.stride_xformed[i + 1];
+      }
+      return offset;
+    }
+  }
+
+  // Offset of the vector of operand B at linearized coordinate (n, k)
+  CUTLASS_DEVICE static int64_t
+  offset_B(Params const& params, int n, int k) {
+    int tap[NumSpatialDimensions];
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      int c = split_filter(params, k, params.divmod_channels, tap);
+      return offset_flt(params, n, tap, c);
+    } else if constexpr (ConvOp == conv::Operator::kDgrad) {
+      int kout = split_filter(params, k, params.divmod_filters, tap);
+      return offset_flt(params, kout, tap, n);
+    } else {
+      int c = split_filter(params, n, params.divmod_channels, tap);
+      return offset_act_im2col(params, k, tap, c);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,10 @@
 #include "cutlass/detail/layout.hpp"
 #include "cutlass/cuda_host_adapter.hpp"
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_event_manager.hpp"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::conv::device {
@@ -251,6 +255,7 @@ public:
       return Status::kSuccess;
     }
     else {
+#if !defined(CUTLASS_ENABLE_SYCL)
       // account for dynamic smem capacity if needed
       int smem_size = ConvKernel::SharedStorageSize;
       if (smem_size >= (48 << 10)) {
@@ -265,6 +270,7 @@ public:
           return Status::kErrorInternal;
         }
       }
+#endif
     }
     return Status::kSuccess;
   }
@@ -297,6 +303,7 @@ public:
     Status launch_result;
     // Use extended launch API only for mainloops that use it
     if constexpr (ConvKernel::ArchTag::kMinComputeCapability >= 90) {
+#if !defined(CUTLASS_ENABLE_SYCL)
       [[maybe_unused]] constexpr bool is_static_1x1x1 =
         cute::is_static_v<typename ConvKernel::DispatchPolicy::ClusterShape> and
         cute::size(typename ConvKernel::DispatchPolicy::ClusterShape{}) == 1;
@@ -339,6 +346,7 @@ public:
           }
         }
       }
+#endif
     }
     else {
       launch_result = Status::kSuccess;
@@ -359,7 +367,25 @@ public:
       }
       else {
         CUTLASS_ASSERT(cuda_adapter == nullptr);
+#if defined(CUTLASS_ENABLE_SYCL)
+        const auto sycl_block = syclcompat::dim3(block.x, block.y, block.z);
+        const auto sycl_grid = syclcompat::dim3(grid.x, grid.y, grid.z);
+
+        using namespace syclcompat::experimental;
+#if defined(SYCL_INTEL_TARGET)
+        auto event = launch<device_kernel<ConvKernel>>(launch_policy{
+          sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)},
+          kernel_properties{sycl_exp::sub_group_size<DispatchPolicy::SubgroupSize>}
+        }, params);
+#else
+        auto event = launch<device_kernel<ConvKernel>>(launch_policy{
+          sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)}},
+          params);
+#endif
+        EventManager::getInstance().addEvent(event);
+#else
         device_kernel<ConvKernel><<<grid, block, smem_size, stream>>>(params);
+#endif
       }
     }
 
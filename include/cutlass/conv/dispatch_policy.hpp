@@ -112,10 +112,36 @@ struct MainloopSm100TmaUmmaWarpSpecializedImplicitGemm {
   using Schedule = KernelImplicitTmaWarpSpecializedSm100;
 
   static_assert(NumSpatialDimensions >= 1);
-}; 
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(SYCL_INTEL_TARGET)
+struct KernelImplicitIntelPVC { };
+
+// Implicit GEMM with the im2col gathered A and B tiles staged through a Stages-deep SLM ring, for Intel PVC
+template<
+  conv::Operator ConvOp_,
+  int Stages_,
+  int NumSpatialDimensions_,
+  class KernelSchedule = KernelImplicitIntelPVC
+>
+struct MainloopIntelPVCImplicitGemm {
+  static constexpr int Stages = Stages_;
+  static constexpr int NumSpatialDimensions = NumSpatialDimensions_;
+  static constexpr Operator ConvOp = ConvOp_;
+  using ClusterShape = cute::Shape<cute::C<1>,cute::C<1>,cute::C<1>>;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelSchedule;
+  static constexpr int SubgroupSize = 16;
+
+  static_assert(NumSpatialDimensions >= 1 && NumSpatialDimensions <= 3);
+  static_assert(Stages >= 2, "The SLM ring needs a buffer to compute on and one to fill.");
+};
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 
-} // namespace cutlass::conv 
+} // namespace cutlass::conv
 
 //////////////////////////////////////////////////////////////////////////////
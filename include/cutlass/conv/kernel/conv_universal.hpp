@@ -62,4 +62,7 @@ class ConvUniversal {
 ////////////////////////////////////////////////////////////////////////////////
 #include "cutlass/conv/kernel/sm90_implicit_gemm_tma_warpspecialized.hpp"
 #include "cutlass/conv/kernel/sm100_implicit_gemm_tma_warpspecialized.hpp" 
+#if defined(SYCL_INTEL_TARGET)
+#include "cutlass/conv/kernel/xe_implicit_gemm.hpp"
+#endif
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,257 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/conv/dispatch_policy.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Implicit GEMM convolution on Intel PVC. Each workgroup computes one (BLK_M,BLK_N) tile of the linearized GEMM
+// defined by the collective mainloop, and the Xe GEMM epilogue writes it to the output tensor, which is a
+// row-major (M,N) matrix for all three operators.
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileScheduler_
+>
+class ConvUniversal<
+  ProblemShape_,
+  CollectiveMainloop_,
+  CollectiveEpilogue_,
+  TileScheduler_,
+  cute::enable_if_t<cute::is_base_of_v<KernelImplicitIntelPVC, typename CollectiveMainloop_::DispatchPolicy::Schedule>>
+>
+{
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  static_assert(cute::is_same_v<ProblemShape, typename CollectiveMainloop_::ProblemShape>,
+    "Mainloop and kernel do not agree on the convolution problem shape.");
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::TileShape;
+  using WorkgroupTileShape = TileShape;
+  using TiledMma  = typename CollectiveMainloop::TiledMma;
+  using ArchTag   = typename CollectiveMainloop::ArchTag;
+  using ElementA  = typename CollectiveMainloop::ElementA;
+  using ElementB  = typename CollectiveMainloop::ElementB;
+  using DispatchPolicy = typename CollectiveMainloop::DispatchPolicy;
+  using ElementAccumulator = typename CollectiveMainloop::ElementAccumulator;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+  using ClusterShape = typename DispatchPolicy::ClusterShape;
+
+  static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+  static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize;
+  using SubgroupTileShape = typename CollectiveMainloop::SubgroupTileShape;
+
+  static_assert(cute::is_void_v<TileScheduler_>, "Intel PVC convolutions only support the default tile scheduler.");
+  using TileSchedulerTag = TileScheduler_;
+  struct TileSchedulerArguments { };
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using ElementC = typename CollectiveEpilogue::ElementC;
+  using StrideC  = typename CollectiveEpilogue::StrideC;
+  using ElementD = typename CollectiveEpilogue::ElementD;
+  using StrideD  = typename CollectiveEpilogue::StrideD;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+  static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue::ElementAccumulator>,
+    "Mainloop and epilogue do not agree on accumulator value type.");
+
+  // The gathered operands are staged through SLM; the epilogue uses none
+  static constexpr int SharedStorageSize = static_cast<int>(sizeof(typename CollectiveMainloop::SharedStorage));
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+    EpilogueTensorStorage epilogue;
+  };
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+    TileSchedulerArguments scheduler{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    MainloopParams mainloop{};
+    EpilogueParams epilogue{};
+  };
+
+  //
+  // Methods
+  //
+
+  static
+  Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    auto problem_shape_MNKL = CollectiveMainloop::get_problem_shape_MNKL(args.problem_shape);
+    return {
+      args.problem_shape,
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+      CollectiveEpilogue::to_underlying_arguments(problem_shape_MNKL, args.epilogue, workspace)
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto [M, N, K, L] = CollectiveMainloop::get_problem_shape_MNKL(args.problem_shape);
+    bool shape_implementable = M > 0 && N > 0 && K > 0;
+
+    // The epilogue writes the output tensor as a row-major (M,N) matrix, so it has to be packed
+    auto const& shape_C = args.problem_shape.shape_C;
+    auto const& stride_C = args.problem_shape.stride_C;
+    bool output_packed = stride_C[ProblemShape::RankT - 1] == 1;
+    for (int i = 0; i < ProblemShape::RankT - 1; ++i) {
+      output_packed &= stride_C[i] == stride_C[i + 1] * shape_C[i + 1];
+    }
+    output_packed &= get<0>(args.epilogue.dD) == N && get<1>(args.epilogue.dD) == 1;
+    if (!output_packed) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: The output tensor of Intel PVC convolutions must be packed.\n");
+      return false;
+    }
+
+    return shape_implementable &&
+           CollectiveMainloop::can_implement(args.problem_shape, args.mainloop) &&
+           CollectiveEpilogue::can_implement(make_shape(M, N, K, L), args.epilogue);
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    auto problem_shape_MNKL = CollectiveMainloop::get_problem_shape_MNKL(args.problem_shape);
+    return CollectiveEpilogue::get_workspace_size(problem_shape_MNKL, args.epilogue);
+  }
+
+  static
+  cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    auto problem_shape_MNKL = CollectiveMainloop::get_problem_shape_MNKL(args.problem_shape);
+    return CollectiveEpilogue::initialize_workspace(problem_shape_MNKL, args.epilogue, workspace, stream, cuda_adapter);
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [M, N, K, L] = CollectiveMainloop::get_problem_shape_MNKL(params.problem_shape);
+    return dim3(cute::ceil_div(M, cute::size<0>(TileShape{})), cute::ceil_div(N, cute::size<1>(TileShape{})), 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    CUTE_STATIC_ASSERT(is_static<WorkgroupTileShape>::value);
+    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+
+    auto problem_shape_MNKL = CollectiveMainloop::get_problem_shape_MNKL(params.problem_shape);
+    auto M = get<0>(problem_shape_MNKL);
+    auto N = get<1>(problem_shape_MNKL);
+    auto K = get<2>(problem_shape_MNKL);
+
+    int thread_idx = int(ThreadIdxX());
+    auto blk_shape = TileShape{};
+    int m_coord = BlockIdxX();
+    int n_coord = BlockIdxY();
+    auto blk_coord_mnkl = make_coord(m_coord, n_coord, _, 0);
+    constexpr auto subgroup_shape = SubgroupTileShape{};
+
+    // Compute tile residues for predication
+    auto m_max_coord = M - get<0>(subgroup_shape) * m_coord;                             // M - SUB_M * m_coord
+    auto n_max_coord = N - get<1>(subgroup_shape) * n_coord;                             // N - SUB_N * n_coord
+    auto k_residue   = K - get<2>(subgroup_shape) * (K / get<2>(subgroup_shape));        // K - SUB_K * k_coord_max
+    auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
+
+    TiledMma tiled_mma;
+    Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape));
+    clear(accumulators);
+
+    int k_tile_count = ceil_div(K, get<2>(blk_shape));
+
+    CollectiveMainloop collective_mma;
+    collective_mma(
+      accumulators,
+      blk_coord_mnkl,
+      problem_shape_MNKL,
+      k_tile_count,
+      thread_idx,
+      smem_buf,
+      params.mainloop
+    );
+
+    // The mainloop ends on a barrier, so the epilogue is free to reuse the SLM
+    CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
+    epilogue(
+      problem_shape_MNKL,
+      subgroup_shape,
+      blk_coord_mnkl,
+      accumulators,
+      tiled_mma,
+      residue_mnk,
+      thread_idx,
+      smem_buf
+    );
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::kernel
+
+///////////////////////////////////////////////////////////////////////////////
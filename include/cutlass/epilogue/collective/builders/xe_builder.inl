@@ -118,6 +118,122 @@ namespace detail {
         CopyOpG2R
       >;
   };
+
+  template <
+    class ElementD,
+    class ElementCompute,
+    class ElementBias,
+    class ElementC,
+    class ElementScalar,
+    int AlignmentBias,
+    FloatRoundStyle RoundStyle
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombPerColBias<
+    ElementD, ElementCompute, ElementBias, ElementC, ElementScalar, AlignmentBias, RoundStyle
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombPerColBias<ElementD, ElementCompute, ElementBias, ElementC, ElementScalar, AlignmentBias, RoundStyle>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
+
+  template <
+    class GmemLayoutTagAux,
+    template <class> class ActivationFn,
+    class ElementD,
+    class ElementCompute,
+    class ElementAux,
+    class ElementBias,
+    class ElementC,
+    class ElementScalar,
+    int AlignmentAux,
+    int AlignmentBias,
+    FloatRoundStyle RoundStyle
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombPerColBiasEltActAux<
+    GmemLayoutTagAux, ActivationFn, ElementD, ElementCompute, ElementAux, ElementBias, ElementC, ElementScalar,
+    AlignmentAux, AlignmentBias, RoundStyle
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombPerColBiasEltActAux<
+          GmemLayoutTagAux, ActivationFn, ElementD, ElementCompute, ElementAux, ElementBias, ElementC, ElementScalar,
+          AlignmentAux, AlignmentBias, RoundStyle>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
+
+  template <
+    class ElementD,
+    class ElementCompute,
+    class ElementAmax,
+    class ElementC,
+    class ElementScalar,
+    FloatRoundStyle RoundStyle
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombAmax<
+    ElementD, ElementCompute, ElementAmax, ElementC, ElementScalar, RoundStyle
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombAmax<ElementD, ElementCompute, ElementAmax, ElementC, ElementScalar, RoundStyle>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
+
+  template <
+    template <class> class RegReduceFn,
+    template <class> class GmemReduceFn,
+    class ElementD,
+    class ElementCompute,
+    class ElementReduction,
+    class ElementC,
+    class ElementScalar,
+    FloatRoundStyle RoundStyle
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombRowColReduction<
+    RegReduceFn, GmemReduceFn, ElementD, ElementCompute, ElementReduction, ElementC, ElementScalar, RoundStyle
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombRowColReduction<
+          RegReduceFn, GmemReduceFn, ElementD, ElementCompute, ElementReduction, ElementC, ElementScalar, RoundStyle>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
 }
 
   // Intel epilogue builder
@@ -163,15 +279,13 @@ template <
           "Trying to use Intel pipeline on Non Intel hardware");
       #endif
       static_assert(is_static<TileShape_MNK>::value);
-      static_assert(cute::is_same_v<ElementC, float>, "ElementC needs to be float for the Intel pipeline");
-      
-      // Note, this must match the TiledMma definition in the GEMM builder
-      using TiledMma =
-          TiledMMA<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
-                   Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>,
-                   Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
-                        Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, _32>>;
+      static_assert(cute::is_same_v<ElementC, float> || cute::is_same_v<ElementC, int32_t>,
+        "ElementC needs to be float or int32_t for the Intel pipeline");
       
+      // The TiledMma made by the GEMM builder always spans the whole workgroup tile, whatever subgroup layout it
+      // picks, so the epilogue tile is the workgroup tile
+      using EpilogueTile = decltype(take<0, 3>(TileShape_MNK{}));
+
       using DispatchPolicy = cutlass::epilogue::IntelPVCEpilogue;
       using CopyOpG2R = XE_2D_U32x8x16_LD_N;
       using CopyOpR2G = XE_2D_U32x8x16_ST_N;
@@ -182,7 +296,7 @@ template <
       using SmemLayoutAtomD_ = void;
       using CopyOpR2S_ = void;
 
-      using FusionCallbacks = typename detail::FusionOpInfo<FusionOpOrCallbacks>::template FusionCallbacks<DispatchPolicy,  TileShape_MNK, decltype(tile_shape(TiledMma())), CopyOpG2R>;
+      using FusionCallbacks = typename detail::FusionOpInfo<FusionOpOrCallbacks>::template FusionCallbacks<DispatchPolicy,  TileShape_MNK, EpilogueTile, CopyOpG2R>;
 
       using CollectiveOp = cutlass::epilogue::collective::CollectiveEpilogue<
             DispatchPolicy,
@@ -135,6 +135,18 @@ private:
   constexpr static bool is_m_major_C = detail::is_m_major<StrideC>();
   constexpr static bool is_m_major_D = detail::is_m_major<StrideD>();
 
+  // 2D block messages require the surface pitch to be a multiple of 16B. Surfaces that do not meet this
+  // (e.g. a row-major D with N = 32001) fall back to predicated per work-item accesses.
+  static constexpr int BlockCopyAlignmentBits = 128;
+  static constexpr int BlockCopyAlignmentC = cute::is_void_v<ElementC> ? 1 : BlockCopyAlignmentBits / sizeof_bits_v<ElementC>;
+  static constexpr int BlockCopyAlignmentD = cute::is_void_v<ElementD> ? 1 : BlockCopyAlignmentBits / sizeof_bits_v<ElementD>;
+
+  static constexpr int BlockCopyRows = size<0>(typename Trait_D::BlockShape{});
+  static constexpr int BlockCopyCols = size<1>(typename Trait_D::BlockShape{});
+
+  // The fallbacks handle one column of the block copy per work-item
+  static constexpr bool is_unaligned_fallback_supported = BlockCopyCols == SubgroupSize;
+
 public:
 
   using EmptyType = cute::tuple<>;
@@ -171,6 +183,8 @@ public:
     StrideC dC{};
     ElementD* ptr_D = nullptr;
     StrideD dD{};
+    bool use_block_load_C = true;
+    bool use_block_store_D = true;
   };
 
   //
@@ -187,8 +201,12 @@ public:
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
     auto [M, N, K, L] = problem_shape_MNKL;
 
+    bool use_block_load_C = true;
+    bool use_block_store_D = true;
+
     XE_Copy_C xe_load_c = {};
     if constexpr (is_source_supported) {
+      use_block_load_C = cutlass::detail::check_alignment<BlockCopyAlignmentC>(make_shape(M, N, L), args.dC);
       auto mC = make_tensor(make_gmem_ptr(static_cast<ElementC const*>(args.ptr_C)),
                             make_layout(make_shape(M, N, L), args.dC));
       xe_load_c = make_tiled_copy(Copy_Atom<Trait_C, ElementC>{}.with(mC),
@@ -198,6 +216,7 @@ public:
 
     XE_Copy_D xe_store_d = {};
     if constexpr (is_destination_supported) {
+      use_block_store_D = cutlass::detail::check_alignment<BlockCopyAlignmentD>(make_shape(M, N, L), args.dD);
       auto mD = make_tensor(make_gmem_ptr(static_cast<ElementD const*>(args.ptr_D)),
                             make_layout(make_shape(M, N, L), args.dD));
       xe_store_d = make_tiled_copy(Copy_Atom<Trait_D, ElementD>{}.with(mD),
@@ -212,21 +231,23 @@ public:
       args.ptr_C,
       args.dC,
       args.ptr_D,
-      args.dD
+      args.dD,
+      use_block_load_C,
+      use_block_store_D
     };
   }
 
   template <class ProblemShape>
   static size_t
   get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
-    return 0;
+    return FusionCallbacks::get_workspace_size(problem_shape, args.thread);
   }
 
   template <class ProblemShape>
   static cutlass::Status
   initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream, 
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    return FusionCallbacks::initialize_workspace(problem_shape, args.thread, workspace, stream, cuda_adapter);
   }
 
   template <class ProblemShape>
@@ -234,6 +255,21 @@ public:
   can_implement(
       ProblemShape const& problem_shape,
       [[maybe_unused]] Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_MNKL;
+
+    bool block_copy_aligned = true;
+    if constexpr (is_source_supported) {
+      block_copy_aligned &= cutlass::detail::check_alignment<BlockCopyAlignmentC>(make_shape(M, N, L), args.dC);
+    }
+    if constexpr (is_destination_supported) {
+      block_copy_aligned &= cutlass::detail::check_alignment<BlockCopyAlignmentD>(make_shape(M, N, L), args.dD);
+    }
+
+    if (!block_copy_aligned && !is_unaligned_fallback_supported) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: C/D pitch is not 16B aligned and the D copy has no unaligned fallback.\n");
+      return false;
+    }
     return true;
   }
 
@@ -247,6 +283,47 @@ public:
     return fusion_callbacks.is_producer_load_needed();
   }
 
+  // Fallbacks for C/D surfaces which cannot be accessed with 2D block messages. Each work-item handles
+  // one column of the (BlockCopyRows, BlockCopyCols) block, so that the values it holds match the
+  // register layout of the 2D block copy, and consecutive work-items still access consecutive addresses.
+  template <class FragC, class CoordTensor, class ProblemShapeMNKL>
+  CUTLASS_DEVICE void
+  load_C_unaligned(FragC& trC, CoordTensor const& tCgC, ProblemShapeMNKL const& problem_shape_mnkl) const {
+    if constexpr (is_source_supported) {
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m_base, n_base, l] = tCgC.data().coord_;
+      int n = n_base + get_sub_group_local_id();
+
+      Tensor trC_elems = recast<ElementC>(trC);
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = 0; v < BlockCopyRows; ++v) {
+        int m = m_base + v;
+        trC_elems(v) = (m < M && n < N)
+          ? params.ptr_C[m * get<0>(params.dC) + n * get<1>(params.dC) + l * get<2>(params.dC)]
+          : ElementC(0);
+      }
+    }
+  }
+
+  template <class FragD, class CoordTensor, class ProblemShapeMNKL>
+  CUTLASS_DEVICE void
+  store_D_unaligned(FragD const& trD_frag, CoordTensor const& tCgD, ProblemShapeMNKL const& problem_shape_mnkl) const {
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [m_base, n_base, l] = tCgD.data().coord_;
+    int n = n_base + get_sub_group_local_id();
+    if (n >= N) {
+      return;
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int v = 0; v < BlockCopyRows; ++v) {
+      int m = m_base + v;
+      if (m < M) {
+        params.ptr_D[m * get<0>(params.dD) + n * get<1>(params.dD) + l * get<2>(params.dD)] = ElementD(trD_frag[v]);
+      }
+    }
+  }
+
   template<
     class ProblemShapeMNKL,
     class TileShapeMNK,
@@ -383,7 +460,11 @@ public:
 
         if (is_C_load_needed) {
           //cordinates for C and D are the same
-          copy(params.xe_load_c, tCgD(_, epi_m, epi_n), trC);
+          if (params.use_block_load_C) {
+            copy(params.xe_load_c, tCgD(_, epi_m, epi_n), trC);
+          } else if constexpr (is_unaligned_fallback_supported) {
+            load_C_unaligned(trC, tCgD(_, epi_m, epi_n), problem_shape_mnkl);
+          }
         }
 
         cst_callbacks.previsit(epi_m, epi_n, 0, is_C_load_needed);
@@ -397,7 +478,11 @@ public:
         cst_callbacks.reduce(nullptr, synchronize, epi_m, epi_n, (epi_m == FragsM - 1 && epi_n == FragsN - 1), trD);
         
         if constexpr (is_destination_supported) {
-          copy(params.xe_store_d, trD, tCgD(_, epi_m, epi_n));
+          if (params.use_block_store_D) {
+            copy(params.xe_store_d, trD, tCgD(_, epi_m, epi_n));
+          } else if constexpr (is_unaligned_fallback_supported) {
+            store_D_unaligned(trD_frag(0), tCgD(_, epi_m, epi_n), problem_shape_mnkl);
+          }
         }
       }
     }
@@ -235,6 +235,11 @@ struct Sm100PtrArrayNoSmemWarpSpecialized {};
 struct IntelPVCEpilogue {
   static constexpr int SubgroupSize = 16;
 };
+
+// Epilogue for ptr-array and grouped GEMMs, where each group has its own C/D pointers and strides
+struct IntelPVCGroupEpilogue {
+  static constexpr int SubgroupSize = 16;
+};
 #endif
 
 //////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,40 @@ struct LinCombSoftmaxRow
     : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
 };
 
+// D = alpha * acc + beta * C
+// amax = max(abs(elements in D))
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombAmax
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
+// D = alpha * acc + beta * C
+// row_reduction = reduce(D) along M, one value per column
+// col_reduction = reduce(D) along N, one value per row
+template<
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementReduction_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRowColReduction
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementReduction = ElementReduction_;
+};
+
 // D = alpha * acc + beta * C + per-row bias
 template<
   class ElementOutput_,
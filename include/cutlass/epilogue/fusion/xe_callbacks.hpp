@@ -410,6 +410,391 @@ struct FusionCallbacks<
   using Impl::Impl;
 };
 
+// D = alpha * acc + beta * C + per-column bias
+template<
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBias = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombPerColBias =
+  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + (alpha * acc + bias)
+    Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // beta
+    Sm90SrcFetch<ElementSource>, // C
+    Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // alpha * acc + bias
+      Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // alpha
+      Sm90AccFetch, // acc
+      XeRowBroadcast<ElementBias, ElementCompute, Stride<_0,_1,int64_t>> // bias
+    >
+  >;
+
+template <
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementBias_,
+  class ElementSource_,
+  class ElementScalar_,
+  int AlignmentBias_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombPerColBias<ElementOutput_, ElementCompute_, ElementBias_, ElementSource_, ElementScalar_, AlignmentBias_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombPerColBias<typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementBias_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombPerColBias<
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type,
+      ElementCompute_, ElementBias_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementBias = ElementBias_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  static constexpr int AlignmentBias = AlignmentBias_;
+  using Operation = fusion::LinCombPerColBias<ElementOutput_, ElementCompute_, ElementBias_, ElementSource_, ElementScalar_, AlignmentBias_, RoundStyle_>;
+
+  struct Arguments {
+    ElementScalar_ alpha = ElementScalar_(1);
+    ElementScalar_ beta = ElementScalar_(0);
+    ElementScalar_ const* alpha_ptr = nullptr;
+    ElementScalar_ const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using StrideBias = Stride<_0, _1, int64_t>;
+    ElementBias const* bias_ptr = nullptr;
+    StrideBias dBias = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {     // ternary op : beta * C + (alpha * acc + bias)
+          {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+          {},                   // leaf args : C
+          {                     // ternary op : alpha * acc + bias
+            {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+            {},                     // leaf args : acc
+            {bias_ptr, ElementBias(0), dBias}, // leaf args : bias
+            {}                  // ternary args : multiply_add
+          },                    // end ternary op
+          {} // ternary args : multiply_add
+        };   // end ternary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+// D = activation(alpha * acc + beta * C + per-column bias)
+// aux = alpha * acc + beta * C + per-column bias
+template<
+  class StrideAux,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAux = ElementOutput,
+  class ElementBias = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombPerColBiasEltActAux =
+  Sm90EVT<Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>,
+    Sm90EVT<XeAuxStore<ElementAux, StrideAux, RoundStyle>,
+      XeLinCombPerColBias<ElementCompute, ElementCompute, ElementBias, ElementSource, ElementScalar, RoundStyle>
+    >
+  >;
+
+template <
+  class GmemLayoutTagAux,
+  template <class> class ActivationFn,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAux,
+  class ElementBias,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentAux,
+  int AlignmentBias,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombPerColBiasEltActAux<
+      GmemLayoutTagAux, ActivationFn, ElementOutput_, ElementCompute_,
+      ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : XeLinCombPerColBiasEltActAux<
+      cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, ActivationFn,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type,
+      ElementCompute_, ElementAux, ElementBias, ElementSource, ElementScalar, RoundStyle
+    > {
+
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+
+  using Impl =
+    XeLinCombPerColBiasEltActAux<
+      cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, ActivationFn,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type,
+      ElementCompute, ElementAux, ElementBias, ElementSource, ElementScalar, RoundStyle
+    >;
+  using Operation =
+    fusion::LinCombPerColBiasEltActAux<
+      GmemLayoutTagAux, ActivationFn, ElementOutput, ElementCompute,
+      ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using StrideBias = Stride<_0,_1,int64_t>;
+    ElementBias const* bias_ptr = nullptr;
+    StrideBias dBias = {};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    using StrideAux = cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>;
+    ElementAux* aux_ptr = nullptr;
+    StrideAux dAux = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : activation(store(beta * C + (alpha * acc + bias)))
+          {                 // unary op : store(beta * C + (alpha * acc + bias))
+            {                  // ternary op : beta * C + (alpha * acc + bias)
+              {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // ternary op : alpha * acc + bias
+                {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {bias_ptr, ElementBias(0), dBias}, // leaf args : bias
+                {}                  // ternary args : multiply_add
+              },                    // end ternary op
+              {}               // ternary args : multiply_add
+            },                 // end ternary op
+            {aux_ptr, dAux} // unary args : store
+          },                // end unary op
+          activation // unary args : activation
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+// D = alpha * acc + beta * C
+// amax = max(abs(elements in D))
+template<
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombAmax =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // D
+    Sm90EVT<XeScalarReduction<detail::amax, atomic_maximum, ElementAmax, ElementCompute, RoundStyle>, // amax
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // alpha * acc + beta * C
+    >
+  >;
+
+template <
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombAmax<ElementOutput_, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombAmax<typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_,
+                  ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombAmax<typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_,
+                             ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementAmax = ElementAmax_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombAmax<ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle_>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Reduced over all batches, filled with 0 by initialize_workspace
+    ElementAmax* amax_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity(amax(beta * C + alpha * acc))
+          {    // unary op : amax(beta * C + alpha * acc)
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            {amax_ptr, ElementCompute(0)} // unary args : amax
+          },   // end unary op
+          {} // unary args : identity
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+// D = alpha * acc + beta * C
+// row_reduction = reduce(D) along M, col_reduction = reduce(D) along N
+template<
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementReduction = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombRowColReduction =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // D
+    Sm90EVT<XeColReduction<RegReduceFn, GmemReduceFn, ElementReduction, ElementCompute, RoundStyle,
+                           Stride<_1,_0,int64_t>>, // col_reduction
+      Sm90EVT<XeRowReduction<RegReduceFn, GmemReduceFn, ElementReduction, ElementCompute, RoundStyle,
+                             Stride<_0,_1,int64_t>>, // row_reduction
+        Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // alpha * acc + beta * C
+      >
+    >
+  >;
+
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementReduction_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombRowColReduction<RegReduceFn, GmemReduceFn, ElementOutput_, ElementCompute_, ElementReduction_,
+                                   ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombRowColReduction<RegReduceFn, GmemReduceFn,
+                             typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_,
+                             ElementReduction_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombRowColReduction<RegReduceFn, GmemReduceFn,
+                                        typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type,
+                                        ElementCompute_, ElementReduction_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementReduction = ElementReduction_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombRowColReduction<RegReduceFn, GmemReduceFn, ElementOutput, ElementCompute,
+                                                   ElementReduction, ElementSource, ElementScalar, RoundStyle_>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Both outputs are optional and filled with reduction_identity by initialize_workspace
+    ElementCompute reduction_identity = ElementCompute(0);
+
+    using StrideRowReduction = Stride<_0,_1,int64_t>;
+    ElementReduction* row_reduction_ptr = nullptr;
+    StrideRowReduction dRowReduction = {};
+
+    using StrideColReduction = Stride<_1,_0,int64_t>;
+    ElementReduction* col_reduction_ptr = nullptr;
+    StrideColReduction dColReduction = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity(col_reduction(row_reduction(beta * C + alpha * acc)))
+          {    // unary op : col_reduction(row_reduction(beta * C + alpha * acc))
+            {    // unary op : row_reduction(beta * C + alpha * acc)
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              {row_reduction_ptr, reduction_identity, dRowReduction} // unary args : row_reduction
+            },   // end unary op
+            {col_reduction_ptr, reduction_identity, dColReduction} // unary args : col_reduction
+          },   // end unary op
+          {} // unary args : identity
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
 } // namespace cutlass::epilogue::fusion
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +35,11 @@
 
 #pragma once
 
+#include <sycl/sycl.hpp>
 #include "cutlass/cutlass.h"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/workspace.h"
 
 #include "cute/tensor.hpp"
 
@@ -47,6 +51,47 @@
 
 namespace cutlass::epilogue::fusion {
 
+namespace detail {
+
+// The Xe epilogue visits the accumulators one MMA atom at a time. A subgroup holds an 8x16 fragment where
+// value v of work-item `lane` is element (m + v, n + lane) of D, and (m, n) is the fragment origin. This
+// returns the origins of all the fragments of the calling subgroup, tiled like the D store.
+template <class Args>
+CUTLASS_DEVICE auto
+xe_fragment_coords(Args const& args) {
+  auto [M, N, K, L] = args.problem_shape_mnkl;
+  auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
+
+  Tensor mCrd_mnl = cute::get_pvc_tensor(make_shape(M,N,L));
+  // Tiling is done differently than in epilogue as we get in coordinates of subgroup in kernel
+  Tensor gCrd = local_tile(mCrd_mnl, select<0,1>(args.tile_shape_mnk), make_coord(m_coord,n_coord,l_coord));
+  return args.tiled_copy.get_thread_slice(args.thread_idx).partition_D(gCrd);                    // (CPY,CPY_M,CPY_N)
+}
+
+// Reduces a value over the work-items of the subgroup, leaving the result in every work-item
+template <template <class> class ReduceFn, class T>
+CUTLASS_DEVICE T
+xe_subgroup_reduce(T value) {
+  auto sg = syclcompat::get_nd_item<1>().get_sub_group();
+  ReduceFn<T> reduce_fn{};
+  CUTLASS_PRAGMA_UNROLL
+  for (int mask = IntelPVCEpilogue::SubgroupSize / 2; mask > 0; mask /= 2) {
+    value = reduce_fn(value, sycl::permute_group_by_xor(sg, value, mask));
+  }
+  return value;
+}
+
+// 2D block store of one 8x16 accumulator fragment for elements of the given width
+template <int Bits>
+struct XeFragmentStoreOp {
+  static_assert(Bits == 0, "No 2D block store for this element width.");
+};
+template <> struct XeFragmentStoreOp< 8> { using type = XE_2D_U8x8x16_ST_N; };
+template <> struct XeFragmentStoreOp<16> { using type = XE_2D_U16x8x16_ST_N; };
+template <> struct XeFragmentStoreOp<32> { using type = XE_2D_U32x8x16_ST_N; };
+
+} // namespace detail
+
 template <
   class Element,
   class StrideMNL,
@@ -205,4 +250,980 @@ struct XeAuxLoad {
   }
 };
 
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Broadcast Load Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Row vector broadcast: one value per column of D, e.g. a per-column bias
+template <
+  class ElementInput,
+  class ElementCompute = ElementInput,
+  class StrideMNL = Stride<_0,_1,_0>,
+  bool EnableNullptr = true // Fallback scalar broadcast for nullptr params
+>
+struct XeRowBroadcast {
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_1>{});
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementInput const* ptr_row = nullptr;
+    ElementInput null_default = ElementInput(0);
+    StrideMNL dRow = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeRowBroadcast() { }
+
+  CUTLASS_HOST_DEVICE
+  XeRowBroadcast(Params const& params, SharedStorage const&) : params(params) { }
+
+  Params params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_zero() const {
+    return EnableNullptr && params.ptr_row == nullptr && params.null_default == ElementInput(0);
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const&) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class RTensor>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CTensor tCcRow;                                                                                 // (CPY,CPY_M,CPY_N)
+    RTensor tCrRow;                                                                                          // (CPY_N)
+    int N;
+    Params const& params;
+
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcRow, RTensor&& tCrRow, int N, Params const& params)
+      : tCcRow(tCcRow), tCrRow(cute::forward<RTensor>(tCrRow)), N(N), params(params) { }
+
+    // Each work-item owns a single column of every fragment, so the vector is loaded once per column
+    CUTLASS_DEVICE void
+    begin() {
+      NumericConverter<ElementCompute, ElementInput> convert{};
+      int lane = get_sub_group_local_id();
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_n = 0; epi_n < size(tCrRow); ++epi_n) {
+        auto [m, n_base, l] = tCcRow(_, 0, epi_n).data().coord_;
+        int n = n_base + lane;
+        ElementInput value = params.null_default;
+        if (!(EnableNullptr && params.ptr_row == nullptr) && n < N) {
+          value = params.ptr_row[n + l * get<2>(params.dRow)];
+        }
+        tCrRow(epi_n) = convert(value);
+      }
+    }
+
+    template <typename ElementAccumulator, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const&, int epi_v, int epi_m, int epi_n) {
+      Array<ElementCompute, FragmentSize> frg_row;
+      frg_row.fill(tCrRow(epi_n));
+      return frg_row;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcRow = detail::xe_fragment_coords(args);
+    Tensor tCrRow = make_tensor<ElementCompute>(make_shape(size<2>(tCcRow)));
+
+    return ConsumerStoreCallbacks<decltype(tCcRow), decltype(tCrRow)>(
+      tCcRow, cute::move(tCrRow), get<1>(args.problem_shape_mnkl), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Column vector broadcast: one value per row of D, e.g. a per-row bias or scale
+template <
+  class ElementInput,
+  class ElementCompute = ElementInput,
+  class StrideMNL = Stride<_1,_0,_0>,
+  bool EnableNullptr = true // Fallback scalar broadcast for nullptr params
+>
+struct XeColBroadcast {
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{});
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementInput const* ptr_col = nullptr;
+    ElementInput null_default = ElementInput(0);
+    StrideMNL dCol = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeColBroadcast() { }
+
+  CUTLASS_HOST_DEVICE
+  XeColBroadcast(Params const& params, SharedStorage const&) : params(params) { }
+
+  Params params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_zero() const {
+    return EnableNullptr && params.ptr_col == nullptr && params.null_default == ElementInput(0);
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const&) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class RTensor>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CTensor tCcCol;                                                                                 // (CPY,CPY_M,CPY_N)
+    RTensor tCrCol;                                                                                   // (FRG_M,CPY_M)
+    int M;
+    Params const& params;
+
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcCol, RTensor&& tCrCol, int M, Params const& params)
+      : tCcCol(tCcCol), tCrCol(cute::forward<RTensor>(tCrCol)), M(M), params(params) { }
+
+    // Every work-item of a subgroup needs the same rows, so the loads are uniform across the subgroup
+    CUTLASS_DEVICE void
+    begin() {
+      NumericConverter<ElementCompute, ElementInput> convert{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_m = 0; epi_m < size<1>(tCrCol); ++epi_m) {
+        auto [m_base, n, l] = tCcCol(_, epi_m, 0).data().coord_;
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < size<0>(tCrCol); ++v) {
+          int m = m_base + v;
+          ElementInput value = params.null_default;
+          if (!(EnableNullptr && params.ptr_col == nullptr) && m < M) {
+            value = params.ptr_col[m + l * get<2>(params.dCol)];
+          }
+          tCrCol(v, epi_m) = convert(value);
+        }
+      }
+    }
+
+    template <typename ElementAccumulator, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const&, int epi_v, int epi_m, int epi_n) {
+      Array<ElementCompute, FragmentSize> frg_col;
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = 0; v < FragmentSize; ++v) {
+        frg_col[v] = tCrCol(v, epi_m);
+      }
+      return frg_col;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcCol = detail::xe_fragment_coords(args);
+    Tensor tCrCol = make_tensor<ElementCompute>(make_shape(size(args.tCrC), size<1>(tCcCol)));
+
+    return ConsumerStoreCallbacks<decltype(tCcCol), decltype(tCrCol)>(
+      tCcCol, cute::move(tCrCol), get<0>(args.problem_shape_mnkl), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Elementwise Store Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Stores its input to an auxiliary matrix, e.g. the pre-activation output, and forwards it unchanged
+template <
+  class Element,
+  class StrideMNL,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  class CopyOpR2G = typename detail::XeFragmentStoreOp<sizeof_bits_v<Element>>::type,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeAuxStore {
+  static_assert(cute::rank(StrideMNL{}) == 3, "StrideMNL must be rank-3: [M, N, L]");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+  };
+
+  using CopyThreadShape = Shape<_1, Int<IntelPVCEpilogue::SubgroupSize>>;
+  using Trait_Aux = Copy_Traits<CopyOpR2G, StrideMNL>;
+  using XE_Copy_Aux = decltype(make_tiled_copy(Copy_Atom<Trait_Aux, Element>{},
+                                               Layout<CopyThreadShape>{},
+                                               make_layout(shape_div(typename Trait_Aux::BlockShape{}, CopyThreadShape{}))));
+
+  // 2D block messages require the surface pitch to be a multiple of 16B, other surfaces are stored per work-item
+  static constexpr int BlockCopyAlignment = 128 / sizeof_bits_v<Element>;
+
+  struct Params {
+    XE_Copy_Aux xe_store_aux;
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+    bool use_block_store = true;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+
+    bool use_block_store = cutlass::detail::check_alignment<BlockCopyAlignment>(make_shape(M, N, L), args.dAux);
+    auto mAux = make_tensor(make_gmem_ptr(args.ptr_aux), make_layout(make_shape(M, N, L), args.dAux));
+    XE_Copy_Aux xe_store_aux = make_tiled_copy(Copy_Atom<Trait_Aux, Element>{}.with(mAux),
+                                               Layout<CopyThreadShape>{},
+                                               make_layout(shape_div(typename Trait_Aux::BlockShape{}, CopyThreadShape{})));
+
+    return {xe_store_aux, args.ptr_aux, args.dAux, use_block_store};
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeAuxStore() { }
+
+  CUTLASS_HOST_DEVICE
+  XeAuxStore(Params const& params, SharedStorage const&) : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const&) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class RTensor, class ProblemShapeMNKL>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CTensor tCcAux;                                                                                 // (CPY,CPY_M,CPY_N)
+    RTensor tC_rAux;                                                                                             // (CPY)
+    ProblemShapeMNKL problem_shape_mnkl;
+    Params const* params_ptr;
+
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcAux, RTensor&& tC_rAux, ProblemShapeMNKL problem_shape_mnkl,
+                           Params const* params_ptr)
+      : tCcAux(tCcAux), tC_rAux(cute::forward<RTensor>(tC_rAux)), problem_shape_mnkl(problem_shape_mnkl),
+        params_ptr(params_ptr) { }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));                          // (EPI_V)
+      tC_rAux_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    // The fragment is complete once all of its values have been visited
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_aux == nullptr) {
+          return;
+        }
+      }
+
+      if (params_ptr->use_block_store) {
+        copy(params_ptr->xe_store_aux, tC_rAux, tCcAux(_, epi_m, epi_n));
+        return;
+      }
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m_base, n_base, l] = tCcAux(_, epi_m, epi_n).data().coord_;
+      int n = n_base + get_sub_group_local_id();
+      if (n >= N) {
+        return;
+      }
+
+      auto const& dAux = params_ptr->dAux;
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = 0; v < size(tC_rAux); ++v) {
+        int m = m_base + v;
+        if (m < M) {
+          params_ptr->ptr_aux[m * get<0>(dAux) + n * get<1>(dAux) + l * get<2>(dAux)] = tC_rAux(v);
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcAux = detail::xe_fragment_coords(args);
+    Tensor trAux = make_tensor_like<Element>(args.tCrC);
+
+    return ConsumerStoreCallbacks<decltype(tCcAux), decltype(trAux), decltype(args.problem_shape_mnkl)>(
+      tCcAux, cute::move(trAux), args.problem_shape_mnkl, params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Reduction Store Operations
+//
+// Partial results are combined within a subgroup and then reduced into global memory with GmemReduceFn, which
+// must be atomic since workgroups are not guaranteed to run concurrently. The output is filled with the
+// reduction identity in initialize_workspace unless CUTLASS_SKIP_REDUCTION_INIT is defined.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <class ElementOutput, class ElementCompute, class ProblemShape, class StrideMNL>
+cutlass::Status
+xe_initialize_reduction_output(ElementOutput* ptr, ElementCompute reduction_identity,
+                               ProblemShape const& problem_shape, StrideMNL const& stride,
+                               cudaStream_t stream, CudaHostAdapter* cuda_adapter) {
+#if !defined(CUTLASS_SKIP_REDUCTION_INIT)
+  if (ptr != nullptr) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    Layout mOut_layout = make_layout(make_shape(M,N,L), stride);
+    return fill_workspace(ptr, ElementOutput(reduction_identity), cosize(mOut_layout), stream, cuda_adapter);
+  }
+#endif
+  return cutlass::Status::kSuccess;
+}
+
+} // namespace detail
+
+// Scalar reduction, e.g. the absolute maximum of D
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_0,_0,_0>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeScalarReduction {
+private:
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_0>{});
+  static_assert(is_atomic<GmemReduceFn<ElementCompute>>::value, "non-atomic scalar reduction not supported yet");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_scalar = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dScalar = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return detail::xe_initialize_reduction_output(args.ptr_scalar, args.reduction_identity, problem_shape,
+                                                  args.dScalar, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params const params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class ProblemShapeMNKL>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcScalar, ProblemShapeMNKL problem_shape_mnkl, Params const& params)
+      : scalar(params.reduction_identity),
+        tCcScalar(tCcScalar),
+        problem_shape_mnkl(problem_shape_mnkl),
+        params(params) {}
+
+    ElementCompute scalar;
+    CTensor tCcScalar;                                                                              // (CPY,CPY_M,CPY_N)
+    ProblemShapeMNKL problem_shape_mnkl;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_scalar == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ReduceInput = RegReduceFn<ElementCompute>;
+      ConvertInput convert_input{};
+      ReduceInput reduce_input{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m_base, n_base, l] = tCcScalar(_, epi_m, epi_n).data().coord_;
+      int n = n_base + get_sub_group_local_id();
+
+      Array frg_I = convert_input(frg_input);
+      if (n < N) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < FragmentSize; ++v) {
+          if (m_base + v < M) {
+            scalar = reduce_input(scalar, frg_I[v]);
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_scalar == nullptr) {
+          return;
+        }
+      }
+
+      using ConvertI = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      using ReduceInput = GmemReduceFn<ElementOutput>;
+      ConvertI convert_I{};
+      ReduceInput reduce_input{};
+
+      ElementCompute sg_scalar = detail::xe_subgroup_reduce<RegReduceFn>(scalar);
+      if (get_sub_group_local_id() == 0) {
+        auto [m_base, n_base, l] = tCcScalar(_, 0, 0).data().coord_;
+        ElementOutput* ptr_scalar = params.ptr_scalar + l * get<2>(params.dScalar);
+        reduce_input(ptr_scalar, convert_I(sg_scalar));
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcScalar = detail::xe_fragment_coords(args);
+    return ConsumerStoreCallbacks<decltype(tCcScalar), decltype(args.problem_shape_mnkl)>(
+      tCcScalar, args.problem_shape_mnkl, params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Row vector reduction: reduces D along M, giving one value per column
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_0,_1,_0>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeRowReduction {
+private:
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_1>{});
+  static_assert(is_atomic<GmemReduceFn<ElementCompute>>::value, "non-atomic row reduction not supported yet");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_row = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dRow = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return detail::xe_initialize_reduction_output(args.ptr_row, args.reduction_identity, problem_shape,
+                                                  args.dRow, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeRowReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeRowReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params const params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class RTensor, class ProblemShapeMNKL>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcRow, RTensor&& tCrRow, ProblemShapeMNKL problem_shape_mnkl,
+                           Params const& params)
+      : tCcRow(tCcRow),
+        tCrRow(cute::forward<RTensor>(tCrRow)),
+        problem_shape_mnkl(problem_shape_mnkl),
+        params(params) {}
+
+    CTensor tCcRow;                                                                                 // (CPY,CPY_M,CPY_N)
+    RTensor tCrRow;                                                                                          // (CPY_N)
+    ProblemShapeMNKL problem_shape_mnkl;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      fill(tCrRow, params.reduction_identity);
+    }
+
+    // A work-item owns a single column of each fragment, so the rows are reduced in registers
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_row == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ReduceInput = RegReduceFn<ElementCompute>;
+      ConvertInput convert_input{};
+      ReduceInput reduce_input{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m_base, n_base, l] = tCcRow(_, epi_m, epi_n).data().coord_;
+      int n = n_base + get_sub_group_local_id();
+
+      Array frg_I = convert_input(frg_input);
+      if (n < N) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < FragmentSize; ++v) {
+          if (m_base + v < M) {
+            tCrRow(epi_n) = reduce_input(tCrRow(epi_n), frg_I[v]);
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_row == nullptr) {
+          return;
+        }
+      }
+
+      using ConvertI = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      using ReduceInput = GmemReduceFn<ElementOutput>;
+      ConvertI convert_I{};
+      ReduceInput reduce_input{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_n = 0; epi_n < size(tCrRow); ++epi_n) {
+        auto [m_base, n_base, l] = tCcRow(_, 0, epi_n).data().coord_;
+        int n = n_base + get_sub_group_local_id();
+        if (n < N) {
+          reduce_input(params.ptr_row + n + l * get<2>(params.dRow), convert_I(tCrRow(epi_n)));
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcRow = detail::xe_fragment_coords(args);
+    Tensor tCrRow = make_tensor<ElementCompute>(make_shape(size<2>(tCcRow)));
+
+    return ConsumerStoreCallbacks<decltype(tCcRow), decltype(tCrRow), decltype(args.problem_shape_mnkl)>(
+      tCcRow, cute::move(tCrRow), args.problem_shape_mnkl, params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Column vector reduction: reduces D along N, giving one value per row
+template <
+  template <class> class RegReduceFn,
+  template <class> class GmemReduceFn,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<_1,_0,_0>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeColReduction {
+private:
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{});
+  static_assert(is_atomic<GmemReduceFn<ElementCompute>>::value, "non-atomic column reduction not supported yet");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_col = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dCol = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return detail::xe_initialize_reduction_output(args.ptr_col, args.reduction_identity, problem_shape,
+                                                  args.dCol, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params const params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class RTensor, class ProblemShapeMNKL>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcCol, RTensor&& tCrCol, ProblemShapeMNKL problem_shape_mnkl,
+                           Params const& params)
+      : tCcCol(tCcCol),
+        tCrCol(cute::forward<RTensor>(tCrCol)),
+        problem_shape_mnkl(problem_shape_mnkl),
+        params(params) {}
+
+    CTensor tCcCol;                                                                                 // (CPY,CPY_M,CPY_N)
+    RTensor tCrCol;                                                                                   // (FRG_M,CPY_M)
+    ProblemShapeMNKL problem_shape_mnkl;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      fill(tCrCol, params.reduction_identity);
+    }
+
+    // Each work-item accumulates its own columns, the subgroup is reduced once at the end
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_col == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ReduceInput = RegReduceFn<ElementCompute>;
+      ConvertInput convert_input{};
+      ReduceInput reduce_input{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m_base, n_base, l] = tCcCol(_, epi_m, epi_n).data().coord_;
+      int n = n_base + get_sub_group_local_id();
+
+      Array frg_I = convert_input(frg_input);
+      if (n < N) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < FragmentSize; ++v) {
+          if (m_base + v < M) {
+            tCrCol(v, epi_m) = reduce_input(tCrCol(v, epi_m), frg_I[v]);
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_col == nullptr) {
+          return;
+        }
+      }
+
+      using ConvertI = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      using ReduceInput = GmemReduceFn<ElementOutput>;
+      ConvertI convert_I{};
+      ReduceInput reduce_input{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      int lane = get_sub_group_local_id();
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_m = 0; epi_m < size<1>(tCrCol); ++epi_m) {
+        auto [m_base, n_base, l] = tCcCol(_, epi_m, 0).data().coord_;
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < size<0>(tCrCol); ++v) {
+          ElementCompute sg_col = detail::xe_subgroup_reduce<RegReduceFn>(tCrCol(v, epi_m));
+          // Spread the global reductions of the rows over the work-items
+          if (lane == v && m_base + v < M) {
+            reduce_input(params.ptr_col + (m_base + v) + l * get<2>(params.dCol), convert_I(sg_col));
+          }
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Tensor tCcCol = detail::xe_fragment_coords(args);
+    Tensor tCrCol = make_tensor<ElementCompute>(make_shape(size(args.tCrC), size<1>(tCcCol)));
+
+    return ConsumerStoreCallbacks<decltype(tCcCol), decltype(tCrCol), decltype(args.problem_shape_mnkl)>(
+      tCcCol, cute::move(tCrCol), args.problem_shape_mnkl, params);
+  }
+};
+
 } // namespace cutlass::epilogue::fusion
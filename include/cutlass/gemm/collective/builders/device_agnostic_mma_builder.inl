@@ -36,6 +36,7 @@
 #include <cutlass/gemm/dispatch_policy.hpp>
 
 #include "cutlass/gemm/collective/device_agnostic_mma.hpp"
+#include "cutlass/gemm/collective/device_agnostic_mma_register_blocked.hpp"
 
 
 namespace cutlass::gemm::collective {
@@ -125,4 +126,132 @@ struct CollectiveBuilder<
   >;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Spreads the (MN, K) tile of one operand over all the work-items, with each copy moving the widest vector
+// that the operand alignment allows (at most 128 bits) along its contiguous mode.
+template <class Element, bool IsKMajor, int MN, int K, int Alignment, int NumThreads>
+constexpr auto make_device_agnostic_gmem_tiled_copy() {
+  constexpr int Vec = cute::min(Alignment, 128 / cute::sizeof_bits_v<Element>);
+  using CopyAtom = Copy_Atom<UniversalCopy<cute::uint_bit_t<Vec * cute::sizeof_bits_v<Element>>>, Element>;
+  if constexpr (IsKMajor) {
+    constexpr int ThrK = K / Vec;
+    constexpr int ThrMN = NumThreads / ThrK;
+    static_assert(K % Vec == 0 && NumThreads % ThrK == 0 && MN % ThrMN == 0,
+                  "The tile cannot be evenly split into vectorized copies over the workgroup.");
+    return make_tiled_copy(CopyAtom{},
+                           make_layout(make_shape(Int<ThrMN>{}, Int<ThrK>{}), make_stride(Int<ThrK>{}, _1{})),
+                           make_layout(make_shape(_1{}, Int<Vec>{})));
+  } else {
+    constexpr int ThrMN = MN / Vec;
+    constexpr int ThrK = NumThreads / ThrMN;
+    static_assert(MN % Vec == 0 && NumThreads % ThrMN == 0 && K % ThrK == 0,
+                  "The tile cannot be evenly split into vectorized copies over the workgroup.");
+    return make_tiled_copy(CopyAtom{},
+                           make_layout(make_shape(Int<ThrMN>{}, Int<ThrK>{}), make_stride(_1{}, Int<ThrMN>{})),
+                           make_layout(make_shape(Int<Vec>{}, _1{})));
+  }
+}
+
+} // namespace detail
+
+// Register blocked device agnostic mainloop: a 16x16 grid of work-items, each owning a contiguous
+// (BLK_M / 16, BLK_N / 16) tile of the accumulators
+template <
+  class ElementA,
+  class GmemLayoutATag,
+  int AlignmentA,
+  class ElementB,
+  class GmemLayoutBTag,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,
+  class StageCountType,
+  class KernelScheduleType
+  >
+struct CollectiveBuilder<
+  arch::Agnostic,
+  arch::OpMultiplyAdd,
+  ElementA,
+  GmemLayoutATag,
+  AlignmentA,
+  ElementB,
+  GmemLayoutBTag,
+  AlignmentB,
+  ElementAccumulator,
+  TileShape_MNK,
+  Shape<_1, _1, _1>,    // Cluster Shape
+  StageCountType,
+  KernelScheduleType,
+  cute::enable_if_t<
+     cute::is_same_v<KernelScheduleType, KernelDeviceAgnosticRegisterBlocked>>
+>{
+#ifndef CUTLASS_ENABLE_SYCL
+  static_assert(cutlass::detail::dependent_false<arch::Agnostic>,
+    "Trying to use device Agnostic pipeline without SYCL enabled");
+#endif
+
+  static constexpr int BLK_M = get<0>(TileShape_MNK{});
+  static constexpr int BLK_N = get<1>(TileShape_MNK{});
+  static constexpr int BLK_K = get<2>(TileShape_MNK{});
+
+  static constexpr int ThreadsM = 16;
+  static constexpr int ThreadsN = 16;
+  static constexpr int NumThreads = ThreadsM * ThreadsN;
+  static_assert(BLK_M % ThreadsM == 0 && BLK_N % ThreadsN == 0,
+    "The M and N tile sizes must be multiples of 16 for the register blocked device agnostic mainloop.");
+
+  // Per work-item register tile
+  static constexpr int RegM = BLK_M / ThreadsM;
+  static constexpr int RegN = BLK_N / ThreadsN;
+
+  static constexpr int Stages = cute::is_same_v<StageCountType, StageCountAuto> ? 2 : StageCountType::value;
+
+  using DispatchPolicy = MainloopDeviceAgnosticRegisterBlocked<Stages, KernelScheduleType>;
+
+  // Consecutive work-items walk M, and each one owns RegM consecutive rows and RegN consecutive columns
+  using TiledMMA = TiledMMA<MMA_Atom<UniversalFMA<ElementAccumulator, ElementA, ElementB, ElementAccumulator>>,
+                        Layout<Shape<Int<ThreadsM>, Int<ThreadsN>, _1>>,
+                        Tile<Layout<Shape<Int<ThreadsM>, Int<RegM>>, Stride<Int<RegM>, _1>>,
+                             Layout<Shape<Int<ThreadsN>, Int<RegN>>, Stride<Int<RegN>, _1>>,
+                             _1>>;
+
+  using GmemTiledCopyA = decltype(detail::make_device_agnostic_gmem_tiled_copy<
+      ElementA, cutlass::gemm::detail::is_k_major_A<GmemLayoutATag>(), BLK_M, BLK_K, AlignmentA, NumThreads>());
+  using GmemTiledCopyB = decltype(detail::make_device_agnostic_gmem_tiled_copy<
+      ElementB, cutlass::gemm::detail::is_k_major_B<GmemLayoutBTag>(), BLK_N, BLK_K, AlignmentB, NumThreads>());
+
+  // M and N major shared memory tiles, so the register tile of a work-item is a contiguous vector per k
+  using SmemLayoutAtomA = Layout<Shape<Int<BLK_M>, Int<BLK_K>>, Stride<_1, Int<BLK_M>>>;
+  using SmemLayoutAtomB = Layout<Shape<Int<BLK_N>, Int<BLK_K>>, Stride<_1, Int<BLK_N>>>;
+
+  using SmemCopyAtomA = Copy_Atom<AutoVectorizingCopyWithAssumedAlignment<
+    cute::gcd(128, RegM * cute::sizeof_bits_v<ElementA>)>, ElementA>;
+  using SmemCopyAtomB = Copy_Atom<AutoVectorizingCopyWithAssumedAlignment<
+    cute::gcd(128, RegN * cute::sizeof_bits_v<ElementB>)>, ElementB>;
+
+  using TransformA = cute::identity;
+  using TransformB = cute::identity;
+
+  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
+    DispatchPolicy,
+    TileShape_MNK,
+    ElementA,
+    cutlass::gemm::TagToStrideA_t<GmemLayoutATag>,
+    ElementB,
+    cutlass::gemm::TagToStrideB_t<GmemLayoutBTag>,
+    TiledMMA,
+    GmemTiledCopyA,
+    SmemLayoutAtomA,
+    SmemCopyAtomA,
+    TransformA,
+    GmemTiledCopyB,
+    SmemLayoutAtomB,
+    SmemCopyAtomB,
+    TransformB
+  >;
+};
+
 } // namespace cutlass::gemm::collective
@@ -34,10 +34,152 @@
 #include <cutlass/arch/arch.h>
 #include <cutlass/gemm/dispatch_policy.hpp>
 
+#include "cutlass/detail/collective.hpp"
 #include "cutlass/gemm/collective/collective_mma.hpp"
 
 namespace cutlass::gemm::collective {
 
+namespace detail {
+
+  // Xe DPAS atom for a combination of input and accumulator types
+  template <class ElementA, class ElementB, class ElementAccumulator>
+  struct XeMmaAtomSelector {
+    static_assert(cutlass::detail::dependent_false<ElementA>,
+      "Intel PVC builder supports bf16 and fp16 (float accumulation) and int8/uint8 (int32 accumulation) inputs, "
+      "and int8 or int4 mixed with bf16/fp16");
+  };
+
+  template <>
+  struct XeMmaAtomSelector<bfloat16_t, bfloat16_t, float> { using type = XE_8x16x16_F32BF16BF16F32_TT; };
+
+  template <>
+  struct XeMmaAtomSelector<half_t, half_t, float> { using type = XE_8x16x16_F32F16F16F32_TT; };
+
+  template <>
+  struct XeMmaAtomSelector<int8_t, int8_t, int32_t> { using type = XE_8x16x32_S32S8S8S32_TT; };
+
+  template <>
+  struct XeMmaAtomSelector<uint8_t, uint8_t, int32_t> { using type = XE_8x16x32_S32U8U8S32_TT; };
+
+  // 2D block load of operand A, for a subgroup tile of SG_M x Tile_K elements. M-major (column-major) 16-bit A is
+  // read with the transposing load, which only exists for 32-bit and wider data, so the data is transposed in pairs.
+  // A narrower than the MMA type is upconverted in registers, so it is read VNNI-packed like 16-bit B.
+  template <class Element, class GmemLayoutTag, int SG_M, int Tile_K, class ElementMma = Element>
+  constexpr auto
+  xe_gmem_tiled_copy_A() {
+    constexpr bool IsKMajor = cute::is_same_v<GmemLayoutTag, cutlass::layout::RowMajor>;
+    if constexpr (sizeof_bits_v<Element> < sizeof_bits_v<ElementMma>) {
+      static_assert(sizeof_bits_v<Element> == 8 && sizeof_bits_v<ElementMma> == 16 && IsKMajor,
+        "Intel PVC builder upconverts only K-major (row-major) 8-bit A to a 16-bit MMA type");
+      static_assert(SG_M % 32 == 0 && Tile_K % 32 == 0, "Upconverted 8-bit A is loaded in 32x32 blocks");
+      return XE_2D_U8x32x32_LD_V{};
+    } else if constexpr (sizeof_bits_v<Element> == 16) {
+      if constexpr (not IsKMajor) {
+        return XE_2D_U16x16x16_LD_T{};
+      } else if constexpr (SG_M % 32 == 0) {
+        if constexpr (Tile_K % 32 == 0) { return XE_2D_U16x32x32_LD_N{}; }
+        else                            { return XE_2D_U16x32x16_LD_N{}; }
+      } else if constexpr (SG_M % 16 == 0) {
+        if constexpr (Tile_K % 32 == 0) { return XE_2D_U16x16x32_LD_N{}; }
+        else                            { return XE_2D_U16x16x16_LD_N{}; }
+      } else {
+        if constexpr (Tile_K % 32 == 0) { return XE_2D_U16x8x32_LD_N{}; }
+        else                            { return XE_2D_U16x8x16_LD_N{}; }
+      }
+    } else {
+      static_assert(sizeof_bits_v<Element> == 8, "Unsupported element type for operand A");
+      static_assert(IsKMajor, "Intel PVC builder requires K-major (row-major) 8-bit A: there is no transposing "
+                              "2D block load for 8-bit data");
+      if constexpr (SG_M % 32 == 0) {
+        return XE_2D_U8x32x32_LD_N{};
+      } else if constexpr (SG_M % 16 == 0) {
+        return XE_2D_U8x16x32_LD_N{};
+      } else {
+        return XE_2D_U8x8x32_LD_N{};
+      }
+    }
+  }
+
+  // 2D block load of operand B, for a subgroup tile of Tile_K x SG_N elements. N-major (row-major) B is read
+  // with the VNNI load, K-major (column-major) B with the transposing load. 4-bit B upconverted in registers to the
+  // MMA type is read with the U4 load, which reorders the nibbles across the subgroup.
+  template <class Element, class GmemLayoutTag, int SG_N, int Tile_K, class ElementMma = Element>
+  constexpr auto
+  xe_gmem_tiled_copy_B() {
+    constexpr bool IsNMajor = cute::is_same_v<GmemLayoutTag, cutlass::layout::RowMajor>;
+    if constexpr (sizeof_bits_v<Element> < sizeof_bits_v<ElementMma>) {
+      static_assert(sizeof_bits_v<Element> == 4 && sizeof_bits_v<ElementMma> == 16 && IsNMajor,
+        "Intel PVC builder upconverts only N-major (row-major) 4-bit B to a 16-bit MMA type");
+      static_assert(SG_N % 64 == 0 && Tile_K % 64 == 0, "Upconverted 4-bit B is loaded in 64x64 blocks");
+      return XE_2D_U4x32x64_LD_N{};
+    } else if constexpr (sizeof_bits_v<Element> == 16) {
+      if constexpr (not IsNMajor) {
+        return XE_2D_U16x16x16_LD_T{};
+      } else if constexpr (SG_N % 32 == 0 && Tile_K % 32 == 0) {
+        return XE_2D_U16x32x32_LD_V{};
+      } else {
+        return XE_2D_U16x16x16_LD_V{};
+      }
+    } else {
+      static_assert(sizeof_bits_v<Element> == 8, "Unsupported element type for operand B");
+      static_assert(IsNMajor, "Intel PVC builder requires N-major (row-major) 8-bit B: there is no transposing "
+                              "2D block load for 8-bit data");
+      return XE_2D_U8x32x32_LD_V{};
+    }
+  }
+
+  // Subgroup layout and prefetch depth derived from the workgroup tile.
+  //
+  // Each subgroup owns an SG_M x SG_N block of the accumulators and, per k-tile, an SG_M x Tile_K slice of A and a
+  // Tile_K x SG_N slice of B, all held in registers. With the large register file a subgroup has 256 registers of
+  // 64 bytes, and the blocks below leave room for addressing and the epilogue (16-bit inputs, Tile_K = 32):
+  //
+  //   SG_M x SG_N | accumulators (fp32) | A + B fragments | total registers
+  //   ------------+---------------------+-----------------+----------------
+  //     32 x 64   |        128          |     32 + 64     |      224
+  //     32 x 32   |         64          |     32 + 32     |      128
+  //     16 x 64   |         64          |     16 + 64     |      144
+  //      8 x 32   |         16          |      8 + 32     |       56
+  //
+  // SG_M is 32 rows when the tile allows it. SG_N is the narrowest of 32, 64 and 128 columns that keeps the
+  // workgroup within 32 subgroups, so small tiles get more subgroups and large tiles the 32x64 block, as in the
+  // hand-tuned PVC benchmark configurations (256x256 -> 8x4, 128x512 -> 4x8, 256x128 -> 8x4 of 32x32, ...).
+  template <class TileShape_MNK, class ElementA, class ElementB>
+  struct XeSubgroupLayoutSelector {
+    static constexpr int Tile_M = decltype(get<0>(TileShape_MNK{}))::value;
+    static constexpr int Tile_N = decltype(get<1>(TileShape_MNK{}))::value;
+    static constexpr int Tile_K = decltype(get<2>(TileShape_MNK{}))::value;
+
+    static constexpr int MaxSubgroups = 32;
+    static constexpr int MaxAccumulatorBytes = 32 * 64 * 4;
+
+    static constexpr int SG_M = cute::min(32, Tile_M);
+    static constexpr int SGs_M = Tile_M / SG_M;
+
+    static constexpr int select_sg_n() {
+      for (int sg_n = 32; sg_n <= 128; sg_n *= 2) {
+        int const n = cute::min(sg_n, Tile_N);
+        if (SGs_M * (Tile_N / n) <= MaxSubgroups) {
+          return n;
+        }
+      }
+      return 0;
+    }
+    static constexpr int SG_N = select_sg_n();
+    static_assert(SG_N > 0, "Workgroup tile is too large for 32 subgroups");
+    static constexpr int SGs_N = Tile_N / SG_N;
+
+    static_assert(Tile_M % SG_M == 0 && Tile_N % SG_N == 0, "Workgroup tile must be a multiple of the subgroup tile");
+    static_assert(SG_M * SG_N * 4 <= MaxAccumulatorBytes, "Subgroup accumulators exceed the register budget");
+
+    // The prefetches run Stages k-tiles ahead of the loads. Narrow k-tiles are cheap to prefetch and short to
+    // compute, so they get one more stage to keep the same amount of data in flight.
+    static constexpr int KTileBytes = Tile_K * cute::max(sizeof_bits_v<ElementA>, sizeof_bits_v<ElementB>) / 8;
+    static constexpr int Stages = KTileBytes >= 64 ? 3 : 4;
+  };
+
+} // namespace detail
+
   // Intel PVC 3 stage pipeline, using prefetch
   // Also the auto builder
 
@@ -68,9 +210,12 @@ struct CollectiveBuilder<
   KernelScheduleType,
   cute::enable_if_t<
     (cute::is_same_v<KernelScheduleType, KernelPVC> ||
-     cute::is_same_v<KernelScheduleType, KernelScheduleAuto>) &&  
-    cute::is_same_v<GmemLayoutATag, cutlass::layout::RowMajor> && // Different struct specialization because this will change copy atoms
-    cute::is_same_v<GmemLayoutBTag, cutlass::layout::RowMajor>
+     cute::is_same_v<KernelScheduleType, KernelPVCCooperative> ||
+     cute::is_same_v<KernelScheduleType, KernelScheduleAuto>) &&
+    (cute::is_same_v<GmemLayoutATag, cutlass::layout::RowMajor> ||
+     cute::is_same_v<GmemLayoutATag, cutlass::layout::ColumnMajor>) &&
+    (cute::is_same_v<GmemLayoutBTag, cutlass::layout::RowMajor> ||
+     cute::is_same_v<GmemLayoutBTag, cutlass::layout::ColumnMajor>)
   >
     >{
 
@@ -79,35 +224,58 @@ struct CollectiveBuilder<
           "Trying to use Intel pipeline on Non Intel hardware");
       #endif
       static_assert(is_static<TileShape_MNK>::value);
-      static_assert(cute::is_same_v<ElementA, bfloat16_t>, "Intel multi-stage pipeline requires ElementA to be of type bfloat16_t");
-      static_assert(cute::is_same_v<ElementB, bfloat16_t>, "Intel multi-stage pipeline requires ElementB to be of type bfloat16_t");
-      static_assert(cute::is_same_v<ElementAccumulator, float>, "Intel multi-stage pipeline requires ElementC to be of type float");
 
       //Prepare Template arguments required of CollectiveMainLoop
 
+      // Operands of different widths (int8 or int4 weights) run on the DPAS of the wider operand, with the narrow
+      // one upconverted in registers. The narrow operand may be a tuple that also carries its scale (and zero) types.
+      using ElementAMma = detail::deduce_mixed_width_dtype_t<0, ElementA>;
+      using ElementBMma = detail::deduce_mixed_width_dtype_t<0, ElementB>;
+      static constexpr bool IsMixedInput = not cute::is_same_v<ElementAMma, ElementBMma>;
+      using ElementMma = cute::conditional_t<(sizeof_bits_v<ElementAMma> >= sizeof_bits_v<ElementBMma>),
+                                             ElementAMma, ElementBMma>;
+      static_assert(not IsMixedInput || not cute::is_same_v<KernelScheduleType, KernelPVCCooperative>,
+        "The Intel PVC mixed-input mainloop only runs on the KernelPVC schedule");
+
+      using MmaAtom = typename detail::XeMmaAtomSelector<
+        cute::conditional_t<IsMixedInput, ElementMma, ElementAMma>,
+        cute::conditional_t<IsMixedInput, ElementMma, ElementBMma>,
+        ElementAccumulator>::type;
+
       using Tile_M = decltype(get<0>(TileShape_MNK{}));
       using Tile_N = decltype(get<1>(TileShape_MNK{}));
       using Tile_K = decltype(get<2>(TileShape_MNK{}));
-      using Atom_M = decltype(get<0>(typename MMA_Traits<XE_8x16x16_F32BF16BF16F32_TT>::Shape_MNK{}));
-      using Atom_N = decltype(get<1>(typename MMA_Traits<XE_8x16x16_F32BF16BF16F32_TT>::Shape_MNK{}));
-      using SGs_M = _8;
-      using SGs_N = _4;
+      using Atom_M = decltype(get<0>(typename MMA_Traits<MmaAtom>::Shape_MNK{}));
+      using Atom_N = decltype(get<1>(typename MMA_Traits<MmaAtom>::Shape_MNK{}));
+      using Atom_K = decltype(get<2>(typename MMA_Traits<MmaAtom>::Shape_MNK{}));
+      using SubgroupLayout = detail::XeSubgroupLayoutSelector<TileShape_MNK, ElementAMma, ElementBMma>;
+      using SGs_M = Int<SubgroupLayout::SGs_M>;
+      using SGs_N = Int<SubgroupLayout::SGs_N>;
       using Iters_M = decltype(Tile_M{} / Atom_M{} / SGs_M{});
       using Iters_N = decltype(Tile_N{} / Atom_N{} / SGs_N{});
       using Stride_M = decltype(Iters_M{} * Atom_M{});
       using Stride_N = decltype(Iters_N{} * Atom_N{});
 
+      static_assert(Tile_K{} % Atom_K{} == 0, "The K extent of the tile must be a multiple of the MMA atom K");
+
       using TiledMma =
-          TiledMMA<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
+          TiledMMA<MMA_Atom<MmaAtom>,
                    Layout<Shape<SGs_M, SGs_N, _1>, Stride<SGs_N, _1, _0>>,
                    Tile<Layout<Shape<Atom_M, SGs_M, Iters_M>, Stride<_1, Stride_M, Atom_M>>,
                         Layout<Shape<Atom_N, SGs_N, Iters_N>, Stride<_1, Stride_N, Atom_N>>, Tile_K>>;
       
-      static constexpr int PipelineStages = 3;
-      using DispatchPolicy = cutlass::gemm::MainloopIntelPVC<PipelineStages>;
+      static constexpr int PipelineStages = SubgroupLayout::Stages;
+      using KernelSchedule = cute::conditional_t<cute::is_same_v<KernelScheduleType, KernelScheduleAuto>,
+                                                 KernelPVC, KernelScheduleType>;
+      using DispatchPolicy = cute::conditional_t<IsMixedInput,
+                                                 cutlass::gemm::MainloopIntelPVCMixedPrecision<PipelineStages>,
+                                                 cutlass::gemm::MainloopIntelPVC<PipelineStages, KernelSchedule>>;
 
-      using GmemTiledCopyA = XE_2D_U16x16x16_LD_N;
-      using GmemTiledCopyB = XE_2D_U16x16x16_LD_V;
+      // Largest 2D block loads that fit the subgroup tile, transposed or VNNI-packed as the layouts require
+      using GmemTiledCopyA = decltype(detail::xe_gmem_tiled_copy_A<
+        ElementAMma, GmemLayoutATag, decltype(Tile_M{} / SGs_M{})::value, Tile_K::value, ElementMma>());
+      using GmemTiledCopyB = decltype(detail::xe_gmem_tiled_copy_B<
+        ElementBMma, GmemLayoutBTag, decltype(Tile_N{} / SGs_N{})::value, Tile_K::value, ElementMma>());
 
       //PVC pipeline does not use shared memory
       using SmemLayoutAtomA = void; 
@@ -62,11 +62,16 @@
 
 #if defined(SYCL_INTEL_TARGET)
 #include "cutlass/gemm/collective/xe_mma.hpp"
+#include "cutlass/gemm/collective/xe_array_mma.hpp"
 #include "cutlass/gemm/collective/xe_mma_mixed_input.hpp"
+#include "cutlass/gemm/collective/xe_mma_fp8.hpp"
+#include "cutlass/gemm/collective/xe_mma_blockwise_scaling.hpp"
+#include "cutlass/gemm/collective/xe_mma_slm.hpp"
 #endif
 
 #if defined(CUTLASS_ENABLE_SYCL)
 #include "cutlass/gemm/collective/device_agnostic_mma.hpp"
+#include "cutlass/gemm/collective/device_agnostic_mma_register_blocked.hpp"
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
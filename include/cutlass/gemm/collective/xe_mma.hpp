@@ -32,6 +32,8 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/collective/xe_mma_utils.hpp"
 
 #include "cute/algorithm/functional.hpp"
 #include "cute/atom/mma_atom.hpp"
@@ -138,6 +140,25 @@ struct CollectiveMma<MainloopIntelPVC<Stages, Schedule>, TileShape_, ElementA_,
     return Params{mA_mkl, mB_nkl};
   }
 
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shape,
+      Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return detail::xe_check_block_copy_alignment<ElementA, ElementB>(problem_shape_MNKL, args.dA, args.dB);
+  }
+
+  /// Prefetch the first Stages k-tiles of the A and B panels of a workgroup tile, starting at k-tile `k_start`.
+  template <class TensorA, class TensorB>
+  CUTLASS_DEVICE void prefetch_k_tiles(TensorA gA, TensorB gB, int k_start, int k_tile_count, int thread_idx,
+                                       Params const &mainloop) {
+    detail::xe_prefetch_k_tiles<DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs>(
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, k_start, k_tile_count, thread_idx);
+  }
+
   /// Perform a subgroup-scoped matrix multiply-accumulate
   template <class FrgTensorD, class TensorA, class TensorB, class FrgTensorC, class KTileIterator, class ResidueMNK,
             class BlkCoord>
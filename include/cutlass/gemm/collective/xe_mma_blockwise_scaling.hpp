@@ -0,0 +1,269 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/float8.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/collective/xe_mma_utils.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Blockwise-scaled mainloop for 8-bit operands (int8 x int8 or FP8 x FP8). Operands are upconverted in registers to
+// the 16-bit MMA type exactly as in MainloopIntelPVCFP8; products of int8 values within a K block stay exact in the
+// fp32 partial accumulator, so both input families share the fp16/bf16 DPAS path and a floating point result.
+//
+// A holds one scale per ScaleGranularityM x ScaleGranularityK block and B one per ScaleGranularityN x
+// ScaleGranularityK block. The MMA accumulates each K block into a partial accumulator, which is multiplied by the
+// scales of its A and B blocks and added to the result whenever the mainloop crosses a K block boundary.
+template <int Stages, int ScaleGranularityM_, int ScaleGranularityN_, int ScaleGranularityK_, class Schedule,
+          class TileShape_, class ElementA_, class StrideA_, class ElementB_, class StrideB_, class TiledMma_,
+          class GmemTiledCopyA_, class SmemLayoutAtomA_, class SmemCopyAtomA_, class TransformA_,
+          class GmemTiledCopyB_, class SmemLayoutAtomB_, class SmemCopyAtomB_, class TransformB_>
+struct CollectiveMma<MainloopIntelPVCBlockScaling<Stages, ScaleGranularityM_, ScaleGranularityN_, ScaleGranularityK_, Schedule>,
+                     TileShape_, ElementA_, StrideA_, ElementB_, StrideB_, TiledMma_, GmemTiledCopyA_, SmemLayoutAtomA_,
+                     SmemCopyAtomA_, TransformA_, GmemTiledCopyB_, SmemLayoutAtomB_, SmemCopyAtomB_, TransformB_> {
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCBlockScaling<Stages, ScaleGranularityM_, ScaleGranularityN_, ScaleGranularityK_, Schedule>;
+  using WorkgroupTileShape = TileShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using ElementBlockScale = ElementAccumulator;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using SmemLayoutAtomA = SmemLayoutAtomA_;
+  using SmemLayoutAtomB = SmemLayoutAtomB_;
+  using SmemCopyAtomA = SmemCopyAtomA_;
+  using SmemCopyAtomB = SmemCopyAtomB_;
+  using TransformA = TransformA_;
+  using TransformB = TransformB_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+  using MmaType = typename TiledMma::ValTypeA; // ValTypeA and ValTypeB are always same and reflects MMA type on intel Xe
+
+  template <class T>
+  static constexpr bool is_fp8_v = cute::is_same_v<T, float_e4m3_t> || cute::is_same_v<T, float_e5m2_t>;
+
+  static_assert((cute::is_same_v<ElementA, int8_t> && cute::is_same_v<ElementB, int8_t>) ||
+                (is_fp8_v<ElementA> && is_fp8_v<ElementB>),
+    "MainloopIntelPVCBlockScaling supports int8 x int8 and FP8 x FP8 operands.");
+  static_assert(cute::is_same_v<MmaType, half_t> || cute::is_same_v<MmaType, bfloat16_t>,
+    "MainloopIntelPVCBlockScaling upconverts to fp16 or bf16, so the TiledMma must use a 16-bit DPAS atom.");
+  static_assert(cute::is_same_v<ElementAccumulator, float>, "MainloopIntelPVCBlockScaling requires fp32 accumulators.");
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  static constexpr auto Num_SGs = ATOM_N * ATOM_M * ATOM_K;
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+
+  static constexpr int ScaleGranularityM = ScaleGranularityM_ == 0 ? int(BLK_M) : ScaleGranularityM_;
+  static constexpr int ScaleGranularityN = ScaleGranularityN_ == 0 ? int(BLK_N) : ScaleGranularityN_;
+  static constexpr int ScaleGranularityK = ScaleGranularityK_;
+  static constexpr int KTilesPerScaleBlock = ScaleGranularityK / int(BLK_K);
+
+  static_assert(BLK_M % ScaleGranularityM == 0, "Scaling granularity must evenly divide tile shape along M.");
+  static_assert(BLK_N % ScaleGranularityN == 0, "Scaling granularity must evenly divide tile shape along N.");
+  static_assert(ScaleGranularityK % BLK_K == 0, "Scaling granularity along K must be a multiple of the tile K.");
+
+  using CopyThreadShape = Shape<_1, Int<SubgroupSize>>;
+  using traits_load_A = Copy_Traits<GmemTiledCopyA, StrideA>;
+  using atom_load_A = Copy_Atom<traits_load_A, ElementA>;
+  using traits_load_B = Copy_Traits<GmemTiledCopyB, StrideB>;
+  using atom_load_B = Copy_Atom<traits_load_B, ElementB>;
+
+  static_assert(sizeof_bits_v<typename traits_load_A::CopyInternalType> == 8 &&
+                sizeof_bits_v<typename traits_load_B::CopyInternalType> == 8,
+    "MainloopIntelPVCBlockScaling requires 1-byte 2D block loads for A and B.");
+
+  using  TensorMKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementA const*>(nullptr)), make_shape(0,0,0), StrideA{}));   //(m, k)
+  using  TensorNKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementB const*>(nullptr)), make_shape(0,0,0), StrideB{}));   //(n, k)
+  using  TensorScale = decltype(make_tensor(make_gmem_ptr(static_cast<ElementBlockScale const*>(nullptr)), make_layout(make_shape(0,0,0))));  //(mn, k, l)
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B;
+    StrideB dB;
+    // Block scales of A, packed (ceil(M / ScaleGranularityM), ceil(K / ScaleGranularityK), L) with M fastest
+    ElementBlockScale const* ptr_scale_A = nullptr;
+    // Block scales of B, packed (ceil(N / ScaleGranularityN), ceil(K / ScaleGranularityK), L) with N fastest
+    ElementBlockScale const* ptr_scale_B = nullptr;
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB;
+    TensorScale mScaleA;
+    TensorScale mScaleB;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
+                              make_layout(make_shape(N, K, L), args.dB));
+
+    int const scale_k = ceil_div(K, ScaleGranularityK);
+    auto mScaleA = make_tensor(make_gmem_ptr(args.ptr_scale_A),
+                               make_layout(make_shape(ceil_div(M, ScaleGranularityM), scale_k, L)));
+    auto mScaleB = make_tensor(make_gmem_ptr(args.ptr_scale_B),
+                               make_layout(make_shape(ceil_div(N, ScaleGranularityN), scale_k, L)));
+
+    return Params{mA_mkl, mB_nkl, mScaleA, mScaleB};
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shape,
+      Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return detail::xe_check_block_copy_alignment<ElementA, ElementB>(problem_shape_MNKL, args.dA, args.dB);
+  }
+
+  /// Prefetch the first Stages k-tiles of the A and B panels of a workgroup tile, starting at k-tile `k_start`.
+  template <class TensorA, class TensorB>
+  CUTLASS_DEVICE void prefetch_k_tiles(TensorA gA, TensorB gB, int k_start, int k_tile_count, int thread_idx,
+                                       Params const &mainloop) {
+    detail::xe_prefetch_k_tiles<DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs>(
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, k_start, k_tile_count, thread_idx);
+  }
+
+  /// Perform a subgroup-scoped matrix multiply-accumulate
+  template <class FrgTensorD, class TensorA, class TensorB, class FrgTensorC, class KTileIterator, class ResidueMNK,
+            class BlkCoord>
+  CUTLASS_DEVICE void operator()(FrgTensorD &accum, TensorA gA, TensorB gB, FrgTensorC const &src_accum,
+                                 KTileIterator k_tile_iter, int k_tile_count, ResidueMNK residue_mnk,
+                                 BlkCoord const &blk_coord, int const &K_start, int thread_idx, char *smem_buf,
+                                 Params const &mainloop) {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    (void)residue_mnk;
+    (void)smem_buf;
+
+    TiledMma tiled_mma;
+
+    // Partial accumulator of the current K block, and the tile coordinates of this work-item's accumulators, used
+    // to look up the block scales
+    Tensor block_accum = make_fragment_like(accum);
+    clear(block_accum);
+    Tensor tCcD = tiled_mma.get_slice(thread_idx).partition_C(make_identity_tensor(take<0,2>(WorkgroupTileShape{})));
+
+    int const m_offset = get<0>(blk_coord) * BLK_M;
+    int const n_offset = get<1>(blk_coord) * BLK_N;
+    int const l_coord = get<3>(blk_coord);
+    int const last_scale_m = size<0>(mainloop.mScaleA) - 1;
+    int const last_scale_n = size<0>(mainloop.mScaleB) - 1;
+    bool const has_scale_A = mainloop.mScaleA.data().get() != nullptr;
+    bool const has_scale_B = mainloop.mScaleB.data().get() != nullptr;
+
+    auto rescale = [&](int k_block) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        // Accumulators past the end of the problem are never stored, so clamping their scale index is enough
+        int const scale_m = cute::min((m_offset + int(get<0>(tCcD(i)))) / ScaleGranularityM, last_scale_m);
+        int const scale_n = cute::min((n_offset + int(get<1>(tCcD(i)))) / ScaleGranularityN, last_scale_n);
+        ElementBlockScale scale_a = has_scale_A ? mainloop.mScaleA(scale_m, k_block, l_coord) : ElementBlockScale(1);
+        ElementBlockScale scale_b = has_scale_B ? mainloop.mScaleB(scale_n, k_block, l_coord) : ElementBlockScale(1);
+        accum(i) += block_accum(i) * (scale_a * scale_b);
+      }
+      clear(block_accum);
+    };
+
+    const auto k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+    const int k_end_idx = k_tile_count + k_start_idx;
+
+    detail::xe_upconvert_mma_k_tiles<MmaType, DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs, SubgroupSize>(
+      tiled_mma,
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, block_accum, k_start_idx, k_tile_count, thread_idx,
+      [&](int k_tile) {
+        // Split-K and stream-K ranges may start or end inside a K block; scaling is linear, so a partial block is
+        // rescaled with the scales of the block it belongs to
+        if ((k_tile + 1) % KTilesPerScaleBlock == 0 || k_tile + 1 == k_end_idx) {
+          rescale(k_tile / KTilesPerScaleBlock);
+        }
+      });
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,262 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/float8.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/collective/xe_mma_utils.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// FP8 x FP8 mainloop. Xe has no FP8 DPAS, so both operands are loaded with 1-byte 2D block loads, upconverted in
+// registers to the 16-bit MMA type of the TiledMma (fp16 or bf16, both of which hold every E4M3 and E5M2 value
+// exactly) and fed to the regular DPAS atoms.
+//
+// Scales are constant along K, so they are applied once per tile to the fp32 accumulators rather than to every
+// k-tile of the operands: a per-tensor scale for each operand, and optionally a per-row scale of A (one per M) and
+// a per-column scale of B (one per N).
+template <int Stages, class Schedule, class TileShape_, class ElementA_, class StrideA_, class ElementB_, class StrideB_,
+          class TiledMma_, class GmemTiledCopyA_, class SmemLayoutAtomA_, class SmemCopyAtomA_, class TransformA_,
+          class GmemTiledCopyB_, class SmemLayoutAtomB_, class SmemCopyAtomB_, class TransformB_>
+struct CollectiveMma<MainloopIntelPVCFP8<Stages, Schedule>, TileShape_, ElementA_, StrideA_, ElementB_, StrideB_, TiledMma_,
+                     GmemTiledCopyA_, SmemLayoutAtomA_, SmemCopyAtomA_, TransformA_, GmemTiledCopyB_, SmemLayoutAtomB_,
+                     SmemCopyAtomB_, TransformB_> {
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCFP8<Stages, Schedule>;
+  using WorkgroupTileShape = TileShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using SmemLayoutAtomA = SmemLayoutAtomA_;
+  using SmemLayoutAtomB = SmemLayoutAtomB_;
+  using SmemCopyAtomA = SmemCopyAtomA_;
+  using SmemCopyAtomB = SmemCopyAtomB_;
+  using TransformA = TransformA_;
+  using TransformB = TransformB_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+  using MmaType = typename TiledMma::ValTypeA; // ValTypeA and ValTypeB are always same and reflects MMA type on intel Xe
+  using ElementScale = float;
+
+  static_assert(cute::is_same_v<ElementA, float_e4m3_t> || cute::is_same_v<ElementA, float_e5m2_t>,
+    "MainloopIntelPVCFP8 requires an FP8 A operand.");
+  static_assert(cute::is_same_v<ElementB, float_e4m3_t> || cute::is_same_v<ElementB, float_e5m2_t>,
+    "MainloopIntelPVCFP8 requires an FP8 B operand.");
+  static_assert(cute::is_same_v<MmaType, half_t> || cute::is_same_v<MmaType, bfloat16_t>,
+    "MainloopIntelPVCFP8 upconverts to fp16 or bf16, so the TiledMma must use a 16-bit DPAS atom.");
+  static_assert(cute::is_same_v<ElementAccumulator, float>, "MainloopIntelPVCFP8 requires fp32 accumulators.");
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  static constexpr auto Num_SGs = ATOM_N * ATOM_M * ATOM_K;
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+
+  using CopyThreadShape = Shape<_1, Int<SubgroupSize>>;
+  using traits_load_A = Copy_Traits<GmemTiledCopyA, StrideA>;
+  using atom_load_A = Copy_Atom<traits_load_A, ElementA>;
+  using traits_load_B = Copy_Traits<GmemTiledCopyB, StrideB>;
+  using atom_load_B = Copy_Atom<traits_load_B, ElementB>;
+
+  static_assert(sizeof_bits_v<typename traits_load_A::CopyInternalType> == 8 &&
+                sizeof_bits_v<typename traits_load_B::CopyInternalType> == 8,
+    "MainloopIntelPVCFP8 requires 1-byte 2D block loads for A and B.");
+
+  using  TensorMKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementA const*>(nullptr)), make_shape(0,0,0), StrideA{}));   //(m, k)
+  using  TensorNKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementB const*>(nullptr)), make_shape(0,0,0), StrideB{}));   //(n, k)
+  using  TensorScale = decltype(make_tensor(make_gmem_ptr(static_cast<ElementScale const*>(nullptr)), make_layout(make_shape(0,0))));  //(mn, l)
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B;
+    StrideB dB;
+    // Per-tensor scales of A and B
+    ElementScale scale_A = ElementScale(1);
+    ElementScale scale_B = ElementScale(1);
+    // Optional per-row scales of A, packed (M, L), and per-column scales of B, packed (N, L)
+    ElementScale const* ptr_row_scale_A = nullptr;
+    ElementScale const* ptr_col_scale_B = nullptr;
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB;
+    ElementScale tensor_scale;
+    TensorScale mScaleA;
+    TensorScale mScaleB;
+    bool has_row_scale_A;
+    bool has_col_scale_B;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
+                              make_layout(make_shape(N, K, L), args.dB));
+
+    auto mScaleA = make_tensor(make_gmem_ptr(args.ptr_row_scale_A), make_layout(make_shape(M, L)));
+    auto mScaleB = make_tensor(make_gmem_ptr(args.ptr_col_scale_B), make_layout(make_shape(N, L)));
+
+    return Params{mA_mkl, mB_nkl, args.scale_A * args.scale_B, mScaleA, mScaleB,
+                  args.ptr_row_scale_A != nullptr, args.ptr_col_scale_B != nullptr};
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shape,
+      Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return detail::xe_check_block_copy_alignment<ElementA, ElementB>(problem_shape_MNKL, args.dA, args.dB);
+  }
+
+  /// Prefetch the first Stages k-tiles of the A and B panels of a workgroup tile, starting at k-tile `k_start`.
+  template <class TensorA, class TensorB>
+  CUTLASS_DEVICE void prefetch_k_tiles(TensorA gA, TensorB gB, int k_start, int k_tile_count, int thread_idx,
+                                       Params const &mainloop) {
+    detail::xe_prefetch_k_tiles<DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs>(
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, k_start, k_tile_count, thread_idx);
+  }
+
+  /// Applies the per-tensor, per-row and per-column scales to the accumulators of the workgroup tile at blk_coord
+  template <class FrgTensorD, class BlkCoord>
+  CUTLASS_DEVICE static void
+  apply_scales(FrgTensorD &accum, BlkCoord const &blk_coord, int thread_idx, Params const &mainloop) {
+    if (!mainloop.has_row_scale_A && !mainloop.has_col_scale_B) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        accum(i) *= mainloop.tensor_scale;
+      }
+      return;
+    }
+
+    // The scales are gathered per work-item, so partition the tile coordinates with this work-item's slice of the MMA
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(thread_idx);
+    Tensor tCcD = thr_mma.partition_C(make_identity_tensor(take<0,2>(WorkgroupTileShape{})));    // (MMA,MMA_M,MMA_N)
+
+    int const m_offset = get<0>(blk_coord) * BLK_M;
+    int const n_offset = get<1>(blk_coord) * BLK_N;
+    int const l_coord = get<3>(blk_coord);
+    int const M = size<0>(mainloop.mScaleA);
+    int const N = size<0>(mainloop.mScaleB);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(accum); ++i) {
+      int const m = m_offset + get<0>(tCcD(i));
+      int const n = n_offset + get<1>(tCcD(i));
+      ElementScale scale = mainloop.tensor_scale;
+      if (mainloop.has_row_scale_A && m < M) {
+        scale *= mainloop.mScaleA(m, l_coord);
+      }
+      if (mainloop.has_col_scale_B && n < N) {
+        scale *= mainloop.mScaleB(n, l_coord);
+      }
+      accum(i) *= scale;
+    }
+  }
+
+  /// Perform a subgroup-scoped matrix multiply-accumulate
+  template <class FrgTensorD, class TensorA, class TensorB, class FrgTensorC, class KTileIterator, class ResidueMNK,
+            class BlkCoord>
+  CUTLASS_DEVICE void operator()(FrgTensorD &accum, TensorA gA, TensorB gB, FrgTensorC const &src_accum,
+                                 KTileIterator k_tile_iter, int k_tile_count, ResidueMNK residue_mnk,
+                                 BlkCoord const &blk_coord, int const &K_start, int thread_idx, char *smem_buf,
+                                 Params const &mainloop) {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    (void)residue_mnk;
+    (void)smem_buf;
+
+    const auto k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+    detail::xe_upconvert_mma_k_tiles<MmaType, DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs, SubgroupSize>(
+      TiledMma{},
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, accum, k_start_idx, k_tile_count, thread_idx, [](int) {});
+
+    apply_scales(accum, blk_coord, thread_idx, mainloop);
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,9 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/detail/collective.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/collective/xe_mma_utils.hpp"
 
 #include "cute/algorithm/functional.hpp"
 #include "cute/atom/mma_atom.hpp"
@@ -47,9 +50,9 @@ using namespace cute;
 template <
   int Stages,
   class TileShape_,
-  class ElementA_,
+  class ElementAOptionalTuple,
   class StrideA_,
-  class ElementB_,
+  class ElementBOptionalTuple,
   class StrideB_,
   class TiledMma_,
   class GmemTiledCopyA_,
@@ -63,9 +66,9 @@ template <
 struct CollectiveMma<
     MainloopIntelPVCMixedPrecision<Stages>,
     TileShape_,
-    ElementA_,
+    ElementAOptionalTuple,
     StrideA_,
-    ElementB_,
+    ElementBOptionalTuple,
     StrideB_,
     TiledMma_,
     GmemTiledCopyA_,
@@ -77,15 +80,41 @@ struct CollectiveMma<
     SmemCopyAtomB_,
     TransformB_>
 {
+public:
+  enum class ConversionMode {
+    DirectConvert,
+    ConvertAndScale,
+    ConvertAndScaleWithZero
+  };
+
+private:
+  using ScaleA = detail::deduce_mixed_width_dtype_t<1, ElementAOptionalTuple>;
+  using ScaleB = detail::deduce_mixed_width_dtype_t<1, ElementBOptionalTuple>;
+  using ZeroA = detail::deduce_mixed_width_dtype_t<2, ElementAOptionalTuple>;
+  using ZeroB = detail::deduce_mixed_width_dtype_t<2, ElementBOptionalTuple>;
+
+public:
+  static_assert(!(cute::is_tuple<ElementAOptionalTuple>::value && cute::is_tuple<ElementBOptionalTuple>::value),
+    "At most one of A and B can be a tuple. It must take the form {ElementOperand, [ElementScale], [ElementZero]}. "
+    "Inputs in [] are optional.");
+
   //
   // Type Aliases
   //
   using DispatchPolicy = MainloopIntelPVCMixedPrecision<Stages>;
   using WorkgroupTileShape = TileShape_;
-  using ElementA = ElementA_;
+  using ElementA = detail::deduce_mixed_width_dtype_t<0, ElementAOptionalTuple>;
   using StrideA = StrideA_;
-  using ElementB = ElementB_;
+  using ElementB = detail::deduce_mixed_width_dtype_t<0, ElementBOptionalTuple>;
   using StrideB = StrideB_;
+  static constexpr bool IsATransformed = cute::is_tuple<ElementAOptionalTuple>::value;
+  using ElementScale = cute::conditional_t<IsATransformed, ScaleA, ScaleB>;
+  using ElementZero = cute::conditional_t<IsATransformed, ZeroA, ZeroB>;
+  // For cases where we can't have a void type, we can use this to allow the code to compile when the scale / zero is void.
+  using NonVoidElementScale = cute::conditional_t<cute::is_void_v<ElementScale>, float, ElementScale>;
+  using NonVoidElementZero = cute::conditional_t<cute::is_void_v<ElementZero>, float, ElementZero>;
+  // Scales and zeros are always MN major, with one column per group of group_size elements along K
+  using StrideScale = cute::Stride<cute::Int<1>, int64_t, int64_t>;
   using TiledMma = TiledMma_;
   using ElementAccumulator = typename TiledMma::ValTypeC;
   using GmemTiledCopyA = GmemTiledCopyA_;
@@ -108,6 +137,30 @@ struct CollectiveMma<
                "MainloopIntelPVCMixedPrecision has the restriction that mixed dtype always converts the "
                "narrower input type to the larger one and performs GEMM using the DPAS for the larger input type.");
 
+private:
+  static constexpr ConversionMode
+  get_conversion_mode() {
+    if constexpr (cute::is_void_v<ElementScale>) {
+      return ConversionMode::DirectConvert;
+    }
+    else if constexpr (cute::is_void_v<ElementZero>) {
+      return ConversionMode::ConvertAndScale;
+    }
+    else {
+      return ConversionMode::ConvertAndScaleWithZero;
+    }
+  }
+
+public:
+  static constexpr ConversionMode KernelConversionMode = get_conversion_mode();
+  static constexpr bool ModeHasScales = KernelConversionMode == ConversionMode::ConvertAndScale ||
+                                        KernelConversionMode == ConversionMode::ConvertAndScaleWithZero;
+
+  static_assert(KernelConversionMode != ConversionMode::ConvertAndScaleWithZero ||
+                cute::is_same_v<ElementScale, ElementZero>, "ElementScale and ElementZero must be the same.");
+  static_assert(!ModeHasScales || cute::sizeof_bits_v<cute::conditional_t<IsATransformed, ElementA, ElementB>> <
+                                  cute::sizeof_bits_v<MmaType>, "Scales can only be applied to the narrower operand.");
+
   static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
 
   using MmaAtomShape = typename TiledMma::AtomShape_MNK;
@@ -144,17 +197,27 @@ struct CollectiveMma<
   using Copy_B = decltype(make_tiled_copy(atom_load_B{},
                                    Layout<CopyThreadShape>{},
                                    make_layout(shape_div(typename traits_load_B::BlockShape{}, CopyThreadShape{}))));
+  using TensorScale = decltype(make_tensor(make_gmem_ptr(static_cast<NonVoidElementScale const*>(nullptr)), make_shape(0,0,0), StrideScale{}));  //(mn, scale_k, l)
+  using TensorZero = decltype(make_tensor(make_gmem_ptr(static_cast<NonVoidElementZero const*>(nullptr)), make_shape(0,0,0), StrideScale{}));    //(mn, scale_k, l)
+
   // Host side kernel arguments
   struct Arguments {
     ElementA const* ptr_A;
     StrideA dA;
     ElementB const* ptr_B;
     StrideB dB;
+    ElementScale const* ptr_S = nullptr;
+    StrideScale dS{};
+    int group_size = 0;
+    ElementZero const* ptr_Z = nullptr;
   };
 
   struct Params {
     TensorMKL mA;
     TensorNKL mB;
+    TensorScale mS;
+    TensorZero mZ;
+    int group_size;
   };
 
   //
@@ -174,7 +237,68 @@ struct CollectiveMma<
                               make_layout(make_shape(M, K, L), args.dA));
     auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
                               make_layout(make_shape(N, K, L), args.dB));
-    return Params{mA_mkl, mB_nkl};
+
+    if constexpr (KernelConversionMode == ConversionMode::DirectConvert) {
+      return Params{mA_mkl, mB_nkl, {}, {}, 0};
+    }
+    else {
+      auto scale_mn = IsATransformed ? M : N;
+      auto scale_k = (K + args.group_size - 1) / args.group_size;
+      auto mS = make_tensor(make_gmem_ptr(static_cast<NonVoidElementScale const*>(args.ptr_S)),
+                            make_layout(make_shape(scale_mn, scale_k, L), args.dS));
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+        return Params{mA_mkl, mB_nkl, mS, {}, args.group_size};
+      }
+      else {
+        auto mZ = make_tensor(make_gmem_ptr(static_cast<NonVoidElementZero const*>(args.ptr_Z)),
+                              make_layout(make_shape(scale_mn, scale_k, L), args.dS));
+        return Params{mA_mkl, mB_nkl, mS, mZ, args.group_size};
+      }
+    }
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shape,
+      Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    bool check_mode_args = true;
+    if constexpr (KernelConversionMode == ConversionMode::DirectConvert) {
+      check_mode_args = check_mode_args && (args.ptr_S == nullptr);
+      check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
+    }
+    else {
+      // The scales are reloaded once per k-tile, so a group must cover whole k-tiles
+      check_mode_args = check_mode_args && args.group_size > 0;
+      check_mode_args = check_mode_args && (args.group_size == K || ((args.group_size % BLK_K) == 0));
+      check_mode_args = check_mode_args && (args.ptr_S != nullptr);
+
+      // A default constructed dS has zero K and L strides, which would silently apply the first
+      // column of scales (and zeros) to every group and batch
+      if (check_mode_args) {
+        auto scale_mn = IsATransformed ? M : N;
+        auto scale_k = (K + args.group_size - 1) / args.group_size;
+        check_mode_args = check_mode_args && (scale_k == 1 || get<1>(args.dS) >= scale_mn);
+        check_mode_args = check_mode_args && (L == 1 || get<2>(args.dS) >= scale_mn * scale_k);
+      }
+
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+        check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
+      }
+      else {
+        check_mode_args = check_mode_args && (args.ptr_Z != nullptr);
+      }
+    }
+
+    if (!check_mode_args) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Invalid arguments for the selected conversion mode.\n");
+    }
+
+    bool check_alignment = detail::xe_check_block_copy_alignment<ElementA, ElementB>(problem_shape_MNKL, args.dA, args.dB);
+    return check_mode_args && check_alignment;
   }
 
   // Helper functions to select packing for conversion
@@ -201,17 +325,6 @@ struct CollectiveMma<
 
     if constexpr (std::is_same_v<SrcType, DstType>) {
       return in;
-    } else if constexpr (sizeof_bits_v<SrcType> < 8) {
-      // TODO: Current NumericArrayConverter doesn't work for int4 on intel Xe, just workaround and
-      // hardcode here for functionality test, will remove this branch in the future.
-
-      auto out = make_fragment_like<DstType>(in);
-
-      #pragma unroll
-      for (int i = 0; i < decltype(size(out))::value; i++) {
-        out[i] = static_cast<DstType>(in[i].get());
-      }
-      return out;
     } else {
       auto out = make_fragment_like<DstType>(in);
 
@@ -237,6 +350,38 @@ struct CollectiveMma<
     }
   }
 
+  /// Applies the group-wise scales (and zeros) to the converted fragment of the transformed operand.
+  /// The scales only vary along MN within a k-tile, so they are indexed by the (value, MMA_MN) modes of the fragment.
+  template <class EngineIn,
+            class LayoutIn,
+            class EngineScale,
+            class LayoutScale,
+            class EngineZero,
+            class LayoutZero>
+  CUTLASS_DEVICE
+  void dequantize(Tensor<EngineIn, LayoutIn>& tCrT,
+                  Tensor<EngineScale, LayoutScale> const& tCrS,
+                  Tensor<EngineZero, LayoutZero> const& tCrZ) {
+    static_assert(is_rmem<EngineIn>::value, "Input tensor for dequantization must come from registers");
+
+    using DstType = typename EngineIn::value_type;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int k = 0; k < size<2>(tCrT); ++k) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int mn = 0; mn < size<1>(tCrT); ++mn) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < size<0>(tCrT); ++v) {
+          NonVoidElementScale value = static_cast<NonVoidElementScale>(tCrT(v, mn, k)) * tCrS(v, mn);
+          if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
+            value = value + tCrZ(v, mn);
+          }
+          tCrT(v, mn, k) = static_cast<DstType>(value);
+        }
+      }
+    }
+  }
+
   /// Perform a subgroup-scoped matrix multiply-accumulate
   template <class FrgTensorD,
     class TensorA,
@@ -311,6 +456,40 @@ struct CollectiveMma<
     auto pAgA = thr_prefetch_A.partition_S(gA);
     auto pBgB = thr_prefetch_B.partition_S(gB);
 
+    // The scales and zeros are gathered per work-item, so partition the coordinates of the transformed operand
+    // with this work-item's slice of the MMA rather than the sub-group leader's one used for the block copies.
+    auto thr_mma_scale = tiled_mma.get_slice(thread_idx);
+    Tensor tCcT = [&]() {
+      if constexpr (IsATransformed) {
+        return thr_mma_scale.partition_A(gA);
+      } else {
+        return thr_mma_scale.partition_B(gB);
+      }
+    }();
+
+    // (MMA, MMA_MN) register copies of the scales and zeros of the current group
+    Tensor tCrS = make_tensor<NonVoidElementScale>(make_shape(size<0>(tCcT), size<1>(tCcT)));
+    Tensor tCrZ = make_tensor<NonVoidElementZero>(make_shape(size<0>(tCcT), size<1>(tCcT)));
+
+    auto load_scales = [&](int scale_k) {
+      auto scale_mn = size<0>(mainloop.mS);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int mn = 0; mn < size<1>(tCcT); ++mn) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < size<0>(tCcT); ++v) {
+          auto coord = tCcT(v, mn, 0, 0);
+          int mn_coord = get<0>(coord);
+          int l_coord = get<2>(coord);
+          bool in_bounds = mn_coord < scale_mn;
+          tCrS(v, mn) = in_bounds ? mainloop.mS(mn_coord, scale_k, l_coord) : NonVoidElementScale(0);
+          if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
+            tCrZ(v, mn) = in_bounds ? mainloop.mZ(mn_coord, scale_k, l_coord) : NonVoidElementZero(0);
+          }
+        }
+      }
+    };
+
   #if CUTLASS_ENABLE_DEBUG_PRINTS
     if (cutlass::thread(LOG_THREAD, LOG_GROUP)) {
         print("======================= A: \n");
@@ -344,6 +523,7 @@ struct CollectiveMma<
 
     const int k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
     int prefetch_k = 0;
+    int loaded_scale_k = -1;
 
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < DispatchPolicy::Stages; i++, prefetch_k++) {
@@ -364,6 +544,20 @@ struct CollectiveMma<
       auto mma_A = transform_if_needed<MmaType>(tCrA);
       auto mma_B = transform_if_needed<MmaType>(tCrB);
 
+      if constexpr (ModeHasScales) {
+        // group_size is either K or a multiple of BLK_K, so the whole k-tile shares one group
+        int const scale_k = (k * BLK_K) / mainloop.group_size;
+        if (scale_k != loaded_scale_k) {
+          load_scales(scale_k);
+          loaded_scale_k = scale_k;
+        }
+        if constexpr (IsATransformed) {
+          dequantize(mma_A, tCrS, tCrZ);
+        } else {
+          dequantize(mma_B, tCrS, tCrZ);
+        }
+      }
+
       if(prefetch_k < k_tile_count) {
         if constexpr(cute::detail::has_prefetch<GmemTiledCopyA>) {
           prefetch(tiled_prefetch_a, pAgA(_,_,_,prefetch_k));
@@ -0,0 +1,368 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/xe_slm_staging.hpp"
+#include "cutlass/gemm/collective/xe_mma_utils.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Mainloop that stages the A and B tiles of a workgroup through shared local memory. Every k-tile is read from
+// global memory once by the whole workgroup, with each work-item loading a disjoint 128-bit slice, and the
+// subgroups then read their MMA fragments from SLM. While the subgroups compute on one buffer, the next k-tile
+// is loaded into registers and stored to the other one, so a single workgroup barrier per k-tile is enough.
+// GmemTiledCopyA/B are only used to prefetch the upcoming k-tiles into the cache.
+template <int Stages, class Schedule, class TileShape_, class ElementA_, class StrideA_, class ElementB_, class StrideB_,
+          class TiledMma_, class GmemTiledCopyA_, class SmemLayoutAtomA_, class SmemCopyAtomA_, class TransformA_,
+          class GmemTiledCopyB_, class SmemLayoutAtomB_, class SmemCopyAtomB_, class TransformB_>
+struct CollectiveMma<MainloopIntelPVCSlm<Stages, Schedule>, TileShape_, ElementA_, StrideA_, ElementB_, StrideB_,
+                     TiledMma_, GmemTiledCopyA_, SmemLayoutAtomA_, SmemCopyAtomA_, TransformA_, GmemTiledCopyB_,
+                     SmemLayoutAtomB_, SmemCopyAtomB_, TransformB_> {
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCSlm<Stages, Schedule>;
+  using WorkgroupTileShape = TileShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using SmemLayoutAtomA = SmemLayoutAtomA_;
+  using SmemLayoutAtomB = SmemLayoutAtomB_;
+  using SmemCopyAtomA = SmemCopyAtomA_;
+  using SmemCopyAtomB = SmemCopyAtomB_;
+  using TransformA = TransformA_;
+  using TransformB = TransformB_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+
+  static_assert(platform::is_same<ElementA, ElementB>::value, "MainloopIntelPVCSlm requires that A and B have same type.");
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  static constexpr auto Num_SGs = ATOM_N * ATOM_M * ATOM_K;
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+
+  using CopyThreadShape = Shape<_1, Int<SubgroupSize>>;
+  using traits_load_A = Copy_Traits<GmemTiledCopyA, StrideA>;
+  using atom_load_A = Copy_Atom<traits_load_A, ElementA>;
+  using traits_load_B = Copy_Traits<GmemTiledCopyB, StrideB>;
+  using atom_load_B = Copy_Atom<traits_load_B, ElementB>;
+
+  using  TensorMKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementA const*>(nullptr)), make_shape(0,0,0), StrideA{}));   //(m, k)
+  using  TensorNKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementB const*>(nullptr)), make_shape(0,0,0), StrideB{}));   //(n, k)
+
+  // Global memory is read in 128-bit vectors along the contiguous mode of each operand
+  static constexpr int CopyBits = detail::XeSlmCopyBits;
+  static constexpr int AlignmentA = CopyBits / sizeof_bits_v<ElementA>;
+  static constexpr int AlignmentB = CopyBits / sizeof_bits_v<ElementB>;
+  static constexpr bool IsKMajorA = cutlass::detail::is_major<1, StrideA>();
+  static constexpr bool IsKMajorB = cutlass::detail::is_major<1, StrideB>();
+
+  using SmemLayoutA = decltype(detail::make_xe_slm_layout<IsKMajorA, BLK_M, BLK_K, Stages>());
+  using SmemLayoutB = decltype(detail::make_xe_slm_layout<IsKMajorB, BLK_N, BLK_K, Stages>());
+  using SlmTiledCopyA = decltype(detail::make_xe_slm_tiled_copy<ElementA, IsKMajorA, BLK_M, BLK_K, MaxThreadsPerBlock>());
+  using SlmTiledCopyB = decltype(detail::make_xe_slm_tiled_copy<ElementB, IsKMajorB, BLK_N, BLK_K, MaxThreadsPerBlock>());
+
+  // Allocated by the kernel, see kernel::detail::XeMainloopSharedStorageSize
+  struct SharedStorage {
+    cute::array_aligned<ElementA, cute::cosize_v<SmemLayoutA>> smem_A;
+    cute::array_aligned<ElementB, cute::cosize_v<SmemLayoutB>> smem_B;
+  };
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B;
+    StrideB dB;
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
+                              make_layout(make_shape(N, K, L), args.dB));
+
+    return Params{mA_mkl, mB_nkl};
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    // Each vector copy is predicated as a whole, so the contiguous mode must be a multiple of the vector width
+    bool implementable = true;
+    implementable &= cutlass::detail::check_alignment<AlignmentA>(cute::make_shape(M,K,L), args.dA);
+    implementable &= cutlass::detail::check_alignment<AlignmentB>(cute::make_shape(N,K,L), args.dB);
+    implementable &= (reinterpret_cast<uintptr_t>(args.ptr_A) % (CopyBits / 8)) == 0;
+    implementable &= (reinterpret_cast<uintptr_t>(args.ptr_B) % (CopyBits / 8)) == 0;
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for 128-bit SLM staging.\n");
+    }
+    return implementable;
+  }
+
+  /// Prefetch the first Stages k-tiles of the A and B panels of a workgroup tile, starting at k-tile `k_start`.
+  template <class TensorA, class TensorB>
+  CUTLASS_DEVICE void prefetch_k_tiles(TensorA gA, TensorB gB, int k_start, int k_tile_count, int thread_idx,
+                                       Params const &mainloop) {
+    detail::xe_prefetch_k_tiles<DispatchPolicy::Stages, WorkgroupTileShape, Num_SGs>(
+      detail::make_xe_block_copy<SubgroupSize, atom_load_A>(mainloop.mA),
+      detail::make_xe_block_copy<SubgroupSize, atom_load_B>(mainloop.mB),
+      mainloop.mA, mainloop.mB, gA, gB, k_start, k_tile_count, thread_idx);
+  }
+
+  /// Perform a workgroup-scoped matrix multiply-accumulate with operands staged through SLM
+  template <class FrgTensorD, class TensorA, class TensorB, class FrgTensorC, class KTileIterator, class ResidueMNK,
+            class BlkCoord>
+  CUTLASS_DEVICE void operator()(FrgTensorD &accum, TensorA gA, TensorB gB, FrgTensorC const &src_accum,
+                                 KTileIterator k_tile_iter, int k_tile_count, ResidueMNK residue_mnk,
+                                 BlkCoord const &blk_coord, int const &K_start, int thread_idx, char *smem_buf,
+                                 Params const &mainloop) {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    (void)residue_mnk;
+
+    auto m_coord = get<0>(blk_coord);
+    auto n_coord = get<1>(blk_coord);
+    auto l_coord = get<3>(blk_coord);
+
+    // Global tiles of the workgroup and the matching identity tensors for predication
+    Tensor mA_mk = mainloop.mA(_,_,l_coord);                                                            // (m,k)
+    Tensor mB_nk = mainloop.mB(_,_,l_coord);                                                            // (n,k)
+    Tensor gA_mk = local_tile(mA_mk, select<0,2>(WorkgroupTileShape{}), make_coord(m_coord,_));  // (BLK_M,BLK_K,k)
+    Tensor gB_nk = local_tile(mB_nk, select<1,2>(WorkgroupTileShape{}), make_coord(n_coord,_));  // (BLK_N,BLK_K,k)
+    Tensor cA_mk = local_tile(make_identity_tensor(shape(mA_mk)), select<0,2>(WorkgroupTileShape{}),
+                              make_coord(m_coord,_));
+    Tensor cB_nk = local_tile(make_identity_tensor(shape(mB_nk)), select<1,2>(WorkgroupTileShape{}),
+                              make_coord(n_coord,_));
+
+    SharedStorage& storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    Tensor sA = make_tensor(make_smem_ptr(storage.smem_A.data()), SmemLayoutA{});                 // (BLK_M,BLK_K,PIPE)
+    Tensor sB = make_tensor(make_smem_ptr(storage.smem_B.data()), SmemLayoutB{});                 // (BLK_N,BLK_K,PIPE)
+
+    // Partition the tiles for the cooperative gmem -> rmem -> SLM copies
+    SlmTiledCopyA slm_copy_a;
+    SlmTiledCopyB slm_copy_b;
+    auto thr_slm_copy_A = slm_copy_a.get_slice(thread_idx);
+    auto thr_slm_copy_B = slm_copy_b.get_slice(thread_idx);
+
+    Tensor tAgA = thr_slm_copy_A.partition_S(gA_mk);                                       // (CPY,CPY_M,CPY_K,k)
+    Tensor tAcA = thr_slm_copy_A.partition_S(cA_mk);                                       // (CPY,CPY_M,CPY_K,k)
+    Tensor tAsA = thr_slm_copy_A.partition_D(sA);                                          // (CPY,CPY_M,CPY_K,PIPE)
+    Tensor tArA = make_fragment_like(tAsA(_,_,_,0));                                       // (CPY,CPY_M,CPY_K)
+    Tensor tBgB = thr_slm_copy_B.partition_S(gB_nk);
+    Tensor tBcB = thr_slm_copy_B.partition_S(cB_nk);
+    Tensor tBsB = thr_slm_copy_B.partition_D(sB);
+    Tensor tBrB = make_fragment_like(tBsB(_,_,_,0));
+
+    // The MMA fragments are read from SLM by every work-item, so the thread slice is the work-item's own
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(thread_idx);
+    Tensor tCsA = thr_mma.partition_A(sA);                                                 // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCsB = thr_mma.partition_B(sB);                                                 // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tCrA = thr_mma.make_fragment_A(tCsA(_,_,_,0));                                  // (MMA,MMA_M,MMA_K)
+    Tensor tCrB = thr_mma.make_fragment_B(tCsB(_,_,_,0));                                  // (MMA,MMA_N,MMA_K)
+
+    // Block prefetch of the upcoming k-tiles, as in the register-resident mainloop
+    auto tiled_copy_a = make_tiled_copy(atom_load_A{}.with(mainloop.mA),
+                                   Layout<CopyThreadShape>{},
+                                   make_layout(shape_div(typename traits_load_A::BlockShape{}, CopyThreadShape{})));
+    auto tiled_copy_b = make_tiled_copy(atom_load_B{}.with(mainloop.mB),
+                                   Layout<CopyThreadShape>{},
+                                   make_layout(shape_div(typename traits_load_B::BlockShape{}, CopyThreadShape{})));
+    auto tiled_prefetch_a = tiled_copy_a.template prefetch_selector<Shape<Int<BLK_M>,Int<BLK_K>>, Num_SGs>(mainloop.mA);
+    auto tiled_prefetch_b = tiled_copy_b.template prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, Num_SGs>(mainloop.mB);
+    auto pAgA = tiled_prefetch_a.get_slice(thread_idx).partition_S(gA);
+    auto pBgB = tiled_prefetch_b.get_slice(thread_idx).partition_S(gB);
+
+#if CUTLASS_ENABLE_DEBUG_PRINTS
+#define PRINT(x) print(#x ": "); print(x); print("\n");
+    if (cute::thread(LOG_THREAD, LOG_GROUP)) {
+      print("======================= A: \n");
+      PRINT(tAgA);
+      PRINT(tAsA);
+      PRINT(tCsA);
+      PRINT(tCrA);
+
+      print("======================= B: \n");
+      PRINT(tBgB);
+      PRINT(tBsB);
+      PRINT(tCsB);
+      PRINT(tCrB);
+      }
+#undef PRINT
+#endif
+
+    auto const shape_MK = shape(mA_mk);
+    auto const shape_NK = shape(mB_nk);
+
+    // Out of bounds vectors are zero filled so that they do not contribute to the accumulators
+    auto load_k_tile = [&](int k_tile) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int m = 0; m < size<1>(tArA); ++m) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < size<2>(tArA); ++k) {
+          if (elem_less(tAcA(0,m,k,k_tile), shape_MK)) {
+            copy(slm_copy_a, tAgA(_,m,k,k_tile), tArA(_,m,k));
+          } else {
+            clear(tArA(_,m,k));
+          }
+        }
+      }
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < size<1>(tBrB); ++n) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < size<2>(tBrB); ++k) {
+          if (elem_less(tBcB(0,n,k,k_tile), shape_NK)) {
+            copy(slm_copy_b, tBgB(_,n,k,k_tile), tBrB(_,n,k));
+          } else {
+            clear(tBrB(_,n,k));
+          }
+        }
+      }
+    };
+
+    auto store_k_tile = [&](int stage) {
+      copy(slm_copy_a, tArA, tAsA(_,_,_,stage));
+      copy(slm_copy_b, tBrB, tBsB(_,_,_,stage));
+    };
+
+    //
+    // Mainloop
+    //
+    const auto k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+    const int k_end_idx = k_start_idx + k_tile_count;
+    int prefetch_k = k_start_idx;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < DispatchPolicy::Stages; i++, prefetch_k++) {
+      if (prefetch_k < k_end_idx) {
+        prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
+        prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
+      }
+    }
+
+    // Prologue: stage the first k-tile
+    int read_stage = 0;
+    if (k_tile_count > 0) {
+      load_k_tile(k_start_idx);
+      store_k_tile(read_stage);
+    }
+    syncthreads();
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int k_tile = k_start_idx; k_tile < k_end_idx; k_tile++, prefetch_k++) {
+      int const write_stage = (read_stage + 1) % DispatchPolicy::Stages;
+      bool const has_next = k_tile + 1 < k_end_idx;
+
+      // Issue the global loads of the next k-tile before computing on the current one
+      if (has_next) {
+        load_k_tile(k_tile + 1);
+      }
+      if (prefetch_k < k_end_idx) {
+        prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
+        prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
+      }
+
+      copy(tCsA(_,_,_,read_stage), tCrA);
+      copy(tCsB(_,_,_,read_stage), tCrB);
+      cute::gemm(tiled_mma, tCrA, tCrB, accum);
+
+      // The write stage was last read in the previous iteration, which every work-item has left
+      if (has_next) {
+        store_k_tile(write_stage);
+      }
+      syncthreads();
+      read_stage = write_stage;
+    }
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Helpers shared by the Xe mainloops which read their operands with 2D block copies
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/detail/layout.hpp"
+
+#include "cute/algorithm/gemm.hpp"
+#include "cute/atom/copy_atom.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective::detail {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 2D block copies require a 16B aligned surface pitch, so the contiguous mode of A and B (K for a row-major A)
+// must be a multiple of 128 bits. Used by can_implement of the mainloops that load A and B from global memory.
+template <class ElementA, class ElementB, class ProblemShapeMNKL, class StrideA, class StrideB>
+bool
+xe_check_block_copy_alignment(ProblemShapeMNKL const& problem_shape_MNKL, StrideA const& dA, StrideB const& dB) {
+  constexpr int copy_alignment_bits = 128;
+  constexpr int min_aligned_elements_A = copy_alignment_bits / sizeof_bits<ElementA>::value;
+  constexpr int min_aligned_elements_B = copy_alignment_bits / sizeof_bits<ElementB>::value;
+
+  auto [M,N,K,L] = problem_shape_MNKL;
+
+  bool implementable = true;
+  implementable &= cutlass::detail::check_alignment<min_aligned_elements_A>(cute::make_shape(M,K,L), dA);
+  implementable &= cutlass::detail::check_alignment<min_aligned_elements_B>(cute::make_shape(N,K,L), dB);
+
+  if (!implementable) {
+    CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for 2D block copies.\n");
+  }
+  return implementable;
+}
+
+// 2D block copy of one operand bound to its global tensor. Each subgroup copies whole blocks, with one block
+// column per work-item.
+template <int SubgroupSize, class CopyAtom, class TensorG>
+CUTLASS_HOST_DEVICE auto
+make_xe_block_copy(TensorG const& mG) {
+  using CopyThreadShape = Shape<_1, Int<SubgroupSize>>;
+  return make_tiled_copy(CopyAtom{}.with(mG),
+                         Layout<CopyThreadShape>{},
+                         make_layout(shape_div(typename CopyAtom::Traits::BlockShape{}, CopyThreadShape{})));
+}
+
+// Prefetches the first Stages k-tiles of the A and B panels of a workgroup tile, starting at k-tile k_start.
+// Persistent kernels issue this for their next tile before running the epilogue of the current one, so that the
+// panels are on their way to the cache when the next mainloop starts.
+template <int Stages, class WorkgroupTileShape, int NumSGs, class TiledCopyA, class TiledCopyB,
+          class TensorMA, class TensorMB, class TensorA, class TensorB>
+CUTLASS_DEVICE void
+xe_prefetch_k_tiles(TiledCopyA const& tiled_copy_a, TiledCopyB const& tiled_copy_b,
+                    TensorMA const& mA, TensorMB const& mB, TensorA const& gA, TensorB const& gB,
+                    int k_start, int k_tile_count, int thread_idx) {
+  constexpr int BLK_M = get<0>(WorkgroupTileShape{});
+  constexpr int BLK_N = get<1>(WorkgroupTileShape{});
+  constexpr int BLK_K = get<2>(WorkgroupTileShape{});
+
+  auto tiled_prefetch_a = tiled_copy_a.template prefetch_selector<Shape<Int<BLK_M>,Int<BLK_K>>, NumSGs>(mA);
+  auto tiled_prefetch_b = tiled_copy_b.template prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, NumSGs>(mB);
+  auto pAgA = tiled_prefetch_a.get_slice(thread_idx).partition_S(gA);
+  auto pBgB = tiled_prefetch_b.get_slice(thread_idx).partition_S(gB);
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Stages; i++) {
+    if (i < k_tile_count) {
+      prefetch(tiled_prefetch_a, pAgA(_, _, _, k_start + i));
+      prefetch(tiled_prefetch_b, pBgB(_, _, _, k_start + i));
+    }
+  }
+}
+
+/// Converts a register fragment filled by 1-byte block loads to the 16-bit MMA type, keeping its layout
+template <class DstType, class EngineIn, class LayoutIn>
+CUTLASS_DEVICE auto
+xe_upconvert_fragment(Tensor<EngineIn, LayoutIn> const& in) {
+  static_assert(is_rmem<EngineIn>::value, "Input tensor for conversion must come from registers");
+  static_assert(size_v<LayoutIn> == cosize_v<LayoutIn>);
+
+  using SrcType = typename EngineIn::value_type;
+  constexpr int NumElements = decltype(size(in))::value;
+  using Converter = NumericArrayConverter<DstType, SrcType, NumElements, FloatRoundStyle::round_to_nearest>;
+
+  auto out = make_fragment_like<DstType>(in);
+  auto const& src = *reinterpret_cast<Array<SrcType, NumElements> const*>(raw_pointer_cast(in.data()));
+  auto& dst = *reinterpret_cast<Array<DstType, NumElements>*>(raw_pointer_cast(out.data()));
+  dst = Converter::convert(src);
+  return out;
+}
+
+// K loop of the mainloops with 8-bit operands: k-tiles [k_start, k_start + k_tile_count) of A and B are read with
+// 1-byte 2D block loads, upconverted to MmaType in registers and accumulated into accum. after_k_tile(k_tile) runs
+// once the MMA of a k-tile has been issued, e.g. to fold a partial accumulator into the result.
+template <class MmaType, int Stages, class WorkgroupTileShape, int NumSGs, int SubgroupSize,
+          class TiledMma, class TiledCopyA, class TiledCopyB, class TensorMA, class TensorMB,
+          class TensorA, class TensorB, class FrgTensorD, class AfterKTile>
+CUTLASS_DEVICE void
+xe_upconvert_mma_k_tiles(TiledMma const& tiled_mma, TiledCopyA const& tiled_copy_a, TiledCopyB const& tiled_copy_b,
+                         TensorMA const& mA, TensorMB const& mB, TensorA const& gA, TensorB const& gB,
+                         FrgTensorD& accum, int k_start, int k_tile_count, int thread_idx,
+                         AfterKTile&& after_k_tile) {
+  constexpr int BLK_M = get<0>(WorkgroupTileShape{});
+  constexpr int BLK_N = get<1>(WorkgroupTileShape{});
+  constexpr int BLK_K = get<2>(WorkgroupTileShape{});
+
+  auto thr_copy_A = tiled_copy_a.get_slice(thread_idx);
+  auto thr_copy_B = tiled_copy_b.get_slice(thread_idx);
+
+  // To make all work items in a subgroup have the same global tensors pass in the index of work item 0 in each subgroup
+  auto sg = syclcompat::get_nd_item<1>().get_sub_group();
+  auto first_thread_in_sg_idx = sg.get_group_linear_id() * SubgroupSize;
+  auto thr_mma = tiled_mma.get_slice(first_thread_in_sg_idx);
+
+  // Partition global counting tensors for MMA
+  Tensor tCgA = thr_mma.partition_A(gA);
+  Tensor tCgB = thr_mma.partition_B(gB);
+
+  // 8-bit fragments filled by the block loads
+  Tensor tCrA = make_tensor<remove_cv_t<typename TensorMA::value_type>>(make_fragment_layout(tiled_copy_a, tCgA(_,_,_,0).shape()));
+  Tensor tCrB = make_tensor<remove_cv_t<typename TensorMB::value_type>>(make_fragment_layout(tiled_copy_b, tCgB(_,_,_,0).shape()));
+
+  // Retile registers for copies
+  Tensor tArA = thr_copy_A.retile_D(tCrA);
+  Tensor tBrB = thr_copy_B.retile_D(tCrB);
+
+  // Retile global counting tensors for copies
+  Tensor tAgA = thr_copy_A.retile_S(tCgA);
+  Tensor tBgB = thr_copy_B.retile_S(tCgB);
+
+  auto tiled_prefetch_a = tiled_copy_a.template prefetch_selector<Shape<Int<BLK_M>,Int<BLK_K>>, NumSGs>(mA);
+  auto tiled_prefetch_b = tiled_copy_b.template prefetch_selector<Shape<Int<BLK_N>,Int<BLK_K>>, NumSGs>(mB);
+  auto pAgA = tiled_prefetch_a.get_slice(thread_idx).partition_S(gA);
+  auto pBgB = tiled_prefetch_b.get_slice(thread_idx).partition_S(gB);
+
+  const int k_end = k_start + k_tile_count;
+  constexpr int barrier_scope = 2;
+  int prefetch_k = k_start;
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < Stages; i++, prefetch_k++) {
+    prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
+    prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
+  }
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int k_tile = k_start; k_tile < k_end; k_tile++, prefetch_k++) {
+    barrier_arrive(barrier_scope);
+    // Copy gmem to rmem for the first k_tile
+    copy(tiled_copy_a, tAgA(_,_,_,k_tile), tArA);
+    copy(tiled_copy_b, tBgB(_,_,_,k_tile), tBrB);
+
+    if (prefetch_k < k_end) {
+      prefetch(tiled_prefetch_a, pAgA(_, _, _, prefetch_k));
+      prefetch(tiled_prefetch_b, pBgB(_, _, _, prefetch_k));
+    }
+
+    auto mma_A = xe_upconvert_fragment<MmaType>(tCrA);
+    auto mma_B = xe_upconvert_fragment<MmaType>(tCrB);
+
+    cute::gemm(tiled_mma, mma_A, mma_B, accum);
+    after_k_tile(k_tile);
+    barrier_wait(barrier_scope);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective::detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
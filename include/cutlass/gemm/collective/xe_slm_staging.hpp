@@ -0,0 +1,94 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Layouts and copies for staging operand tiles through shared local memory on Xe
+*/
+
+#include "cutlass/cutlass.h"
+
+#include "cute/atom/copy_atom.hpp"
+#include "cute/layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective::detail {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Global memory is read in 128-bit vectors along the contiguous mode of each operand, and the SLM tiles keep
+// the same major mode so the stores are vectorized as well.
+constexpr int XeSlmCopyBits = 128;
+
+// (MN, K, PIPE) layout of one operand in SLM
+template <bool IsKMajor, int MN, int K, int Stages>
+constexpr auto make_xe_slm_layout() {
+  if constexpr (IsKMajor) {
+    return make_layout(make_shape(Int<MN>{}, Int<K>{}, Int<Stages>{}),
+                       make_stride(Int<K>{}, _1{}, Int<MN * K>{}));
+  } else {
+    return make_layout(make_shape(Int<MN>{}, Int<K>{}, Int<Stages>{}),
+                       make_stride(_1{}, Int<MN>{}, Int<MN * K>{}));
+  }
+}
+
+// Spreads the (MN, K) tile of one operand over all the work-items of the workgroup, one vector per work-item
+// and copy, with consecutive work-items reading consecutive vectors of the contiguous mode.
+template <class Element, bool IsKMajor, int MN, int K, int NumThreads>
+constexpr auto make_xe_slm_tiled_copy() {
+  constexpr int Vec = XeSlmCopyBits / sizeof_bits_v<Element>;
+  using CopyAtom = Copy_Atom<UniversalCopy<uint_bit_t<XeSlmCopyBits>>, Element>;
+  if constexpr (IsKMajor) {
+    constexpr int ThrK = K / Vec;
+    constexpr int ThrMN = NumThreads / ThrK;
+    static_assert(K % Vec == 0 && NumThreads % ThrK == 0 && MN % ThrMN == 0,
+                  "The workgroup tile cannot be evenly split into 128-bit copies over the workgroup.");
+    return make_tiled_copy(CopyAtom{},
+                           make_layout(make_shape(Int<ThrMN>{}, Int<ThrK>{}), make_stride(Int<ThrK>{}, _1{})),
+                           make_layout(make_shape(_1{}, Int<Vec>{})));
+  } else {
+    constexpr int ThrMN = MN / Vec;
+    constexpr int ThrK = NumThreads / ThrMN;
+    static_assert(MN % Vec == 0 && NumThreads % ThrMN == 0 && K % ThrK == 0,
+                  "The workgroup tile cannot be evenly split into 128-bit copies over the workgroup.");
+    return make_tiled_copy(CopyAtom{},
+                           make_layout(make_shape(Int<ThrMN>{}, Int<ThrK>{}), make_stride(_1{}, Int<ThrMN>{})),
+                           make_layout(make_shape(Int<Vec>{}, _1{})));
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective::detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
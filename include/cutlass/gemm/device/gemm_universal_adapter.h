@@ -542,7 +542,7 @@ public:
 
         using namespace syclcompat::experimental;
 #if defined (SYCL_INTEL_TARGET)
-        if constexpr (cute::is_same_v<DispatchPolicy, MainloopDeviceAgnostic>) {
+        if constexpr (cute::is_same_v<typename DispatchPolicy::ArchTag, arch::Agnostic>) {
           auto event = launch<device_kernel<GemmKernel>>(launch_policy{
             sycl_grid, sycl_block, local_mem_size{static_cast<std::size_t>(smem_size)}
           }, params);
@@ -132,6 +132,7 @@ struct KernelTmaWarpSpecializedCooperativeMixedInput: KernelTmaWarpSpecializedCo
 
 struct KernelPVC { };
 struct KernelPVCCooperative { };
+struct KernelPVCPtrArrayCooperative { };
 //////////////////////////////////////////////////////////////////////////////
 
 //
@@ -706,6 +707,12 @@ struct MainloopIntelPVC {
   using ClusterShape = Shape<_1,_1,_1>;
 };
 
+template<int Stages_, class KernelSchedule = KernelPVCPtrArrayCooperative>
+struct MainloopIntelPVCGroup : MainloopIntelPVC<Stages_, KernelSchedule> {
+  static_assert(cute::is_base_of_v<KernelPVCPtrArrayCooperative, KernelSchedule>,
+    "MainloopIntelPVCGroup requires a ptr-array kernel schedule.");
+};
+
 template<int Stages_>
 struct MainloopIntelPVCMixedPrecision {
   constexpr static int Stages = Stages_;
@@ -714,6 +721,29 @@ struct MainloopIntelPVCMixedPrecision {
   using Schedule = KernelPVC;
   using ClusterShape = Shape<_1,_1,_1>;
 };
+
+// FP8 operands loaded with 1-byte block loads and upconverted in registers to the 16-bit MMA type
+template<int Stages_, class KernelSchedule = KernelPVC>
+struct MainloopIntelPVCFP8 : MainloopIntelPVC<Stages_, KernelSchedule> { };
+
+// 8-bit operands upconverted in registers, with the partial accumulator of every ScaleGranularityM x
+// ScaleGranularityK block of A and ScaleGranularityN x ScaleGranularityK block of B rescaled into the result.
+// A granularity of 0 along M or N means the whole workgroup tile.
+template<int Stages_, int ScaleGranularityM_ = 1, int ScaleGranularityN_ = 128, int ScaleGranularityK_ = 128,
+         class KernelSchedule = KernelPVC>
+struct MainloopIntelPVCBlockScaling : MainloopIntelPVC<Stages_, KernelSchedule> {
+  constexpr static int ScaleGranularityM = ScaleGranularityM_;
+  constexpr static int ScaleGranularityN = ScaleGranularityN_;
+  constexpr static int ScaleGranularityK = ScaleGranularityK_;
+};
+
+// A and B tiles are staged cooperatively by the whole workgroup through Stages_ shared local memory buffers
+// (double buffered for Stages_ == 2), so each element is read from global memory once per workgroup tile
+// instead of once per subgroup that consumes it.
+template<int Stages_, class KernelSchedule = KernelPVC>
+struct MainloopIntelPVCSlm : MainloopIntelPVC<Stages_, KernelSchedule> {
+  static_assert(Stages_ >= 2, "MainloopIntelPVCSlm requires at least two shared local memory buffers.");
+};
 #endif
 
 #if defined(CUTLASS_ENABLE_SYCL)
@@ -722,6 +752,21 @@ struct MainloopDeviceAgnostic {
   using ClusterShape = Shape<_1,_1,_1>;
   using Schedule = KernelMultistage;
 };
+
+// Passed as the kernel schedule to the device agnostic collective builder to select the register blocked mainloop
+struct KernelDeviceAgnosticRegisterBlocked : KernelMultistage { };
+
+// Device agnostic mainloop which only relies on features every SYCL backend provides: A and B are loaded from
+// global memory with vectorized copies into a Stages_ deep shared local memory ring, and each work-item
+// accumulates a register tile of outer products fed by vectorized shared local memory reads.
+template<int Stages_ = 2, class KernelSchedule = KernelDeviceAgnosticRegisterBlocked>
+struct MainloopDeviceAgnosticRegisterBlocked {
+  constexpr static int Stages = Stages_;
+  using ArchTag = arch::Agnostic;
+  using ClusterShape = Shape<_1,_1,_1>;
+  using Schedule = KernelSchedule;
+  static_assert(Stages_ >= 2, "MainloopDeviceAgnosticRegisterBlocked requires at least two shared local memory buffers.");
+};
 #endif
 
 //////////////////////////////////////////////////////////////////////////////
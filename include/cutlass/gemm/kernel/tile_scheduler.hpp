@@ -53,6 +53,8 @@ struct StreamKScheduler { };
 
 struct GroupScheduler { }; // Only used for Grouped GEMMs
 
+struct DynamicPersistentScheduler { }; // Persistent workgroups pulling tiles from a global work queue (Xe only)
+
 } // namespace cutlass::gemm
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -65,6 +67,7 @@ struct GroupScheduler { }; // Only used for Grouped GEMMs
 
 #if defined (SYCL_INTEL_TARGET)
 #include "cutlass/gemm/kernel/xe_tile_scheduler_streamk.hpp"
+#include "cutlass/gemm/kernel/xe_tile_scheduler_dynamic.hpp"
 #endif
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -169,6 +172,21 @@ struct TileSchedulerSelector<
   > {
   using Scheduler = PersistentTileSchedulerSm90;
 };
+
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t ThreadsPerBlock
+>
+struct TileSchedulerSelector<
+  DynamicPersistentScheduler,
+  arch::IntelPVC,
+  TileShape,
+  ClusterShape,
+  ThreadsPerBlock
+  > {
+  using Scheduler = PersistentTileSchedulerXeDynamic<TileShape>;
+};
 #endif
 
 template <
@@ -188,6 +206,25 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape>;
 };
 
+#if defined (SYCL_INTEL_TARGET)
+template <
+  class TileShape,
+  class ClusterShape
+  , uint32_t SchedulerPipelineStageCount
+  , class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupScheduler,
+    arch::IntelPVC,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape>;
+};
+#endif
+
 
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
 struct TileSchedulerSelector<
@@ -32,8 +32,12 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/workspace.h"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/xe_tile_swizzle.hpp"
+#include "cutlass/gemm/kernel/xe_mainloop_shared_storage.hpp"
 
 #include "cute/tensor.hpp"
 
@@ -79,15 +83,22 @@ public:
   using ClusterShape = typename DispatchPolicy::ClusterShape;
   using MainloopParams = typename CollectiveMainloop::Params;
 
-  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, PersistentScheduler>,
-    "Intel PVC does not support specializing the tile scheduler.");
+  static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+
+  static_assert(cute::is_void_v<TileScheduler_> or cute::is_same_v<TileScheduler_, PersistentScheduler> or
+                cute::is_same_v<TileScheduler_, StreamKScheduler>,
+    "Intel PVC only supports the default, persistent and stream-K tile schedulers.");
   using TileSchedulerTag = TileScheduler_;
   using TileScheduler = typename detail::TileSchedulerSelector<
     TileScheduler_, ArchTag, WorkgroupTileShape,
-    cute::Shape<cute::Int<1>, cute::Int<1>, cute::Int<1>>>::Scheduler;
+    cute::Shape<cute::Int<1>, cute::Int<1>, cute::Int<1>>, MaxThreadsPerBlock>::Scheduler;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
 
+  // With the stream-K scheduler the kernel is persistent: each workgroup walks a range of k-tiles that may
+  // span several output tiles, and partial accumulators are reduced through the scheduler workspace.
+  static constexpr bool IsStreamK = cute::is_same_v<TileScheduler_, StreamKScheduler>;
+
   // Epilogue derived types
   using CollectiveEpilogue = CollectiveEpilogue_;
   using ElementC = typename CollectiveEpilogue::ElementC;
@@ -99,11 +110,10 @@ public:
   static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue::ElementAccumulator>,
     "Mainloop and epilogue do not agree on accumulator value type.");
 
-  // MSVC requires the cast to fix a warning-as-error.
-  static constexpr int SharedStorageSize = 0;
+  // Only mainloops that stage operands through shared local memory need an allocation; the epilogue uses none.
+  static constexpr int SharedStorageSize = detail::XeMainloopSharedStorageSize<CollectiveMainloop>::value;
 
   static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
-  static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
   using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;
   using SubgroupTileShape = typename CollectiveMainloop::SubgroupTileShape;
  
@@ -137,6 +147,8 @@ public:
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerParams scheduler{};
+    // Number of tiles along the minor mode of the raster order covered by consecutive workgroups
+    int swizzle_size{1};
   };
 
   //
@@ -147,19 +159,42 @@ public:
   static
   Params
   to_underlying_arguments(Arguments const& args, void* workspace) {
-    (void) workspace;
     auto problem_shape_MNKL = append<4>(args.problem_shape, 1);
 
+    KernelHardwareInfo hw_info = args.hw_info;
+    if constexpr (IsStreamK) {
+      // The stream-K decomposition is sized to the number of Xe cores, so query it if not provided
+      if (hw_info.sm_count <= 0) {
+        CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+            "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+        hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+      }
+    }
+
+    // The epilogue workspace comes first, followed by the scheduler workspace
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = round_nearest(
+      CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue), MinWorkspaceAlignment);
+
     auto mainloop_args = CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace);
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
-      problem_shape_MNKL, TileShape{}, ClusterShape{}, args.hw_info, args.scheduler, &workspace);
+      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, workspace_ptr + workspace_offset);
+
+    // The stream-K scheduler swizzles the units of work itself
+    int swizzle_size = 1;
+    if constexpr (not IsStreamK) {
+      swizzle_size = detail::XeTileSwizzle::get_swizzle_size(
+        to_gemm_coord(problem_shape_MNKL), to_gemm_coord(TileShape{}), sizeof(ElementA), sizeof(ElementB),
+        hw_info, args.scheduler.max_swizzle_size, scheduler.raster_order_);
+    }
     return {
       args.mode,
       args.problem_shape,
       mainloop_args,
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
-      args.hw_info,
-      scheduler
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace_ptr),
+      hw_info,
+      scheduler,
+      swizzle_size
     };
   }
 
@@ -170,34 +205,71 @@ public:
     auto k = get<2>(args.problem_shape);
     // TODO(codeplay): base *_valid on the atom shapes
     bool m_valid = m > 0;
-    bool n_valid = n > 0 && n % 4 == 0;
-    bool k_valid = k > 0 && k % get<2>(TileShape{}) == 0;
+    bool n_valid = n > 0;
+    // K does not need to be a multiple of the tile size: the 2D block loads are bounds checked against
+    // the surface width/height and zero-fill out of bounds elements, so the partial last k-tile is
+    // accumulated without padding A or B.
+    bool k_valid = k > 0;
     bool shape_implementable = (m_valid && n_valid && k_valid);
 
     bool mode_implementable = args.mode == GemmUniversalMode::kGemm ||
           (args.mode == GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
-    return shape_implementable && mode_implementable && TileScheduler::can_implement(args.scheduler);
+    return shape_implementable && mode_implementable && TileScheduler::can_implement(args.scheduler) &&
+           CollectiveMainloop::can_implement(args.problem_shape, args.mainloop) &&
+           CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
   }
 
-  static int
+  static size_t
   get_workspace_size(Arguments const& args) {
-    return 0;
+    size_t workspace_size = 0;
+    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size = round_nearest(workspace_size, MinWorkspaceAlignment);
+
+    if constexpr (IsStreamK) {
+      workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
+        args.scheduler, args.problem_shape, args.hw_info, 1);
+    }
+    return workspace_size;
   }
 
   static
   cutlass::Status
   initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, 
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = 0;
+
+    Status status = CollectiveEpilogue::initialize_workspace(
+      args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset = round_nearest(workspace_offset, MinWorkspaceAlignment);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    if constexpr (IsStreamK) {
+      status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
+        args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, 1);
+    }
+    return status;
   }
 
   static dim3
   get_grid_shape(Params const& params) {
-    dim3 grid = TileScheduler::get_tiled_cta_shape_mnl(params.problem_shape, TileShape{}, ClusterShape{});
-    if(params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
-      return {grid.y, grid.x, grid.z};
+    if constexpr (IsStreamK) {
+      // Given device Xe core count, set grid size s.t. we do not launch more workgroups than can run concurrently
+      TileSchedulerArguments args{};
+      args.raster_order = params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN ?
+        TileScheduler::RasterOrderOptions::AlongN : TileScheduler::RasterOrderOptions::AlongM;
+      return TileScheduler::get_grid_shape(params.scheduler, params.problem_shape, TileShape{}, ClusterShape{},
+                                           params.hw_info, args);
     } else {
-      return {grid.x, grid.y, grid.z};
+      dim3 grid = TileScheduler::get_tiled_cta_shape_mnl(params.problem_shape, TileShape{}, ClusterShape{});
+      if(params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
+        return {grid.y, grid.x, grid.z};
+      } else {
+        return {grid.x, grid.y, grid.z};
+      }
     }
   }
 
@@ -227,19 +299,21 @@ public:
     static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
     static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
 
+    if constexpr (IsStreamK) {
+      run_stream_k(params, shared_storage, smem_buf, problem_shape_MNKL);
+      return;
+    }
+
     // Get the appropriate blocks for this sub_group -- potential for sub_group locality
     int thread_idx = int(ThreadIdxX());
     auto blk_shape = TileShape{};
-    int m_coord, n_coord, l_coord;
-    if (params.scheduler.raster_order_ == TileScheduler::RasterOrder::AlongN) {
-      m_coord = BlockIdxY();
-      n_coord = BlockIdxX();
-      l_coord = BlockIdxZ();
-    } else {
-      m_coord = BlockIdxX();
-      n_coord = BlockIdxY();
-      l_coord = BlockIdxZ();
-    }
+    // The grid is linearized along the raster order and remapped so that groups of swizzle_size workgroups share
+    // their A (AlongN) or B (AlongM) panels
+    auto [m_coord, n_coord] = detail::XeTileSwizzle::get_tile_coord(
+      BlockIdxX() + static_cast<uint64_t>(BlockIdxY()) * GridDimX(),
+      ceil_div(M, get<0>(blk_shape)), ceil_div(N, get<1>(blk_shape)), params.swizzle_size,
+      params.scheduler.raster_order_);
+    int l_coord = BlockIdxZ();
 
     auto blk_coord_mnkl = make_coord(m_coord, n_coord, _, l_coord);
     constexpr auto workgroup_shape = WorkgroupTileShape{};                                                  // (SUB_M,SUB_N,SUB_K)
@@ -264,7 +338,7 @@ public:
     clear(accumulators);
 
     auto k_tile_iter  = cute::make_coord_iterator(idx2crd(0, make_shape(K)), make_shape(K));
-    int  k_tile_count = K / get<2>(workgroup_shape);
+    int  k_tile_count = ceil_div(K, get<2>(workgroup_shape));
 
     // Perform the collective scoped MMA
     CollectiveMainloop collective_mma;
@@ -294,6 +368,93 @@ public:
       smem_buf
     );
   }
+
+private:
+  // Persistent loop over the units of work handed out by the stream-K scheduler. A unit covers a k-tile
+  // range of one output tile; units that do not finish a tile hand their partial accumulators to the
+  // scheduler's fixup, which reduces them (deterministically or not, per the scheduler arguments) so that
+  // only the final unit of each tile runs the epilogue.
+  template <class ProblemShapeMNKL>
+  CUTLASS_DEVICE
+  void
+  run_stream_k(Params const& params, SharedStorage& shared_storage, char* smem_buf,
+               ProblemShapeMNKL const& problem_shape_MNKL) {
+    auto M = get<0>(problem_shape_MNKL);
+    auto N = get<1>(problem_shape_MNKL);
+    auto K = get<2>(problem_shape_MNKL);
+    auto L = get<3>(problem_shape_MNKL);
+
+    TileScheduler scheduler{params.scheduler};
+    auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
+
+    int thread_idx = int(ThreadIdxX());
+    constexpr auto workgroup_shape = WorkgroupTileShape{};                                                  // (BLK_M,BLK_N,BLK_K)
+    constexpr auto subgroup_shape = SubgroupTileShape{};                                                  // (SUB_M,SUB_N,SUB_K)
+
+    Tensor mA_mkl = cute::get_pvc_tensor(make_shape(M,K,L));   //(m,k,l)
+    Tensor mB_nkl = cute::get_pvc_tensor(make_shape(N,K,L));   //(n,k,l)
+
+    while (work_tile_info.is_valid()) {
+      const int m_coord = work_tile_info.M_idx;
+      const int n_coord = work_tile_info.N_idx;
+      const int l_coord = work_tile_info.L_idx;
+      auto blk_coord_mnkl = make_coord(m_coord, n_coord, _, l_coord);
+
+      Tensor gA = local_tile(mA_mkl, select<0,2>(workgroup_shape), make_coord(m_coord,_,l_coord));
+      Tensor gB = local_tile(mB_nkl, select<1,2>(workgroup_shape), make_coord(n_coord,_,l_coord));
+
+      // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
+      const int work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, workgroup_shape);
+      const int work_k_tile_start = TileScheduler::get_work_k_tile_start(work_tile_info);
+      auto k_tile_iter = cute::make_coord_iterator(idx2crd(work_k_tile_start, make_shape(K)), make_shape(K));
+
+      // Compute tile residues for predication
+      auto m_max_coord = M - get<0>(subgroup_shape) * m_coord;                             // M - SUB_M * m_coord
+      auto n_max_coord = N - get<1>(subgroup_shape) * n_coord;                             // N - SUB_N * n_coord
+      auto k_residue   = K - get<2>(subgroup_shape) * (K / get<2>(subgroup_shape));        // K - SUB_K * k_coord_max
+      auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
+
+      TiledMma tiled_mma;
+      Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(workgroup_shape));
+      clear(accumulators);
+
+      CollectiveMainloop collective_mma;
+      collective_mma(
+        accumulators,
+        gA,
+        gB,
+        accumulators,
+        k_tile_iter, work_k_tile_count,
+        residue_mnk,
+        blk_coord_mnkl,
+        K,
+        thread_idx,
+        smem_buf,
+        params.mainloop
+      );
+
+      // Perform reduction across splits, if needed
+      TileScheduler::fixup(params.scheduler, work_tile_info, accumulators, 1, 0);
+
+      if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
+        CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
+        epilogue(
+          problem_shape_MNKL,
+          subgroup_shape,
+          blk_coord_mnkl,
+          accumulators,
+          tiled_mma,
+          residue_mnk,
+          thread_idx,
+          smem_buf
+        );
+      }
+
+      // Get next work tile
+      auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+      work_tile_info = next_work_tile_info;
+    }
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/xe_mainloop_shared_storage.hpp"
 #include "cute/tensor.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -64,7 +65,8 @@ public:
   using ProblemShape = ProblemShape_;
   static_assert(cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
-  static_assert(cute::is_same_v<TileScheduler_, StreamKScheduler> or cute::is_same_v<TileScheduler_, PersistentScheduler>,
+  static_assert(cute::is_same_v<TileScheduler_, StreamKScheduler> or cute::is_same_v<TileScheduler_, PersistentScheduler> or
+                cute::is_same_v<TileScheduler_, DynamicPersistentScheduler>,
     "Xe cooperative pipeline does not support GroupScheduler.");
 
   // Mainloop derived types
@@ -110,7 +112,9 @@ public:
     EpilogueTensorStorage epilogue;
   };
 
-  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+  // The mainloop shares the allocation with the epilogue storage, which the Xe epilogues do not touch
+  static constexpr int SharedStorageSize = cute::max(static_cast<int>(sizeof(SharedStorage)),
+                                                     detail::XeMainloopSharedStorageSize<CollectiveMainloop>::value);
 
   // Device side arguments
   struct Arguments {
@@ -161,9 +165,11 @@ public:
 
     // Calculate workspace pointers
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = round_nearest(
+      CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue), MinWorkspaceAlignment);
 
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
-      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, workspace_ptr);
+      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, workspace_ptr + workspace_offset);
 
     return {
       args.mode,
@@ -180,12 +186,17 @@ public:
   can_implement(Arguments const& args) {
     bool mode_implementable = args.mode == GemmUniversalMode::kGemm or
           (args.mode == GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
-    return mode_implementable && TileScheduler::can_implement(args.scheduler);
+    return mode_implementable && TileScheduler::can_implement(args.scheduler) &&
+           CollectiveMainloop::can_implement(args.problem_shape, args.mainloop) &&
+           CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
   }
 
   static size_t
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
+    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size = round_nearest(workspace_size, MinWorkspaceAlignment);
+
     workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
       args.scheduler, args.problem_shape, args.hw_info, 1);
     return workspace_size;
@@ -196,9 +207,18 @@ public:
     CudaHostAdapter* cuda_adapter = nullptr) {
     Status status = Status::kSuccess;
     uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+    size_t workspace_offset = 0;
+
+    status = CollectiveEpilogue::initialize_workspace(
+      args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset = round_nearest(workspace_offset, MinWorkspaceAlignment);
+    if (status != Status::kSuccess) {
+      return status;
+    }
 
     status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr, stream, args.problem_shape, args.hw_info, 1);
+      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, 1);
 
     return status;
   }
@@ -273,7 +293,8 @@ public:
       auto residue_mnk = make_tuple(m_max_coord, n_max_coord, k_residue);
 
       TiledMma tiled_mma;
-      Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(workgroup_shape)); 
+      Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(workgroup_shape));
+      clear(accumulators);
 
       CollectiveMainloop collective_mma;
 
@@ -296,6 +317,25 @@ public:
       TileScheduler::fixup(
         params.scheduler, work_tile_info, accumulators, 1, 0);
 
+      // Get next work tile, and start pulling its first k-tiles into the cache while the epilogue of this one runs
+      auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+      if (next_work_tile_info.is_valid()) {
+        const auto next_tile_coord = make_coord(next_work_tile_info.M_idx, next_work_tile_info.N_idx, _,
+                                                next_work_tile_info.L_idx);
+        auto gA_next = local_tile(mA_mkl(_,_,next_work_tile_info.L_idx), workgroup_shape,
+                                  take<0, 3>(next_tile_coord), Step<_1,  X, _1>{});
+        auto gB_next = local_tile(mB_nkl(_,_,next_work_tile_info.L_idx), workgroup_shape,
+                                  take<0, 3>(next_tile_coord), Step< X, _1, _1>{});
+        collective_mma.prefetch_k_tiles(
+          gA_next,
+          gB_next,
+          TileScheduler::get_work_k_tile_start(next_work_tile_info),
+          TileScheduler::get_work_k_tile_count(next_work_tile_info, problem_shape_MNKL, workgroup_shape),
+          thread_idx,
+          params.mainloop
+        );
+      }
+
       if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
         CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
 
@@ -311,8 +351,6 @@ public:
         );
       }
 
-      // Get next work tile
-      auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
       work_tile_info = next_work_tile_info;
     }
   }
@@ -40,6 +40,7 @@
 #include "cutlass/platform/platform.h"
 #include "cutlass/fast_math.h"
 #include "cutlass/gemm_coord.h"
+#include "cutlass/gemm/kernel/xe_tile_swizzle.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -102,6 +103,9 @@ struct PersistentTileSchedulerXeStreamKParams {
   FastDivmod divmod_tiles_per_output_tile_{};
   RasterOrder raster_order_ = RasterOrder::AlongN;
 
+  // Number of output tiles along M covered by consecutive units of work before stepping along N
+  uint32_t swizzle_size_ = 1;
+
   // The splitting factor to be used in a split-K decomposition of the problem.
   // If this is set to a value greater than 1, stream-K decomposition logic
   // is bypassed in favor of a split-K decomposition.
@@ -337,7 +341,18 @@ struct PersistentTileSchedulerXeStreamKParams {
   cute::tuple<int32_t, int32_t>
   get_work_idx_m_and_n(
       uint64_t blk_per_grid_dim,
-      FastDivmodU64 const& divmod_blk_major) {
+      FastDivmodU64 const& divmod_blk_major,
+      uint64_t blocks_mn,
+      uint32_t swizzle_size) {
+
+    if (swizzle_size > 1) {
+      return XeTileSwizzle::get_tile_coord(
+        blk_per_grid_dim,
+        static_cast<uint32_t>(blocks_mn / divmod_blk_major.divisor),
+        static_cast<uint32_t>(divmod_blk_major.divisor),
+        swizzle_size,
+        RasterOrder::AlongN);
+    }
 
     uint64_t m_idx, n_idx;
     divmod_blk_major(m_idx, n_idx, blk_per_grid_dim);
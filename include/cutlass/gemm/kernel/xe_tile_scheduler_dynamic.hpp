@@ -0,0 +1,308 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent tile scheduler for Xe GEMM kernels that hands out output tiles from a global work queue
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/workspace.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cutlass/gemm/kernel/xe_tile_swizzle.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Persistent scheduler with dynamic load balancing. The grid holds one workgroup per Xe core. Each workgroup starts
+// on the tile matching its id and then claims the next unprocessed tile from an atomic counter in the workspace, so
+// workgroups that draw cheap tiles, or start late, take over more of the work instead of leaving a static tail.
+//
+// The workspace holds two counters: the number of tiles claimed beyond the first wave, and the number of workgroups
+// that found the queue empty. The last workgroup to retire resets both, so the kernel can be relaunched without
+// initializing the workspace again.
+template <class TileShape>
+class PersistentTileSchedulerXeDynamic {
+public:
+
+  using RasterOrder = PersistentTileSchedulerSm90Params::RasterOrder;
+  using RasterOrderOptions = PersistentTileSchedulerSm90Params::RasterOrderOptions;
+  using CounterType = int32_t;
+
+  static constexpr bool IsDynamicPersistent = true;
+  static constexpr int NumCounters = 2;
+
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    bool is_valid_tile = false;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, false};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t k_tiles_per_output_tile) const {
+      return true;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  struct Arguments {
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+  };
+
+  struct Params {
+    uint32_t blocks_m_ = 0;
+    uint32_t blocks_n_ = 0;
+    uint32_t blocks_l_ = 0;
+    uint32_t swizzle_size_ = 1;
+    RasterOrder raster_order_ = RasterOrder::AlongN;
+    CounterType* counters_ = nullptr;
+
+    CUTLASS_HOST_DEVICE
+    uint64_t
+    tiles_per_batch() const {
+      return static_cast<uint64_t>(blocks_m_) * blocks_n_;
+    }
+
+    CUTLASS_HOST_DEVICE
+    uint64_t
+    total_tiles() const {
+      return tiles_per_batch() * blocks_l_;
+    }
+  };
+
+private:
+  Params scheduler_params;
+  uint64_t current_work_linear_idx_ = 0;
+
+public:
+
+  template <class ProblemShapeMNKL, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      [[maybe_unused]] ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace = nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape_mnkl, tile_shape);
+
+    Params params;
+    params.blocks_m_ = problem_blocks.x;
+    params.blocks_n_ = problem_blocks.y;
+    params.blocks_l_ = problem_blocks.z;
+    params.raster_order_ = PersistentTileSchedulerSm90Params::get_rasterization_order(
+      problem_blocks.x, problem_blocks.y, arguments.raster_order);
+    // The scheduler does not see the operand types, so the swizzle heuristic assumes 16-bit A and B
+    params.swizzle_size_ = XeTileSwizzle::get_swizzle_size(
+      to_gemm_coord(problem_shape_mnkl), to_gemm_coord(tile_shape), 2, 2, hw_info,
+      arguments.max_swizzle_size, params.raster_order_);
+    params.counters_ = reinterpret_cast<CounterType*>(workspace);
+    return params;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Arguments const& args) {
+    return args.max_swizzle_size >= 1;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return round_nearest(NumCounters * sizeof(CounterType), MinWorkspaceAlignment);
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void* workspace, cudaStream_t stream, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* cuda_adapter = nullptr) {
+    return zero_workspace(workspace, NumCounters * sizeof(CounterType), stream, cuda_adapter);
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerXeDynamic() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerXeDynamic(Params const& params_) : scheduler_params(params_) {
+    current_work_linear_idx_ = uint64_t(BlockIdxX());
+  }
+
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_, scheduler_params);
+  }
+
+  CUTLASS_DEVICE
+  static WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx, Params const& params) {
+    if (linear_idx >= params.total_tiles()) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    uint64_t const tiles_per_batch = params.tiles_per_batch();
+    uint64_t const l_idx = linear_idx / tiles_per_batch;
+    auto [m_idx, n_idx] = XeTileSwizzle::get_tile_coord(
+      linear_idx - l_idx * tiles_per_batch, params.blocks_m_, params.blocks_n_, params.swizzle_size_,
+      params.raster_order_);
+    return {m_idx, n_idx, static_cast<int32_t>(l_idx), true};
+  }
+
+  // Claims the next tile from the work queue. Must be called by every thread of the workgroup: thread 0 performs
+  // the atomic and the result is broadcast to the rest of the workgroup.
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work() {
+    auto group = syclcompat::get_nd_item<1>().get_group();
+    uint64_t const grid_size = uint64_t(GridDimX());
+    uint64_t const total_tiles = scheduler_params.total_tiles();
+
+    CounterType claimed = 0;
+    if (ThreadIdxX() == 0) {
+      claimed = atomicAdd(&scheduler_params.counters_[0], CounterType(1));
+      if (grid_size + claimed >= total_tiles) {
+        // The queue is drained. Once every workgroup has seen that, reset the counters for the next launch.
+        threadfence();
+        if (atomicAdd(&scheduler_params.counters_[1], CounterType(1)) == static_cast<CounterType>(grid_size - 1)) {
+          atomicExch(&scheduler_params.counters_[0], CounterType(0));
+          atomicExch(&scheduler_params.counters_[1], CounterType(0));
+        }
+      }
+    }
+    claimed = sycl::group_broadcast(group, claimed, 0);
+    current_work_linear_idx_ = grid_size + static_cast<uint64_t>(claimed);
+  }
+
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  // Given the inputs, computes the total number of output workgroups this problem will compute over.
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_wg_shape_mnl(ProblemShape problem_shape_mnkl, TileShape tile_shape) {
+    auto problem_shape = cute::append<4>(problem_shape_mnkl, cute::Int<1>{});
+    return dim3(
+      static_cast<uint32_t>(cute::size(cute::ceil_div(cute::shape<0>(problem_shape), cute::shape<0>(tile_shape)))),
+      static_cast<uint32_t>(cute::size(cute::ceil_div(cute::shape<1>(problem_shape), cute::shape<1>(tile_shape)))),
+      static_cast<uint32_t>(cute::size(cute::shape<3>(problem_shape))));
+  }
+
+  // Launches one workgroup per Xe core, or one per tile if there are fewer tiles than cores
+  template <class ProblemShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShape problem_shape,
+      TileShape tile_shape,
+      [[maybe_unused]] ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size = true) {
+    dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape, tile_shape);
+    uint64_t const total_tiles = static_cast<uint64_t>(problem_blocks.x) * problem_blocks.y * problem_blocks.z;
+    uint64_t const workgroups = platform::min(total_tiles, static_cast<uint64_t>(platform::max(hw_info.sm_count, 1)));
+    return dim3(static_cast<uint32_t>(workgroups), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  // Every tile is computed by a single workgroup, so there is nothing to fix up
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(Params const&, WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t) {}
+
+  template <class ProblemShape, class TileShapeMNK>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape problem_shape, TileShapeMNK tile_shape) {
+    // All work units returned by this scheduler cover the entire K iteration space of the output tile assigned
+    // to the work unit.
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    // All work units returned by this scheduler start from K tile 0
+    return 0u;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -109,6 +109,7 @@ public:
     Arguments&
     operator=(Arguments const& args) {
       splits = args.splits;
+      max_swizzle_size = args.max_swizzle_size;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
       return *this;
@@ -118,6 +119,7 @@ public:
     Arguments&
     operator=(Arguments&& args) noexcept {
       splits = args.splits;
+      max_swizzle_size = args.max_swizzle_size;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
       return *this;
@@ -135,6 +137,9 @@ public:
     // If this is set to a value greater than 1, stream-K decomposition logic
     // is bypassed in favor of a split-K decomposition.
     int splits = 1;
+    // Upper bound on the number of output tiles along M visited by consecutive units of work. The swizzle size
+    // is picked from the problem size and the last level cache size, see XeTileSwizzle::get_swizzle_size.
+    int max_swizzle_size = 1;
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
     ReductionMode reduction_mode = ReductionMode::Deterministic;
     DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
@@ -175,6 +180,10 @@ public:
       args.decomposition_mode,
       workspace
     );
+    // Operand element sizes are not known to the scheduler, so the heuristic assumes 16-bit inputs
+    params.swizzle_size_ = static_cast<uint32_t>(XeTileSwizzle::get_swizzle_size(
+      to_gemm_coord(problem_shape_mnkl), to_gemm_coord(tile_shape), 2, 2, hw_info, args.max_swizzle_size,
+      RasterOrder::AlongN));
     return params;
   }
 
@@ -697,7 +706,9 @@ CUTLASS_DEVICE
 
     auto [work_idx_m, work_idx_n] = Params::get_work_idx_m_and_n(
                                           cta_per_grid_dim,
-                                          params.divmod_blk_major_
+                                          params.divmod_blk_major_,
+                                          params.divmod_batch_.divisor,
+                                          params.swizzle_size_
                                         );
 
     // Set the M, N, and L block offsets
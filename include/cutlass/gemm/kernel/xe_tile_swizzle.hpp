@@ -0,0 +1,158 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief L2-aware swizzled rasterization of output tiles for Xe GEMM kernels
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+#include "cute/container/tuple.hpp"
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel::detail {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Consecutive workgroups cover a group of `swizzle_size` tiles along the minor mode of the raster order before
+// stepping along the major mode, so the A and B panels of the tiles in flight are shared through the L2 cache
+// instead of being streamed once per row of tiles. Successive groups walk the major mode in opposite directions
+// (snake order) so that the panels at the turn are reused as well.
+struct XeTileSwizzle {
+
+  using RasterOrder = PersistentTileSchedulerSm90Params::RasterOrder;
+
+  // Returns the (M, N) tile coordinates of the `idx`-th workgroup of a batch with blocks_m x blocks_n tiles
+  CUTLASS_HOST_DEVICE
+  static cute::tuple<int32_t, int32_t>
+  get_tile_coord(uint64_t idx, uint32_t blocks_m, uint32_t blocks_n, uint32_t swizzle_size,
+                 RasterOrder raster_order) {
+    uint64_t const blocks_minor = raster_order == RasterOrder::AlongN ? blocks_m : blocks_n;
+    uint64_t const blocks_major = raster_order == RasterOrder::AlongN ? blocks_n : blocks_m;
+
+    uint64_t minor, major;
+    if (swizzle_size <= 1) {
+      minor = idx / blocks_major;
+      major = idx - minor * blocks_major;
+    } else {
+      uint64_t const tiles_per_group = swizzle_size * blocks_major;
+      uint64_t const group = idx / tiles_per_group;
+      uint64_t const idx_in_group = idx - group * tiles_per_group;
+      uint64_t const first_minor = group * swizzle_size;
+      // The last group is narrower when the minor mode is not a multiple of the swizzle size
+      uint64_t const group_size = platform::min(static_cast<uint64_t>(swizzle_size), blocks_minor - first_minor);
+      minor = first_minor + idx_in_group % group_size;
+      major = idx_in_group / group_size;
+      if (group & 1) {
+        major = blocks_major - 1 - major;
+      }
+    }
+
+    if (raster_order == RasterOrder::AlongN) {
+      return {static_cast<int32_t>(minor), static_cast<int32_t>(major)};
+    } else {
+      return {static_cast<int32_t>(major), static_cast<int32_t>(minor)};
+    }
+  }
+
+  // Size of the last level cache shared by all Xe cores, 0 if unknown
+  static size_t
+  query_device_llc_size() {
+#if defined(CUTLASS_ENABLE_SYCL)
+    auto dev = syclcompat::get_default_queue().get_device();
+    return static_cast<size_t>(dev.get_info<sycl::info::device::global_mem_cache_size>());
+#else
+    return 0;
+#endif
+  }
+
+  // Picks a power of two swizzle size, up to max_swizzle_size, for `problem_shape` tiled by `tile_shape`. No
+  // swizzle is applied when both operands fit in the last level cache. Otherwise the group keeps the operand
+  // footprint of a wave of W = sm_count workgroups smallest: a wave covering S tiles along the minor mode and W/S
+  // along the major mode touches S minor panels and W/S major panels, which is minimal for
+  // S = sqrt(W * major_panel_bytes / minor_panel_bytes).
+  static int
+  get_swizzle_size(
+      BatchedGemmCoord problem_shape,
+      GemmCoord tile_shape,
+      int sizeof_a,
+      int sizeof_b,
+      KernelHardwareInfo const& hw_info,
+      int max_swizzle_size,
+      RasterOrder raster_order) {
+    if (max_swizzle_size <= 1) {
+      return 1;
+    }
+
+    uint64_t const k = static_cast<uint64_t>(problem_shape.k());
+    uint64_t const operand_bytes = (static_cast<uint64_t>(problem_shape.m()) * sizeof_a +
+                                    static_cast<uint64_t>(problem_shape.n()) * sizeof_b) * k;
+    size_t const llc_size = query_device_llc_size();
+    if (llc_size > 0 && operand_bytes <= llc_size) {
+      return 1;
+    }
+
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    bool const along_n = raster_order == RasterOrder::AlongN;
+    uint64_t const a_panel_bytes = static_cast<uint64_t>(tile_shape.m()) * k * sizeof_a;
+    uint64_t const b_panel_bytes = static_cast<uint64_t>(tile_shape.n()) * k * sizeof_b;
+    uint64_t const minor_panel_bytes = along_n ? a_panel_bytes : b_panel_bytes;
+    uint64_t const major_panel_bytes = along_n ? b_panel_bytes : a_panel_bytes;
+    int const blocks_minor = along_n ? ceil_div(problem_shape.m(), tile_shape.m())
+                                     : ceil_div(problem_shape.n(), tile_shape.n());
+    double const best_size = std::sqrt(static_cast<double>(sm_count) * major_panel_bytes / minor_panel_bytes);
+
+    int swizzle_size = 1;
+    while (swizzle_size * 2 <= max_swizzle_size && swizzle_size * 2 <= blocks_minor &&
+           swizzle_size * 2 <= best_size) {
+      swizzle_size *= 2;
+    }
+    return swizzle_size;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
+
+////////////////////////////////////////////////////////////////////////////////
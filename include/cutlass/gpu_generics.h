@@ -355,6 +355,22 @@ CUTLASS_DEVICE int atomicCAS(int *address, int compare, int val) {
   return result;
 }
 
+template <typename T>
+CUTLASS_DEVICE T atomicExch(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return syclcompat::atomic_exchange<sycl::access::address_space::global_space>(address, val);
+#endif
+  return 0;
+}
+
+template <typename T>
+CUTLASS_DEVICE T atomicMax(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return syclcompat::atomic_fetch_max<sycl::access::address_space::global_space>(address, val);
+#endif
+  return 0;
+}
+
 // Error
 using cudaError_t = unsigned int;
 constexpr cudaError_t cudaSuccess = 0;
@@ -376,6 +392,86 @@ cudaError_t cudaGetLastError() {
 
 CUTLASS_HOST_DEVICE
 cudaError_t cudaGetDevice(int *device) {
+#if !defined(__SYCL_DEVICE_ONLY__)
+  *device = static_cast<int>(syclcompat::get_current_device_id());
+#endif
+  return cudaSuccess;
+}
+
+// Device management
+
+// Subset of the CUDA device properties consumed by the CUTLASS library and profiler
+struct cudaDeviceProp {
+  char name[256];
+  int major;
+  int minor;
+  int multiProcessorCount;
+  int clockRate;                // kHz
+  int l2CacheSize;              // bytes
+  size_t totalGlobalMem;        // bytes
+  size_t sharedMemPerBlockOptin;
+  int multiGpuBoardGroupID;
+};
+
+inline CUTLASS_HOST
+cudaError_t cudaGetDeviceCount(int *count) {
+  *count = static_cast<int>(syclcompat::device_count());
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaSetDevice(int device) {
+  if (device < 0 || static_cast<unsigned int>(device) >= syclcompat::device_count()) {
+    return cudaErrorUnknown;
+  }
+  syclcompat::select_device(device);
+  return cudaSuccess;
+}
+
+// Intel Xe GPUs report compute capability 1.1, which is the architecture number the library generator uses for
+// arch::IntelPVC kernels. Every other SYCL device (including CPU devices) reports 0.1 and only runs arch::Agnostic ones.
+inline CUTLASS_HOST
+cudaError_t cudaGetDeviceProperties(cudaDeviceProp *prop, int device) {
+  if (device < 0 || static_cast<unsigned int>(device) >= syclcompat::device_count()) {
+    return cudaErrorUnknown;
+  }
+  sycl::device const &dev = syclcompat::get_device(device);
+  namespace syclex = sycl::ext::oneapi::experimental;
+
+  *prop = cudaDeviceProp{};
+  std::string name = dev.get_info<sycl::info::device::name>();
+  name.copy(prop->name, sizeof(prop->name) - 1);
+
+  syclex::architecture arch = dev.get_info<syclex::info::device::architecture>();
+  bool is_intel_xe = arch == syclex::architecture::intel_gpu_pvc || arch == syclex::architecture::intel_gpu_bmg_g21;
+  prop->major = is_intel_xe ? 1 : 0;
+  prop->minor = 1;
+
+  prop->multiProcessorCount = static_cast<int>(dev.get_info<sycl::info::device::max_compute_units>());
+#if defined(SYCL_INTEL_TARGET)
+  // Count Xe cores rather than EUs, as KernelHardwareInfo does for the persistent tile schedulers
+  if (is_intel_xe) {
+    prop->multiProcessorCount = static_cast<int>(dev.get_info<sycl::ext::intel::info::device::gpu_slices>() *
+                                                 dev.get_info<sycl::ext::intel::info::device::gpu_subslices_per_slice>());
+  }
+#endif
+  prop->clockRate = static_cast<int>(dev.get_info<sycl::info::device::max_clock_frequency>()) * 1000;
+  prop->l2CacheSize = static_cast<int>(dev.get_info<sycl::info::device::global_mem_cache_size>());
+  prop->totalGlobalMem = static_cast<size_t>(dev.get_info<sycl::info::device::global_mem_size>());
+  prop->sharedMemPerBlockOptin = static_cast<size_t>(dev.get_info<sycl::info::device::local_mem_size>());
+  prop->multiGpuBoardGroupID = device;
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaDeviceSynchronize() {
+  syclcompat::get_default_queue().wait_and_throw();
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaStreamSynchronize(cudaStream_t stream) {
+  syclcompat::get_default_queue().wait_and_throw();
   return cudaSuccess;
 }
 
@@ -387,6 +483,30 @@ enum cudaMemcpyKind {
   cudaMemcpyDeviceToDevice = 3
 };
 
+inline CUTLASS_HOST
+cudaError_t cudaMalloc(void **devPtr, size_t size) {
+  *devPtr = syclcompat::malloc(size);
+  return *devPtr == nullptr && size != 0 ? cudaErrorUnknown : cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaFree(void *devPtr) {
+  syclcompat::free(devPtr);
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaMemset(void *devPtr, int value, size_t count) {
+  syclcompat::memset(devPtr, value, count);
+  return cudaSuccess;
+}
+
+inline CUTLASS_HOST
+cudaError_t cudaMemcpy(void *dst, void const *src, size_t count, cudaMemcpyKind kind) {
+  syclcompat::memcpy(dst, src, count);
+  return cudaSuccess;
+}
+
 CUTLASS_HOST_DEVICE
 cudaError_t cudaMemsetAsync(void *devPtr, unsigned int value, size_t count, cudaStream_t stream = nullptr) {
   syclcompat::fill_async(devPtr, value, count);
@@ -1986,6 +1986,33 @@ struct NumericArrayConverter<float_e5m2_t, cutlass::bfloat16_t, 2, Round> {
 
 namespace detail {
 
+#if defined(SYCL_INTEL_TARGET)
+/// Xe has no FP8 conversion instructions, but both FP8 formats convert exactly to fp16 with integer operations.
+/// E5M2 is the upper byte of an fp16. E4M3 becomes an fp16 once its exponent is rebiased, which a multiply by
+/// 2^(15 - 7) does for normals and subnormals alike; the E4M3 NaN encoding (S.1111.111) maps to an fp16 NaN.
+CUTLASS_DEVICE
+Array<cutlass::half_t, 4> xe_convert_e4m3x4_to_f16x4(uint32_t src) {
+  Array<cutlass::half_t, 4> out;
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < 4; ++i) {
+    uint16_t const bits = static_cast<uint16_t>((src >> (8 * i)) & 0xFF);
+    uint16_t const sign = static_cast<uint16_t>((bits & 0x80) << 8);
+    uint16_t const magnitude = static_cast<uint16_t>(bits & 0x7F);
+    out[i] = magnitude == 0x7F ? cutlass::half_t::bitcast(sign | 0x7E00)
+                               : cutlass::half_t::bitcast(sign | (magnitude << 7)) * cutlass::half_t(256);
+  }
+  return out;
+}
+
+CUTLASS_DEVICE
+Array<cutlass::half_t, 4> xe_convert_e5m2x4_to_f16x4(uint32_t src) {
+  uint32_t out[2];
+  out[0] = ((src & 0x000000FF) << 8) | ((src & 0x0000FF00) << 16);
+  out[1] = ((src & 0x00FF0000) >> 8) | (src & 0xFF000000);
+  return reinterpret_cast<Array<cutlass::half_t, 4> const&>(out);
+}
+#endif
+
 /// Special converters that can be used with 4 8-bit elements packed in a register.
 /// Common use is for fast FP8 converters.
 template <
@@ -2771,6 +2798,8 @@ struct NumericArrayConverterPacked4Element<cutlass::half_t, cutlass::float_e4m3_
         "cvt.rn.f16x2.e4m3x2 %1, hi;\n" \
         "}\n" : "=r"(out[0]), "=r"(out[1]) : "r"(src_packed));
     return reinterpret_cast<result_type const &>(out);
+  #elif defined(SYCL_INTEL_TARGET)
+    return xe_convert_e4m3x4_to_f16x4(reinterpret_cast<uint32_t const&>(source));
   #else
     result_type result;
     NumericConverter<result_element, source_element, Round> converter;
@@ -2871,6 +2900,8 @@ struct NumericArrayConverterPacked4Element<cutlass::half_t, cutlass::float_e5m2_
         "cvt.rn.f16x2.e5m2x2 %1, hi;\n" \
         "}\n" : "=r"(out[0]), "=r"(out[1]) : "r"(src_packed));
     return reinterpret_cast<result_type const &>(out);
+  #elif defined(SYCL_INTEL_TARGET)
+    return xe_convert_e5m2x4_to_f16x4(reinterpret_cast<uint32_t const&>(source));
   #else
     result_type result;
     NumericConverter<result_element, source_element, Round> converter;
@@ -2973,6 +3004,15 @@ struct NumericArrayConverterPacked4Element<cutlass::bfloat16_t, cutlass::float_e
     packed_out[0] = float2result(packed_tmp[0]);
     packed_out[1] = float2result(packed_tmp[1]);
 
+    return out;
+  #elif defined(SYCL_INTEL_TARGET)
+    // Every E4M3 value is exact in fp16, so widening through fp16 is exact as well
+    Array<cutlass::half_t, 4> tmp = xe_convert_e4m3x4_to_f16x4(reinterpret_cast<uint32_t const&>(source));
+    result_type out;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < 4; ++i) {
+      out[i] = result_element(float(tmp[i]));
+    }
     return out;
   #else
     result_type result;
@@ -3073,6 +3113,15 @@ struct NumericArrayConverterPacked4Element<cutlass::bfloat16_t, cutlass::float_e
     packed_out[0] = float2result(packed_tmp[0]);
     packed_out[1] = float2result(packed_tmp[1]);
 
+    return out;
+  #elif defined(SYCL_INTEL_TARGET)
+    // Every E5M2 value is exact in fp16, so widening through fp16 is exact as well
+    Array<cutlass::half_t, 4> tmp = xe_convert_e5m2x4_to_f16x4(reinterpret_cast<uint32_t const&>(source));
+    result_type out;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < 4; ++i) {
+      out[i] = result_element(float(tmp[i]));
+    }
     return out;
   #else
     result_type result;
@@ -5808,6 +5857,15 @@ private:
     // might be able to optimize it out since the index is a constexpr, but we choose to be safe about it here.
     uint32_t prmt_indices[4] = {0x4040, 0x4141, 0x4242, 0x4343};
     static_assert(RegArray::kElements <= 4, "Too many inputs for I4 ->F16 vector converter");
+#if defined(SYCL_INTEL_TARGET)
+    // Xe has no byte permute, but the same temporaries are a shift and an OR of each source byte
+    (void)prmt_indices;
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      uint32_t const byte = (src_reg >> (8 * ii)) & 0xFF;
+      r[ii] = byte | (byte << 16);
+    }
+#else
     CUTLASS_PRAGMA_UNROLL
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
       asm volatile(
@@ -5815,6 +5873,7 @@ private:
           : "=r"(r[ii])
           : "r"(src_reg), "n"(0), "r"(prmt_indices[ii]));
     }
+#endif
 
     // The below XOR does the following:
     // 1) Sets the exponent bits of the FP16 to the correct value for the FP16 magic_num. We will be constructing
@@ -5831,12 +5890,17 @@ private:
     // r[i] = (r[i] & and_mask) ^ xor_mask
     CUTLASS_PRAGMA_UNROLL
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
+#if defined(SYCL_INTEL_TARGET)
+      (void)immLut;
+      r[ii] = (r[ii] & and_mask) ^ xor_mask;
+#else
       asm volatile(
           "{\n"
           "  lop3.b32 %0, %0, %1, %2, %3;\n"
           "}\n"
           : "+r"(r[ii])
           : "n"(and_mask), "n"(xor_mask), "n"(immLut));
+#endif
     }
 
     // We will issue 2 hfmas that do the following:
@@ -5953,6 +6017,15 @@ private:
     // fp16s_67 = {0x00, u4_67, 0x00, u4_67}
     uint32_t prmt_indices[4] = {0x4040, 0x4141, 0x4242, 0x4343};
     static_assert(RegArray::kElements <= 4, "Too many inputs for u4 -> f16 vector converter");
+#if defined(SYCL_INTEL_TARGET)
+    // Xe has no byte permute, but the same temporaries are a shift and an OR of each source byte
+    (void)prmt_indices;
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      uint32_t const byte = (src_reg >> (8 * ii)) & 0xFF;
+      r[ii] = byte | (byte << 16);
+    }
+#else
     CUTLASS_PRAGMA_UNROLL
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
       asm volatile(
@@ -5960,6 +6033,7 @@ private:
           : "=r"(r[ii])
           : "r"(src_reg), "n"(0), "r"(prmt_indices[ii]));
     }
+#endif
 
     // The below XOR does the following:
     // Sets the exponent bits of the FP16 to the correct value for the FP16 magic_num. We will be constructing
@@ -5972,12 +6046,17 @@ private:
     // r[i] = (r[i] & and_mask) | or_mask
     CUTLASS_PRAGMA_UNROLL
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
+#if defined(SYCL_INTEL_TARGET)
+      (void)immLut;
+      r[ii] = (r[ii] & and_mask) | or_mask;
+#else
       asm volatile(
           "{\n"
           "  lop3.b32 %0, %0, %1, %2, %3;\n"
           "}\n"
           : "+r"(r[ii])
           : "n"(and_mask), "n"(or_mask), "n"(immLut));
+#endif
 
       // We will issue 2 hfmas that do the following:
       // For the high FP16:
@@ -6085,9 +6164,20 @@ private:
     // into result_ptr[0] and result_ptr[1]'s 08-15 and 24-31 bits, respectively.
     // Note that `__byte_perm(source_ptr[0], source_ptr[0], 0x9180);` won't achieve the same result and doesn't sign-extend the sign bit.
     // Thus, we use inline ptx `prmt.b32` instruction for the desired sign extend from s8x2 to s16x2.
+#if defined(SYCL_INTEL_TARGET)
+    // Sign-extend each s8 of the pair into its s16 lane with shifts, as Xe has no byte permute
+    (void)prmt_indices;
+    CUTLASS_PRAGMA_UNROLL
+    for (int ii = 0; ii < RegArray::kElements; ++ii) {
+      uint32_t const lo = static_cast<uint16_t>(static_cast<int16_t>(static_cast<int8_t>(src_reg >> (16 * ii))));
+      uint32_t const hi = static_cast<uint16_t>(static_cast<int16_t>(static_cast<int8_t>(src_reg >> (16 * ii + 8))));
+      r[ii] = lo | (hi << 16);
+    }
+#else
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
       asm volatile("prmt.b32 %0,%1,%1,%2;\n" : "=r"(r[ii]) : "r"(src_reg), "r"(prmt_indices[ii]));
     }
+#endif
 
     // In the absense of add.s16x2 instruction, use bit-wise operation to execute signed addition with magic numbers to achieve
     // the same result as add.s16x2 instruction.
@@ -6103,8 +6193,12 @@ private:
 
     for (int ii = 0; ii < RegArray::kElements; ++ii) {
       // The bit-wise operation executed below is `r[ii] = (r[ii] & 0x03FF03FF) ^ 0x66006600;`
+#if defined(SYCL_INTEL_TARGET)
+      r[ii] = (r[ii] & 0x03FF03FF) ^ 0x66006600;
+#else
       asm volatile("lop3.b32 %0, %1, %2, %3, %4;\n" :
                                 "=r"(r[ii]) : "r"(r[ii]), "n"(0x03FF03FF), "n"(0x66006600), "n"(kImmLut));
+#endif
     }
 
     static constexpr uint32_t bias_rep = 0x66006600;
@@ -6860,7 +6954,105 @@ public:
   }
 };
 
-#endif // defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+#elif defined(SYCL_INTEL_TARGET)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Converts packed 4-bit integers to bf16 on Xe. OR-ing a nibble into the mantissa of the float 2^23 gives exactly
+/// 2^23 + x, so a single subtraction recovers x (signed nibbles are biased by 8 with an XOR first), and the small
+/// integer result is truncated to bf16 without rounding.
+template <class PackedResultType, bool Signed>
+CUTLASS_DEVICE
+PackedResultType xe_convert_i4_to_bf16(uint32_t src_reg) {
+  static constexpr uint32_t magic_num = 0x4B000000;
+  static constexpr uint32_t bias = Signed ? 0x8 : 0x0;
+  static constexpr float magic_bias = Signed ? 8388616.0f : 8388608.0f;
+
+  PackedResultType result;
+  uint16_t* result_bits = reinterpret_cast<uint16_t*>(&result);
+  CUTLASS_PRAGMA_UNROLL
+  for (int ii = 0; ii < PackedResultType::kElements; ++ii) {
+    uint32_t const f32_bits = magic_num | (((src_reg >> (4 * ii)) & 0xF) ^ bias);
+    float const value = reinterpret_cast<float const&>(f32_bits) - magic_bias;
+    result_bits[ii] = static_cast<uint16_t>(reinterpret_cast<uint32_t const&>(value) >> 16);
+  }
+  return result;
+}
+
+} // namespace detail
+
+/// Array<cutlass::bfloat16_t, N> <= Array<cutlass::int4b_t or cutlass::uint4b_t, N> on Xe, shared by the specializations below
+template <typename S, FloatRoundStyle Round, int N>
+struct XeNumericArrayConverterBF16FromI4 {
+  using result_type = Array<cutlass::bfloat16_t, N>;
+  using source_type = Array<S, N>;
+
+  static FloatRoundStyle const round_style = Round;
+
+private:
+  using result_type_packed_8 = Array<cutlass::bfloat16_t, 8>;
+  using result_type_packed_4 = Array<cutlass::bfloat16_t, 4>;
+  using result_type_packed_2 = Array<cutlass::bfloat16_t, 2>;
+  using source_type_packed_8 = Array<S, 8>;
+  using source_type_packed_4 = Array<S, 4>;
+  using source_type_packed_2 = Array<S, 2>;
+
+  using ScalarConverter = NumericConverter<cutlass::bfloat16_t, S, Round>;
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_2 const& source) {
+    return static_cast<uint32_t>(
+      reinterpret_cast<const uint8_t&>(source));
+  }
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_4 const& source) {
+    return static_cast<uint32_t>(
+      reinterpret_cast<const uint16_t&>(source));
+  }
+
+  CUTLASS_DEVICE
+  static uint32_t to_reg(source_type_packed_8 const& source) {
+    return reinterpret_cast<const uint32_t&>(source);
+  }
+
+  template <typename PackedResultType, typename PackedSrcType>
+  CUTLASS_DEVICE
+  static PackedResultType packed_convert(PackedSrcType const &source) {
+    return detail::xe_convert_i4_to_bf16<PackedResultType, platform::is_same<S, cutlass::int4b_t>::value>(to_reg(source));
+  }
+
+  friend class detail::VectorizedConverter;
+public:
+  CUTLASS_DEVICE
+  static result_type convert(source_type const &source) {
+    result_type result;
+    using ConverterType = XeNumericArrayConverterBF16FromI4<S, Round, N>;
+    detail::VectorizedConverter::convert<ConverterType,
+                                         result_type_packed_8, source_type_packed_8,
+                                         result_type_packed_4, source_type_packed_4,
+                                         result_type_packed_2, source_type_packed_2>(result, source);
+
+    return result;
+  }
+
+  CUTLASS_DEVICE
+  result_type operator()(source_type const &s) const {
+    return convert(s);
+  }
+};
+
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::int4b_t, N, Round>
+  : XeNumericArrayConverterBF16FromI4<cutlass::int4b_t, Round, N> {};
+
+template <FloatRoundStyle Round, int N>
+struct NumericArrayConverter<cutlass::bfloat16_t, cutlass::uint4b_t, N, Round>
+  : XeNumericArrayConverterBF16FromI4<cutlass::uint4b_t, Round, N> {};
+
+#endif // defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800) || defined(SYCL_INTEL_TARGET)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,7 +62,9 @@ zero_workspace(void* workspace, size_t workspace_size, cudaStream_t stream = nul
     CUTLASS_TRACE_HOST("  clearing workspace");
 
 #if defined (CUTLASS_ENABLE_SYCL)
-    syclcompat::memset_async(workspace, 0, workspace_size);
+    // A non-null stream is the sycl::queue the memset is submitted to
+    sycl::queue queue = stream ? *static_cast<sycl::queue*>(stream) : syclcompat::get_default_queue();
+    syclcompat::memset_async(workspace, 0, workspace_size, queue);
 #elif defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
     //
     // Use the cuda host adapter
@@ -103,7 +105,11 @@ fill_workspace(void* workspace, T fill_value, size_t fill_count, cudaStream_t st
 
     CUTLASS_TRACE_HOST("  filling workspace");
 
-#if defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
+#if defined (CUTLASS_ENABLE_SYCL)
+    // A non-null stream is the sycl::queue the fill is submitted to
+    sycl::queue queue = stream ? *static_cast<sycl::queue*>(stream) : syclcompat::get_default_queue();
+    syclcompat::fill_async(workspace, fill_value, fill_count, queue);
+#elif defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
     //
     // Use the cuda host adapter
     //
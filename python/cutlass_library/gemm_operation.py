@@ -299,7 +299,11 @@ class GemmOperation:
       if self.ScaleFactorD.element != DataType.void:
         return EpilogueScheduleSuffixes[self.epilogue_schedule] + "_epiVs" + str(self.ScaleFactorVectorSize)+ShortLayoutTypeNames[self.ScaleFactorD.layout]
     
-    return EpilogueScheduleSuffixes[self.epilogue_schedule]
+    epilogue_functor_suffix = ''
+    if isinstance(self.epilogue_functor, EpilogueFunctor3x):
+      epilogue_functor_suffix = EpilogueFunctor3xSuffixes[self.epilogue_functor]
+
+    return EpilogueScheduleSuffixes[self.epilogue_schedule] + epilogue_functor_suffix
 
   # Generate a short string representing the operation class
   def opcode_class_name(self):
@@ -309,7 +313,8 @@ class GemmOperation:
   def procedural_name(self):
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
     opcode_class_name = OpcodeClassNames[self.tile_description.math_instruction.opcode_class]
-    if self.arch >= 90:
+    # Intel PVC kernels (arch 11) are CUTLASS 3.x kernels and are named like them
+    if self.arch >= 90 or self.arch == 11:
       kernel_name_template = "cutlass{p}_sm{ar}_{op}_{ex}{ct}{cs}_{l}_{s}_align{al}{t}{k}{e}"
       return kernel_name_template.format(
           p = self.prefix,
@@ -761,6 +766,7 @@ class EmitGemmUniversal3xInstance:
       "cutlass/gemm/kernel/gemm_universal.hpp",
       "cutlass/gemm/collective/collective_builder.hpp",
       "cutlass/epilogue/collective/collective_builder.hpp",
+      "cutlass/epilogue/thread/activation.h",
     ]
     self.builtin_epilogue_functor_template = \
 """${epilogue_functor}<
@@ -769,6 +775,22 @@ class EmitGemmUniversal3xInstance:
       ${element_c},
       ${element_epilogue}
     >"""
+    self.builtin_eltact_epilogue_functor_template = \
+"""${epilogue_functor}<
+      ${activation},
+      ${element_d},
+      ${element_epilogue},
+      ${element_c},
+      ${element_epilogue}
+    >"""
+    self.builtin_per_col_bias_epilogue_functor_template = \
+"""${epilogue_functor}<
+      ${element_d},
+      ${element_epilogue},
+      ${element_epilogue},
+      ${element_c},
+      ${element_epilogue}
+    >"""
 
     self.gemm_template = """
 
@@ -897,7 +919,11 @@ ${compile_guard_end}
     
  
     # stage count set to zero indicates builder automatic stage selection
-    if operation.tile_description.stages > 0:
+    is_intel_pvc_kernel = (operation.arch == 11)
+    if is_intel_pvc_kernel:
+      # The Xe builder sizes its prefetch pipeline itself and only accepts StageCountAuto
+      stage_count_string = "cutlass::gemm::collective::StageCountAuto"
+    elif operation.tile_description.stages > 0:
       stage_count_string = f"cutlass::gemm::collective::StageCount<{str(operation.tile_description.stages)}>"
     else:
       stage_count_string = f"cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename {str(operation.procedural_name())}_epilogue::SharedStorage))>"
@@ -916,7 +942,13 @@ ${compile_guard_end}
         'element_epilogue': str(DataTypeTag[operation.element_epilogue]),
         'epilogue_functor': EpilogueFunctor3xTag[operation.epilogue_functor],
       }
-      epilogue_functor = SubstituteTemplate(self.builtin_epilogue_functor_template, values)
+      epilogue_functor_template = self.builtin_epilogue_functor_template
+      if operation.epilogue_functor in EpilogueFunctor3xActivationTag:
+        values['activation'] = EpilogueFunctor3xActivationTag[operation.epilogue_functor]
+        epilogue_functor_template = self.builtin_eltact_epilogue_functor_template
+      elif operation.epilogue_functor == EpilogueFunctor3x.LinCombPerColBias:
+        epilogue_functor_template = self.builtin_per_col_bias_epilogue_functor_template
+      epilogue_functor = SubstituteTemplate(epilogue_functor_template, values)
       
       if is_block_scaled(operation.gemm_kind) and operation.ScaleFactorD.element != DataType.void:
         epilogue_functor =  self.emit_block_scale_epilogue_functor(operation)
@@ -1029,7 +1061,7 @@ using {operation_name_str}_LayoutNarrowReordered = decltype(cute::tile_to_shape(
       'element_accumulator': DataTypeTag[operation.accumulator_type()],
       'opcode_class_main': OpcodeClassTag[opcode_class_main],
       'opcode_class_epi': OpcodeClassTag[opcode_class_epi],
-      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'arch': "cutlass::arch::IntelPVC" if is_intel_pvc_kernel else "cutlass::arch::Sm%d" % operation.arch,
       'tile_shape_m': str(tile_shape_m),
       'tile_shape_n': str(tile_shape_n),
       'tile_shape_k': str(tile_shape_k),
@@ -1491,6 +1523,12 @@ void initialize_${configuration_name}(Manifest &manifest) {
 
   def __exit__(self, exception_type, exception_value, traceback):
 
+    # Intel PVC configurations are compiled for SYCL, which does not build the CUDA only GEMM wrappers
+    if self.operations and all(operation.arch == 11 for operation in self.operations):
+      for incl in ["gemm_operation.h", "grouped_gemm_operation_3x.hpp", "sparse_gemm_operation_3x.hpp",
+                   "block_scaled_gemm_operation_3x.hpp", "cutlass/arch/wmma.h"]:
+        self.includes.pop(incl, None)
+
     # Write includes
     for incl, _ in self.includes.items():
       include_statement = "#include \"%s\"\n" % incl
@@ -232,7 +232,8 @@ def CreateGemmUniversal3xOperator(
       narrow_dtype_bits, wide_dtype_bits = (B_dtype_bits, A_dtype_bits)
 
     mixed_input_modes = [None]
-    if narrow_dtype_bits != wide_dtype_bits:
+    # Intel PVC mixed input kernels only convert the narrow operand, see GemmOperation
+    if narrow_dtype_bits != wide_dtype_bits and tile_description.minimum_compute_capability != 11:
       if narrow_dtype == DataType.s4 and (wide_dtype == DataType.e4m3 or wide_dtype == DataType.e5m2):
         mixed_input_modes = [MixedInputMode.ScaleOnly]
       else:
@@ -9354,12 +9355,26 @@ def GeneratePVC_TensorOp_16b_gemm(manifest, cuda_version):
           [8, 16, 16],
           DataType.bf16, DataType.bf16, DataType.f32,
           OpcodeClass.TensorOp,
-          MathOperation.multiply_add)
+          MathOperation.multiply_add),
+      MathInstruction(
+          [8, 16, 16],
+          DataType.f16, DataType.f16, DataType.f32,
+          OpcodeClass.TensorOp,
+          MathOperation.multiply_add),
     ]
 
     min_cc = 11
     max_cc = 11
 
+    # Epilogue fusions whose arguments can be expressed through GemmUniversalArguments
+    epilogue_functors = [
+      EpilogueFunctor3x.LinearCombination,
+      EpilogueFunctor3x.LinCombReLU,
+      EpilogueFunctor3x.LinCombGELU,
+      EpilogueFunctor3x.LinCombSiLU,
+      EpilogueFunctor3x.LinCombPerColBias,
+    ]
+
     for math_inst in math_instructions:
       tile_descriptions = [
         TileDescription([256, 256, 32],
@@ -9370,6 +9385,108 @@ def GeneratePVC_TensorOp_16b_gemm(manifest, cuda_version):
             0, [8, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
         TileDescription([128, 256, 16],
             0, [4, 8, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([64, 128, 32],
+            0, [2, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([32, 128, 32],
+            0, [1, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([8, 128, 32],
+            0, [1, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+      ]
+
+      data_type = {
+        "a_type" : math_inst.element_a,
+        "b_type" : math_inst.element_b,
+        "c_type" : math_inst.element_accumulator,
+        "d_type" : math_inst.element_accumulator,
+        "acc_type" : math_inst.element_accumulator,
+        "epi_type" : math_inst.element_accumulator
+      }
+
+      schedules = [[KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto]]
+
+      for epilogue_functor in epilogue_functors:
+        CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_type, schedules,
+          epilogue_functor=epilogue_functor,
+          tile_schedulers=[TileSchedulerType.Persistent, TileSchedulerType.StreamK])
+
+def GeneratePVC_TensorOp_tf32_gemm(manifest, cuda_version):
+    # The tf32 A operand is only loaded from row-major memory
+    layouts = [
+      [[LayoutType.RowMajor, 1], [LayoutType.RowMajor, 1], [LayoutType.RowMajor, 4]],
+      [[LayoutType.RowMajor, 1], [LayoutType.ColumnMajor, 1], [LayoutType.RowMajor, 4]],
+    ]
+
+    math_instructions = [
+      MathInstruction(
+          [8, 16, 8],
+          DataType.tf32, DataType.tf32, DataType.f32,
+          OpcodeClass.TensorOp,
+          MathOperation.multiply_add)
+    ]
+
+    min_cc = 11
+    max_cc = 11
+
+    for math_inst in math_instructions:
+      tile_descriptions = [
+        TileDescription([256, 256, 32],
+            0, [8, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([256, 128, 32],
+            0, [8, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([128, 256, 32],
+            0, [4, 8, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([64, 128, 32],
+            0, [2, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([8, 128, 32],
+            0, [1, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+      ]
+
+      data_type = {
+        "a_type" : math_inst.element_a,
+        "b_type" : math_inst.element_b,
+        "c_type" : math_inst.element_accumulator,
+        "d_type" : math_inst.element_accumulator,
+        "acc_type" : math_inst.element_accumulator,
+        "epi_type" : math_inst.element_accumulator
+      }
+
+      schedules = [[KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto]]
+
+      CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_type, schedules,
+        tile_schedulers=[TileSchedulerType.Persistent, TileSchedulerType.StreamK])
+
+def GeneratePVC_TensorOp_int8_gemm(manifest, cuda_version):
+    # 8-bit operands are only loaded from row-major memory
+    layouts = [
+      [[LayoutType.RowMajor, 4], [LayoutType.RowMajor, 4], [LayoutType.RowMajor, 4]],
+    ]
+
+    math_instructions = [
+      MathInstruction(
+          [8, 16, 32],
+          DataType.s8, DataType.s8, DataType.s32,
+          OpcodeClass.TensorOp,
+          MathOperation.multiply_add),
+      MathInstruction(
+          [8, 16, 32],
+          DataType.u8, DataType.u8, DataType.s32,
+          OpcodeClass.TensorOp,
+          MathOperation.multiply_add),
+    ]
+
+    min_cc = 11
+    max_cc = 11
+
+    for math_inst in math_instructions:
+      tile_descriptions = [
+        TileDescription([256, 256, 32],
+            0, [8, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([256, 128, 32],
+            0, [8, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([128, 256, 32],
+            0, [4, 8, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+        TileDescription([64, 128, 32],
+            0, [2, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
         TileDescription([8, 128, 32],
             0, [1, 4, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
       ]
@@ -9385,10 +9502,62 @@ def GeneratePVC_TensorOp_16b_gemm(manifest, cuda_version):
 
       schedules = [[KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto]]
 
-      CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_type, schedules, tile_schedulers=[TileSchedulerType.Persistent])
+      CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_type, schedules,
+        tile_schedulers=[TileSchedulerType.Persistent, TileSchedulerType.StreamK])
+
+def GeneratePVC_TensorOp_mixed_input_gemm(manifest, cuda_version):
+    # Mixed input kernels convert the narrow operand to the MMA type in registers. The narrow
+    # operand loads are K-major for 8-bit A and N-major for 4-bit B, so only row-major is supported.
+    min_cc = 11
+    max_cc = 11
+
+    # The upconverted 8-bit A is loaded in 32x32 blocks and the upconverted 4-bit B in 64x64 blocks, which
+    # limits the workgroup tiles to those whose subgroup tiles are multiples of these.
+    mixed_inputs = [
+      # (A, B, alignment A, alignment B, [(workgroup tile, subgroups)])
+      (DataType.s8, DataType.bf16, 4, 2, [([256, 256, 32], [8, 4, 1]), ([128, 256, 32], [4, 8, 1]), ([32, 256, 32], [1, 8, 1])]),
+      (DataType.s8, DataType.f16, 4, 2, [([256, 256, 32], [8, 4, 1]), ([128, 256, 32], [4, 8, 1]), ([32, 256, 32], [1, 8, 1])]),
+      (DataType.bf16, DataType.s4, 2, 8, [([256, 256, 64], [8, 4, 1])]),
+      (DataType.f16, DataType.s4, 2, 8, [([256, 256, 64], [8, 4, 1])]),
+    ]
+
+    for element_a, element_b, alignment_a, alignment_b, tiles in mixed_inputs:
+      math_inst = MathInstruction(
+          [8, 16, 16],
+          element_a, element_b, DataType.f32,
+          OpcodeClass.TensorOp,
+          MathOperation.multiply_add)
+
+      layouts = [
+        [[LayoutType.RowMajor, alignment_a], [LayoutType.RowMajor, alignment_b], [LayoutType.RowMajor, 4]],
+      ]
+
+      tile_descriptions = [
+        TileDescription(tile_shape,
+            0, warp_count, math_inst, min_cc, max_cc, [1, 1, 1])
+        for tile_shape, warp_count in tiles
+      ]
+
+      data_type = {
+        "a_type" : math_inst.element_a,
+        "b_type" : math_inst.element_b,
+        "c_type" : math_inst.element_accumulator,
+        "d_type" : math_inst.element_accumulator,
+        "acc_type" : math_inst.element_accumulator,
+        "epi_type" : math_inst.element_accumulator
+      }
+
+      schedules = [[KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto]]
+
+      # The mixed input mainloop only runs on the non-persistent kernel
+      CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_type, schedules,
+        tile_schedulers=[TileSchedulerType.Default])
 
 def GeneratePVC(manifest, cuda_version):
     GeneratePVC_TensorOp_16b_gemm(manifest, cuda_version)
+    GeneratePVC_TensorOp_tf32_gemm(manifest, cuda_version)
+    GeneratePVC_TensorOp_int8_gemm(manifest, cuda_version)
+    GeneratePVC_TensorOp_mixed_input_gemm(manifest, cuda_version)
 
 ###################################################################################################
 
@@ -9461,6 +9630,7 @@ if __name__ == "__main__":
   GenerateSM80(manifest, args.cuda_version)
   GenerateSM89(manifest, args.cuda_version)
   GenerateSM90(manifest, args.cuda_version)
+  GeneratePVC(manifest, args.cuda_version)
 
   
   blackwell_enabled_arch = args.architectures == "100a"
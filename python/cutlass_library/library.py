@@ -674,11 +674,36 @@ EpilogueScheduleSuffixes = {
 class EpilogueFunctor3x(enum.Enum):
   LinearCombination = enum_auto()
   LinearCombinationBlockScaleFactor = enum_auto() 
+  LinCombReLU = enum_auto()
+  LinCombGELU = enum_auto()
+  LinCombSiLU = enum_auto()
+  LinCombPerColBias = enum_auto()
 
 #
 EpilogueFunctor3xTag = {
   EpilogueFunctor3x.LinearCombination: 'cutlass::epilogue::fusion::LinearCombination',
   EpilogueFunctor3x.LinearCombinationBlockScaleFactor: 'cutlass::epilogue::fusion::LinCombBlockScaleFactor',  
+  EpilogueFunctor3x.LinCombReLU: 'cutlass::epilogue::fusion::LinCombEltAct',
+  EpilogueFunctor3x.LinCombGELU: 'cutlass::epilogue::fusion::LinCombEltAct',
+  EpilogueFunctor3x.LinCombSiLU: 'cutlass::epilogue::fusion::LinCombEltAct',
+  EpilogueFunctor3x.LinCombPerColBias: 'cutlass::epilogue::fusion::LinCombPerColBias',
+}
+
+# Elementwise activation applied by the LinCombEltAct fusions
+EpilogueFunctor3xActivationTag = {
+  EpilogueFunctor3x.LinCombReLU: 'cutlass::epilogue::thread::ReLu',
+  EpilogueFunctor3x.LinCombGELU: 'cutlass::epilogue::thread::GELU',
+  EpilogueFunctor3x.LinCombSiLU: 'cutlass::epilogue::thread::SiLu',
+}
+
+#
+EpilogueFunctor3xSuffixes = {
+  EpilogueFunctor3x.LinearCombination: '',
+  EpilogueFunctor3x.LinearCombinationBlockScaleFactor: '',
+  EpilogueFunctor3x.LinCombReLU: '_relu',
+  EpilogueFunctor3x.LinCombGELU: '_gelu',
+  EpilogueFunctor3x.LinCombSiLU: '_silu',
+  EpilogueFunctor3x.LinCombPerColBias: '_bias',
 }
 
 def to_grouped_schedule(schedule, grouped):
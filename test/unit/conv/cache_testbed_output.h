@@ -48,7 +48,11 @@
 #include "cutlass/core_io.h"
 #include "cutlass/util/tensor_view_io.h"
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include <vector>
+#else
 #include "thrust/universal_vector.h"
+#endif
 
 #ifndef CUTLASS_TEST_ENABLE_CACHED_RESULTS
 #define CUTLASS_TEST_ENABLE_CACHED_RESULTS false
@@ -60,6 +64,33 @@ namespace test::conv::device {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(CUTLASS_ENABLE_SYCL)
+/// Host and device accessible buffer standing in for thrust::universal_vector, backed by shared USM.
+/// data() returns a wrapper whose get() yields the raw pointer, as thrust::universal_ptr does.
+template <typename Element>
+class universal_vector {
+  using Allocator = sycl::usm_allocator<Element, sycl::usm::alloc::shared>;
+  std::vector<Element, Allocator> storage_{Allocator(syclcompat::get_default_queue())};
+
+public:
+  universal_vector() = default;
+  explicit universal_vector(size_t count) { storage_.resize(count); }
+
+  struct pointer {
+    Element* ptr;
+    Element* get() const { return ptr; }
+  };
+
+  pointer data() { return {storage_.data()}; }
+  size_t size() const { return storage_.size(); }
+  void resize(size_t count) { storage_.resize(count); }
+};
+#else
+using thrust::universal_vector;
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Result of a test
 struct CachedTestKey {
 
@@ -548,7 +579,7 @@ uint32_t TensorHash(
 
 template <typename Element>
 uint32_t TensorHash(
-  thrust::universal_vector<Element>& tensor,
+  universal_vector<Element>& tensor,
   CRC32 const &hash = CRC32(), 
   uint32_t crc = uint32_t()
 ) {
@@ -864,9 +895,9 @@ inline CachedTestKey CreateCachedConvNd3xTestKey(
   ProblemShape const& problem_shape,
   double alpha,
   double beta,
-  thrust::universal_vector<ElementA> A,
-  thrust::universal_vector<ElementB> B,
-  thrust::universal_vector<ElementC> C
+  universal_vector<ElementA> A,
+  universal_vector<ElementB> B,
+  universal_vector<ElementC> C
 ) {
 
   CachedTestKey key;
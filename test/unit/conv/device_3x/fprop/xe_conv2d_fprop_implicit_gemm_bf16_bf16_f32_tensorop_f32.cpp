@@ -0,0 +1,178 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the Intel PVC implicit GEMM fprop kernel
+*/
+
+#include "cutlass_unit_test.h"
+
+#include "../xe_conv_configuration.hpp"
+#include "../testbed_conv.hpp"
+using namespace cute;
+
+namespace {
+
+using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+
+std::vector<ProblemShape> xe_conv2d_fprop_problems() {
+  std::vector<ProblemShape> problem_shapes;
+  // 1x1 filter
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,  8, 8, 64},  // nhwc
+    {64, 1, 1, 64},  // krsc
+    {0, 0},          // padding lower (pad_h, pad_w)
+    {0, 0},          // padding upper (pad_h, pad_w)
+    {1, 1},          // stride (stride_h, stride_w)
+    {1, 1},          // dilation (dilation_h, dilation_w)
+    1                // group
+  });
+  // non-packed input strides
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,    8,   8,  64},  // nhwc
+    {8000, 800, 80, 1},   // stride (nhwc)
+    {64,   1,   1,  64},  // krsc
+    {64,   64,  64, 1},   // stride (krsc)
+    {0, 0},
+    {0, 0},
+    {1, 1},
+    {1, 1},
+    1
+  });
+  // 3x3 filter, symmetric padding with c % BLK_K != 0
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   8, 8, 40},
+    {256, 3, 3, 40},
+    {1, 1},
+    {1, 1},
+    {1, 1},
+    {1, 1},
+    1
+  });
+  // 2x5 filter, asymmetric padding 1,1/2,2
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   8, 8, 64},
+    {256, 2, 5, 64},
+    {1, 1},
+    {2, 2},
+    {1, 1},
+    {1, 1},
+    1
+  });
+  // 2x5 filter, asymmetric padding 1,0/1,0, w/ stride
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   7, 7, 64},
+    {256, 2, 5, 64},
+    {1, 1},
+    {0, 0},
+    {2, 3},
+    {1, 1},
+    1
+  });
+  // 2x5 filter, asymmetric padding 1,0/1,0, w/ dilation
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   16, 16, 64},
+    {256, 2,  5,  64},
+    {1, 1},
+    {0, 0},
+    {1, 1},
+    {2, 3},
+    1
+  });
+  // 2x5 filter, asymmetric padding 1,0/1,0, w/ stride, w/ dilation
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   16, 15, 64},
+    {256, 2,  5,  64},
+    {1, 1},
+    {0, 0},
+    {2, 3},
+    {2, 3},
+    1
+  });
+  // 3x3 filter, stride 2, several workgroups with partial tiles in M and N
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {3,   40, 40, 48},
+    {136, 3,  3,  48},
+    {1, 1},
+    {1, 1},
+    {2, 2},
+    {1, 1},
+    1
+  });
+  return problem_shapes;
+}
+
+} // namespace
+
+TEST(XE_Device_Conv2d_fprop_implicitgemm_bf16nhwc_bf16nhwc_f32nhwc_tensor_op_f32, 256x128x32) {
+  using Conv = test::conv::device::XeConvBF16<cutlass::conv::Operator::kFprop,
+      Shape<_256, _128, _32>, test::conv::device::XeConvTiledMmaBF16_256x128>::Conv;
+
+  EXPECT_TRUE(test::conv::device::TestAllConv<Conv>(xe_conv2d_fprop_problems()));
+  EXPECT_TRUE(test::conv::device::TestAllConv<Conv>(xe_conv2d_fprop_problems(), /*alpha=*/1.0, /*beta=*/1.0));
+}
+
+TEST(XE_Device_Conv2d_fprop_implicitgemm_bf16nhwc_bf16nhwc_f32nhwc_tensor_op_f32, 256x128x32_non_packed_output) {
+  using Conv = test::conv::device::XeConvBF16<cutlass::conv::Operator::kFprop,
+      Shape<_256, _128, _32>, test::conv::device::XeConvTiledMmaBF16_256x128>::Conv;
+
+  // The output is written as a row-major (M,N) matrix, so padded output rows must be rejected
+  ProblemShape problem_shape{
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,    8,   8,  64},  // nhwc
+    {4096, 512, 64, 1},   // stride (nhwc)
+    {64,   1,   1,  64},  // krsc
+    {64,   64,  64, 1},   // stride (krsc)
+    {8000, 800, 80, 1},   // stride (npqk)
+    {0, 0},
+    {0, 0},
+    {1, 1},
+    {1, 1},
+    1
+  };
+  auto [M, N, K, L] = Conv::ConvKernel::CollectiveMainloop::get_problem_shape_MNKL(problem_shape);
+  auto stride_D = cutlass::make_cute_packed_stride(typename Conv::ConvKernel::StrideD{}, cute::make_shape(M, N, 1));
+  typename Conv::Arguments arguments{
+    problem_shape,
+    {nullptr, nullptr},
+    {{1.f, 0.f}, nullptr, stride_D, nullptr, stride_D},
+    {}
+  };
+  EXPECT_FALSE(Conv::can_implement(arguments) == cutlass::Status::kSuccess);
+}
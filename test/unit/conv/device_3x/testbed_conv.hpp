@@ -42,7 +42,9 @@
 #include "cutlass/conv/convnd_problem_shape.hpp"
 #include "../test/unit/gemm/device/gemm_testbed_3x.hpp"
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include "thrust/universal_vector.h"
+#endif
 #include "cutlass/util/distribution.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/tensor_view_io.h"
@@ -70,7 +72,7 @@ namespace test::conv::device {
 template <typename Element>
 static void
 initialize_values(
-    thrust::universal_vector<Element>& dst_ptr,
+    universal_vector<Element>& dst_ptr,
     cutlass::Distribution::Kind dist_kind,
     uint64_t seed) {
   if (cutlass::Distribution::Uniform == dist_kind) {
@@ -121,8 +123,8 @@ struct DenseConvParams {
   // get the default arguments without sparse data
   auto get_mainloop_arguments(
     [[maybe_unused]] ProblemShape const& problem_shape,
-    thrust::universal_vector<ElementA>& tensor_A,
-    thrust::universal_vector<ElementB>& tensor_B
+    universal_vector<ElementA>& tensor_A,
+    universal_vector<ElementB>& tensor_B
   ) {
     auto args = typename Conv::ConvKernel::MainloopArguments {
       tensor_A.data().get(),
@@ -187,6 +189,12 @@ struct ConvTestbed {
   using Splits = typename gemm::device::detail::Splits;
 
   using Schedule = typename Conv::DispatchPolicy::Schedule;
+#if defined(SYCL_INTEL_TARGET)
+  // Intel PVC convolutions write the output as a packed row-major (M,N) matrix of the linearized GEMM
+  static constexpr bool IsXeConv = cute::is_base_of_v<cutlass::conv::KernelImplicitIntelPVC, Schedule>;
+#else
+  static constexpr bool IsXeConv = false;
+#endif
   /// Initialization
   cutlass::Distribution::Kind init_A = cutlass::Distribution::Uniform;
   cutlass::Distribution::Kind init_B = cutlass::Distribution::Uniform;
@@ -196,14 +204,14 @@ struct ConvTestbed {
   uint64_t seed = 6090;
   float epsilon = 0.0f;
   int split_p_slices = 1;
-  thrust::universal_vector<ElementA> tensor_A;
-  thrust::universal_vector<ElementB> tensor_B;
-  thrust::universal_vector<ElementC> tensor_C;
-  thrust::universal_vector<ElementD> tensor_D_computed;
-  thrust::universal_vector<ElementD> tensor_D_reference;
-  thrust::universal_vector<ElementBias> tensor_bias;
-  thrust::universal_vector<ElementScalar> tensor_alpha;
-  thrust::universal_vector<ElementScalar> tensor_beta;
+  universal_vector<ElementA> tensor_A;
+  universal_vector<ElementB> tensor_B;
+  universal_vector<ElementC> tensor_C;
+  universal_vector<ElementD> tensor_D_computed;
+  universal_vector<ElementD> tensor_D_reference;
+  universal_vector<ElementBias> tensor_bias;
+  universal_vector<ElementScalar> tensor_alpha;
+  universal_vector<ElementScalar> tensor_beta;
 
   // Return true on success, else false
   bool initialize(ProblemShape const& problem_shape, uint64_t seed = 6090) {
@@ -227,6 +235,10 @@ struct ConvTestbed {
 
   // Determine SMEM requirements and waive if not satisfied
   bool sufficient() const {
+#if defined(CUTLASS_ENABLE_SYCL)
+    size_t max_smem_size = syclcompat::get_current_device().get_device_info().get_local_mem_size();
+    return max_smem_size >= static_cast<size_t>(Conv::ConvKernel::SharedStorageSize);
+#else
     int device_idx;
     cudaError_t result = cudaGetDevice(&device_idx);
     if (result != cudaSuccess) {
@@ -240,6 +252,7 @@ struct ConvTestbed {
     }
 
     return max_smem_size >= Conv::ConvKernel::SharedStorageSize;
+#endif
   }
 
   auto transform_shape_and_stride_with_groups(ProblemShape const& problem_shape) {
@@ -338,14 +351,23 @@ struct ConvTestbed {
     }
 
     cutlass::KernelHardwareInfo hw_info;
+#if defined(CUTLASS_ENABLE_SYCL)
+    hw_info.device_id = 0;
+#else
     cudaGetDevice(&hw_info.device_id);
+#endif
     hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
 
     // configure the operator
     Conv conv_op;
     auto stride_C = StrideC{};
     auto stride_D = StrideD{};
-    if constexpr (ConvOp == cutlass::conv::Operator::kWgrad) {
+    if constexpr (IsXeConv) {
+      auto [M, N, K, L] = Conv::ConvKernel::CollectiveMainloop::get_problem_shape_MNKL(problem_shape);
+      stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, 1));
+      stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, 1));
+    }
+    else if constexpr (ConvOp == cutlass::conv::Operator::kWgrad) {
       stride_C = cutlass::make_cute_packed_stride(
         StrideC{}, problem_shape.shape_C, problem_shape.stride_C, ConvOp);
       stride_D = cutlass::make_cute_packed_stride(
@@ -364,7 +386,7 @@ struct ConvTestbed {
     using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
    using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
 
-    typename Conv::ConvKernel::TileScheduler::Arguments scheduler_args{};
+    typename Conv::ConvKernel::TileSchedulerArguments scheduler_args{};
     if constexpr (cute::is_same_v<typename Conv::ConvKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
       scheduler_args = { static_cast<int>(splits), static_cast<int>(max_swizzle), raster_order, decomposition_mode };
     }
@@ -427,12 +449,16 @@ struct ConvTestbed {
 
     // find workspace requirement for parallel split-k reduction
     size_t workspace_size = Conv::get_workspace_size(args);
-    thrust::universal_vector<uint8_t> workspace(workspace_size);
+    universal_vector<uint8_t> workspace(workspace_size);
 
     status = conv_op.initialize(args, workspace.data().get());
     if (status != cutlass::Status::kSuccess) {
+#if defined(CUTLASS_ENABLE_SYCL)
+      std::cerr << "This test is not supported." << "\n";
+#else
       cudaError_t error = cudaGetLastError();
       std::cerr << "This test is not supported: " << cudaGetErrorString(error) << "\n";
+#endif
       return true;
     }
 
@@ -445,9 +471,18 @@ struct ConvTestbed {
     }
 
     bool passed = false;
+#if defined(CUTLASS_ENABLE_SYCL)
+    try {
+      syclcompat::wait_and_throw();
+    } catch (std::exception const &e) {
+      ADD_FAILURE() << "Error at Kernel Sync: " << e.what();
+      return false;
+    }
+#else
     cudaError_t result = cudaDeviceSynchronize();
     EXPECT_EQ(result, cudaSuccess) << " Kernel execution error: "
                                    << cudaGetErrorString(result);
+#endif
 
     // Create cute::Tensors using the logical rank-3 MNK multi-mode shapes the mainloop gives us
     auto [shape_mA, shape_mB, shape_mC, stride_mA, stride_mB, stride_mC] =
@@ -656,16 +691,16 @@ struct ConvTestbed {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-template <typename Conv, bool SupportStrides = (Conv::DispatchPolicy::ConvOp != cutlass::conv::Operator::kDgrad)>
-bool TestAllConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f
-                 ) {
+// Runs the given problems
+template <typename Conv>
+bool TestAllConv(
+    std::vector<cutlass::conv::ConvProblemShape<Conv::DispatchPolicy::ConvOp, Conv::NumSpatialDimensions>> const& problem_vector,
+    double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f) {
   using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
 
   bool passed = true;
   ConvTestbed<Conv> testbed;
   testbed.epsilon = epsilon;
-  auto problem_vector = get_conv_problem_vector<
-      Conv::NumSpatialDimensions, Conv::DispatchPolicy::ConvOp, SupportStrides>();
 
   using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
@@ -714,6 +749,15 @@ bool TestAllConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f
   return passed;
 }
 
+// Runs the default problems of conv_problem_sizes.hpp
+template <typename Conv, bool SupportStrides = (Conv::DispatchPolicy::ConvOp != cutlass::conv::Operator::kDgrad)>
+bool TestAllConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f
+                 ) {
+  auto problem_vector = get_conv_problem_vector<
+      Conv::NumSpatialDimensions, Conv::DispatchPolicy::ConvOp, SupportStrides>();
+  return TestAllConv<Conv>(problem_vector, alpha, beta, epsilon);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace test::conv::device
@@ -0,0 +1,118 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Implicit GEMM convolution kernels for the Intel PVC conv unit tests
+*/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/atom/copy_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/conv/dispatch_policy.hpp"
+#include "cutlass/conv/collective/collective_conv.hpp"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/conv/kernel/conv_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::conv::device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using XeConvMmaAtomBF16 = cute::MMA_Atom<cute::XE_8x16x16_F32BF16BF16F32_TT>;
+
+// 32 subgroups, each computing a 32x32 sub-tile of a 256x128 workgroup tile
+using XeConvTiledMmaBF16_256x128 = cute::TiledMMA<XeConvMmaAtomBF16,
+    cute::Layout<cute::Shape<cute::_8, cute::_4, cute::_1>, cute::Stride<cute::_4, cute::_1, cute::_0>>,
+    cute::Tile<cute::Layout<cute::Shape<cute::_8, cute::_8, cute::_4>, cute::Stride<cute::_1, cute::_32, cute::_8>>,
+               cute::Layout<cute::Shape<cute::_16, cute::_4, cute::_2>, cute::Stride<cute::_1, cute::_32, cute::_16>>,
+               cute::_32>>;
+
+// 16 subgroups, each computing a 32x32 sub-tile of a 128x128 workgroup tile
+using XeConvTiledMmaBF16_128x128 = cute::TiledMMA<XeConvMmaAtomBF16,
+    cute::Layout<cute::Shape<cute::_4, cute::_4, cute::_1>, cute::Stride<cute::_4, cute::_1, cute::_0>>,
+    cute::Tile<cute::Layout<cute::Shape<cute::_8, cute::_4, cute::_4>, cute::Stride<cute::_1, cute::_32, cute::_8>>,
+               cute::Layout<cute::Shape<cute::_16, cute::_4, cute::_2>, cute::Stride<cute::_1, cute::_32, cute::_16>>,
+               cute::_32>>;
+
+// bf16 NHWC/KRSC implicit GEMM with an fp32 output, written as a row-major (M,N) matrix of the linearized GEMM
+template <cutlass::conv::Operator ConvOp, class TileShape, class TiledMma, int NumSpatialDimensions = 2>
+struct XeConvBF16 {
+  using ElementA = cutlass::bfloat16_t;
+  using ElementB = cutlass::bfloat16_t;
+  using ElementOutput = float;
+  using ElementAccumulator = float;
+
+  using ProblemShape = cutlass::conv::ConvProblemShape<ConvOp, NumSpatialDimensions>;
+
+  using CollectiveMainloop = cutlass::conv::collective::CollectiveConv<
+    cutlass::conv::MainloopIntelPVCImplicitGemm<ConvOp, 2, NumSpatialDimensions>, TileShape,
+    ElementA, ElementB,
+    TiledMma,
+    void, void>;
+
+  using EpilogueDispatchPolicy = cutlass::epilogue::IntelPVCEpilogue;
+  using EpilogueOp = cutlass::epilogue::fusion::LinearCombination<ElementOutput, ElementAccumulator,
+      ElementAccumulator, ElementAccumulator, cutlass::FloatRoundStyle::round_to_nearest>;
+  using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+      decltype(cute::tile_shape(TiledMma()))>;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+    EpilogueDispatchPolicy,
+    TileShape,
+    ElementAccumulator,
+    cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>,
+    ElementOutput,
+    cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>,
+    FusionCallbacks,
+    cute::XE_2D_U32x8x16_LD_N,
+    void, void,
+    cute::XE_2D_U32x8x16_ST_N,
+    void, void>;
+
+  using ConvKernel = cutlass::conv::kernel::ConvUniversal<
+    ProblemShape,
+    CollectiveMainloop,
+    CollectiveEpilogue
+  >;
+
+  using Conv = cutlass::conv::device::ConvUniversalAdapter<ConvKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace test::conv::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the register blocked device agnostic mainloop. These only use portable SYCL features,
+           so they also run on CPU devices (e.g. with ONEAPI_DEVICE_SELECTOR=opencl:cpu).
+*/
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "gemm_testbed_3x.hpp"
+
+namespace {
+
+template <class LayoutA, class LayoutB, class TileShape>
+struct DeviceAgnosticRegisterBlockedGemm {
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Agnostic, cutlass::arch::OpMultiplyAdd,
+    float, LayoutA, 4,
+    float, LayoutB, 4,
+    float,
+    TileShape, cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::gemm::collective::StageCountAuto,
+    cutlass::gemm::KernelDeviceAgnosticRegisterBlocked
+  >::CollectiveOp;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Agnostic, cutlass::arch::OpMultiplyAdd,
+    TileShape, cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    float, float,
+    float, cutlass::layout::RowMajor, 1,
+    float, cutlass::layout::RowMajor, 1,
+    cutlass::epilogue::collective::EpilogueScheduleAuto,
+    cutlass::epilogue::fusion::LinearCombination<float, float, float, float>
+  >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+} // namespace
+
+TEST(DeviceAgnostic_Device_Gemm_f32t_f32t_f32t_simt_f32, 64x64x16) {
+  using Gemm = DeviceAgnosticRegisterBlockedGemm<
+    cutlass::layout::RowMajor, cutlass::layout::RowMajor, cute::Shape<cute::_64, cute::_64, cute::_16>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1.0, 0.0));
+}
+
+TEST(DeviceAgnostic_Device_Gemm_f32n_f32t_f32t_simt_f32, 64x64x16) {
+  using Gemm = DeviceAgnosticRegisterBlockedGemm<
+    cutlass::layout::ColumnMajor, cutlass::layout::RowMajor, cute::Shape<cute::_64, cute::_64, cute::_16>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1.0, 0.0));
+}
+
+TEST(DeviceAgnostic_Device_Gemm_f32t_f32n_f32t_simt_f32, 64x64x16) {
+  using Gemm = DeviceAgnosticRegisterBlockedGemm<
+    cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, cute::Shape<cute::_64, cute::_64, cute::_16>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1.0, 0.0));
+}
+
+TEST(DeviceAgnostic_Device_Gemm_f32n_f32n_f32t_simt_f32, 64x64x16) {
+  using Gemm = DeviceAgnosticRegisterBlockedGemm<
+    cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor, cute::Shape<cute::_64, cute::_64, cute::_16>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1.0, 0.0));
+}
+
+TEST(DeviceAgnostic_Device_Gemm_f32t_f32t_f32t_simt_f32, 128x128x16) {
+  using Gemm = DeviceAgnosticRegisterBlockedGemm<
+    cutlass::layout::RowMajor, cutlass::layout::RowMajor, cute::Shape<cute::_128, cute::_128, cute::_16>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestAll<Gemm>(1.0, 1.0));
+}
@@ -2508,7 +2508,9 @@ struct TestbedImpl {
 
     if (status != cutlass::Status::kSuccess) {
 #if defined(CUTLASS_ENABLE_SYCL)
+      // The Xe tests only pick problems their kernels support, so a rejected problem is a failure
       std::cerr << "This test is not supported." << "\n";
+      return false;
 #else
       cudaError_t error = cudaGetLastError();
       const auto error_str = cudaGetErrorString(error);
@@ -3503,6 +3505,27 @@ bool TestAll(double alpha = 1.0, double beta = cute::is_same_v<typename Gemm::Ge
 }
 
 #if defined(SYCL_INTEL_TARGET)
+/// Returns whether an Xe GEMM can implement a problem with packed A/B/C/D. No operands are allocated,
+/// so this only exercises the shape and pitch checks of can_implement.
+template <typename Gemm>
+bool can_implement_xe(int m, int n, int k, int l = 1) {
+  using GemmKernel = typename Gemm::GemmKernel;
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(m, k, l));
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(n, k, l));
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, cute::make_shape(m, n, l));
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(m, n, l));
+
+  typename Gemm::Arguments arguments{
+    l > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, l},
+    {nullptr, stride_A, nullptr, stride_B},
+    {{}, nullptr, stride_C, nullptr, stride_D}
+  };
+
+  return Gemm::can_implement(arguments) == cutlass::Status::kSuccess;
+}
+
 template <typename Gemm, template <class T> class ActivationFunctor =
                              cutlass::epilogue::thread::Identity>
 // TODO(Codeplay): remove the test_batch option once batching is enabled for all tests
@@ -3522,15 +3545,33 @@ bool TestXe(
       check_relative_equality, ScalarLoc::ON_HOST, VectorScale::DISABLED);
 
   // For M & N we test a small and a big size
-  // For K, we currently only support K = TileShapeK
-  // TODO(codeplay): unhardcode max_alignment
-
-  std::vector<int> problem_size_m{max_alignment, 512 - 3 * max_alignment};
-  std::vector<int> problem_size_n{max_alignment, 512 - 2 * max_alignment};
+  // For K, we test a single k-tile and a K with a partial last k-tile
+  // Every size is a multiple of the alignment that the operands contiguous along it need for a 16B aligned
+  // pitch, as required by the 2D block copies
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementC = cute::conditional_t<cute::is_void_v<typename GemmKernel::ElementC>,
+                                       typename GemmKernel::ElementD, typename GemmKernel::ElementC>;
+  constexpr int AlignmentA = 128 / cute::sizeof_bits_v<typename GemmKernel::ElementA>;
+  constexpr int AlignmentB = 128 / cute::sizeof_bits_v<typename GemmKernel::ElementB>;
+  constexpr int AlignmentC = 128 / cute::sizeof_bits_v<ElementC>;
+  constexpr int AlignmentD = 128 / cute::sizeof_bits_v<typename GemmKernel::ElementD>;
+  constexpr bool IsMMajorA = cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideA>();
+  constexpr bool IsNMajorB = cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideB>();
+  constexpr bool IsMMajorC = cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideC>();
+  constexpr bool IsMMajorD = cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideD>();
+
+  int const alignment_m = std::max({max_alignment, IsMMajorA ? AlignmentA : 1,
+                                    IsMMajorC ? AlignmentC : 1, IsMMajorD ? AlignmentD : 1});
+  int const alignment_n = std::max({max_alignment, IsNMajorB ? AlignmentB : 1,
+                                    IsMMajorC ? 1 : AlignmentC, IsMMajorD ? 1 : AlignmentD});
+  int const alignment_k = std::max({max_alignment, IsMMajorA ? 1 : AlignmentA, IsNMajorB ? 1 : AlignmentB});
+
+  std::vector<int> problem_size_m{alignment_m, 512 - 3 * alignment_m};
+  std::vector<int> problem_size_n{alignment_n, 512 - 2 * alignment_n};
   std::vector<int> problem_size_l = test_batch ? std::vector{1, 3, 4} : std::vector{1};
 
   constexpr int TileShapeK = cute::size<2>(typename Gemm::GemmKernel::TileShape{});
-  std::vector<int> problem_size_k{TileShapeK};
+  std::vector<int> problem_size_k{TileShapeK, TileShapeK + alignment_k};
 
   using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
   std::vector decomposition_modes = {DecompositionMode::Heuristic};
@@ -3546,7 +3587,7 @@ bool TestXe(
 
     // Use larger K sizes for stream-K tests
     static constexpr int min_tiles_per_sk_unit = cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::min_iters_per_sk_unit_;
-    problem_size_k = {TileShapeK * min_tiles_per_sk_unit, TileShapeK * 3 * min_tiles_per_sk_unit - max_alignment};
+    problem_size_k = {TileShapeK * min_tiles_per_sk_unit, TileShapeK * 3 * min_tiles_per_sk_unit - alignment_k};
   }
 
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
@@ -3559,6 +3600,11 @@ bool TestXe(
     for (int n : problem_size_n) {
       for (int k : problem_size_k) {
         for (int l : problem_size_l) {
+          if (!can_implement_xe<Gemm>(m, n, k, l)) {
+            EXPECT_TRUE(false) << "TestXe: GEMM MNKL " << m << " " << n << " " << k << " " << l
+                               << " cannot be implemented";
+            return false;
+          }
           for (auto raster_order : raster_orders) {
             for (auto max_swizzle_size : max_swizzle_sizes) {
               for (DecompositionMode decomp_mode : decomposition_modes) {
@@ -3632,6 +3678,32 @@ bool TestXe(
   }  // m
   return passed;
 }
+
+/// Runs an Xe GEMM on a single problem size. The kernel must be able to implement the problem.
+template <typename Gemm>
+bool TestXeProblemSize(
+    typename Gemm::GemmKernel::ProblemShape problem_size,
+    double alpha = 1.0, double beta = 0.0,
+    CheckEquality check_relative_equality = CheckEquality::RELATIVE) {
+  using ElementScalar = typename Gemm::EpilogueOutputOp::ElementScalar;
+  using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
+
+  auto [m, n, k, l] = cute::append<4>(problem_size, 1);
+  if (!can_implement_xe<Gemm>(m, n, k, l)) {
+    EXPECT_TRUE(false) << "GEMM MNKL " << m << " " << n << " " << k << " " << l << " cannot be implemented";
+    return false;
+  }
+
+  Testbed3x<Gemm, cutlass::epilogue::thread::Identity, false,
+    typename Gemm::GemmKernel::ElementA,
+    typename Gemm::GemmKernel::ElementB,
+    void*, void*, DecompositionMode> testbed(
+      check_relative_equality, ScalarLoc::ON_HOST, VectorScale::DISABLED);
+
+  return testbed.run(problem_size,
+                     cutlass::from_real<ElementScalar>(alpha),
+                     cutlass::from_real<ElementScalar>(beta));
+}
 #endif
 
 template <typename Gemm>
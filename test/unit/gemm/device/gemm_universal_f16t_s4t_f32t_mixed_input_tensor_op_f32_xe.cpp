@@ -134,6 +134,88 @@ TEST(XE_Device_GemmUniversal_f16t_s4t_f32t_mixed_input_tensor_op_f32, 128x128x64
   // TODO(Codeplay): gemm batch doesn't work for mixed type
   bool passed = test::gemm::device::TestXe<Gemm>(1.0, 1.0, false, 8);
   EXPECT_TRUE(passed);
+
+  // N is the pitch of the row-major int4 B, so it has to be a multiple of 32 elements
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({256, 480, 192, 1}, 1.0, 1.0));
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({136, 32, 72, 1}, 1.0, 1.0));
+}
+
+TEST(XE_Device_GemmUniversal_bf16t_s4t_f32t_mixed_input_tensor_op_f32, 128x128x64_64x64x64) {
+  using namespace cute;
+
+  using ElementAccumulator = float;                   // <- data type of accumulator
+  using ElementComputeEpilogue = float;               // <- data type of epilogue operations
+  using ElementInputA = bfloat16_t;                   // <- data type of elements in input matrix A
+  using ElementInputB = int4_t;                   // <- data type of elements in input matrix B
+  using ElementOutput = float;                        // <- data type of elements in output matrix D
+
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using GmemTiledCopyA = XE_2D_U16x32x32_LD_N;
+  using GmemTiledCopyB = XE_2D_U4x32x64_LD_N;
+
+  // Workgroup-level tile
+  using TileShape = Shape<_256, _256, _64>;
+
+  using TiledMma =
+      TiledMMA<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
+               Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>,
+               Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                    Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, _64>>;
+
+  constexpr int PipelineStages = 3;
+  using GEMMDispatchPolicy = cutlass::gemm::MainloopIntelPVCMixedPrecision<PipelineStages>;
+  using EpilogueDispatchPolicy = cutlass::epilogue::IntelPVCEpilogue;
+
+  using EpilogueOp = cutlass::epilogue::fusion::LinearCombination<ElementOutput, ElementComputeEpilogue,
+          ElementAccumulator, ElementAccumulator, cutlass::FloatRoundStyle::round_to_nearest>;
+
+  using FusionCallBacks = cutlass::epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+  using CollectiveEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+          EpilogueDispatchPolicy,
+          TileShape,
+          ElementAccumulator,
+          cutlass::gemm::TagToStrideC_t<LayoutC>,
+          ElementOutput,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          FusionCallBacks,
+          XE_2D_U32x8x16_LD_N,
+          void, void,
+          XE_2D_U32x8x16_ST_N,
+          void, void>;
+
+  // Mainloop
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+          GEMMDispatchPolicy,
+          TileShape,
+          ElementInputA,
+          cutlass::gemm::TagToStrideA_t<LayoutA>,
+          ElementInputB,
+          cutlass::gemm::TagToStrideB_t<LayoutB>,
+          TiledMma,
+          GmemTiledCopyA, void, void, cute::identity,  // A
+          GmemTiledCopyB, void, void, cute::identity   // B
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // TODO(Codeplay): gemm batch doesn't work for mixed type
+  bool passed = test::gemm::device::TestXe<Gemm>(1.0, 1.0, false, 8);
+  EXPECT_TRUE(passed);
+
+  // N is the pitch of the row-major int4 B, so it has to be a multiple of 32 elements
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({256, 480, 192, 1}, 1.0, 1.0));
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({136, 32, 72, 1}, 1.0, 1.0));
 }
 ////////////////////////////////////////////////////////////////////////////////
 
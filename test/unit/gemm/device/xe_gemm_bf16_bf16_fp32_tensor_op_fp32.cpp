@@ -114,3 +114,85 @@ TEST(XE_Device_Gemm_bf16n_bf16n_f32t_tensor_op_f32, 256x256x32) {
   using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
   EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
 }
+
+TEST(XE_Device_Gemm_bf16t_bf16n_f32t_tensor_op_f32, 256x256x32_unaligned_N) {
+  using Config = cutlass::gemm::device::DefaultGemmConfigurationToCutlass3Types<
+    cutlass::arch::OpClassTensorOp, cutlass::arch::IntelPVC,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    cute::bfloat16_t, cutlass::layout::ColumnMajor,
+    float, cutlass::layout::RowMajor,
+    float>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      Config::CollectiveMainloop,
+      Config::CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  // An alignment of 1 gives C/D pitches which cannot be accessed with 2D block messages,
+  // B is K-major so that its pitch does not depend on N
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>(1.0, 1.0, true, 1));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32, 256x256x32_unaligned_K) {
+  using Config = cutlass::gemm::device::DefaultGemmConfigurationToCutlass3Types<
+    cutlass::arch::OpClassTensorOp, cutlass::arch::IntelPVC,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    float, cutlass::layout::RowMajor,
+    float>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      Config::CollectiveMainloop,
+      Config::CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  // K is the pitch of a row-major A, so a K which is not a multiple of 8 bf16 elements must be rejected
+  EXPECT_FALSE(test::gemm::device::can_implement_xe<Gemm>(512, 512, 4097));
+  EXPECT_FALSE(test::gemm::device::can_implement_xe<Gemm>(512, 512, 260));
+  EXPECT_TRUE(test::gemm::device::can_implement_xe<Gemm>(512, 512, 264));
+}
+
+TEST(XE_Device_Gemm_bf16n_bf16t_f32t_tensor_op_f32, 256x256x32_unaligned_K) {
+  using Config = cutlass::gemm::device::DefaultGemmConfigurationToCutlass3Types<
+    cutlass::arch::OpClassTensorOp, cutlass::arch::IntelPVC,
+    cute::bfloat16_t, cutlass::layout::ColumnMajor,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    float, cutlass::layout::RowMajor,
+    float>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      Config::CollectiveMainloop,
+      Config::CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  // Neither A nor B has a pitch along K, so an odd K only leaves a partial last k-tile
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 512, 257, 1}));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32, 256x256x32_unaligned_N) {
+  using Config = cutlass::gemm::device::DefaultGemmConfigurationToCutlass3Types<
+    cutlass::arch::OpClassTensorOp, cutlass::arch::IntelPVC,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    cute::bfloat16_t, cutlass::layout::RowMajor,
+    float, cutlass::layout::RowMajor,
+    float>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      Config::CollectiveMainloop,
+      Config::CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  // N is the pitch of a row-major B, so an N which is not a multiple of 8 bf16 elements must be rejected
+  EXPECT_FALSE(test::gemm::device::can_implement_xe<Gemm>(512, 509, 64));
+  EXPECT_FALSE(test::gemm::device::can_implement_xe<Gemm>(512, 4, 64));
+  // Odd N problems are skipped by the testbed, odd M ones run
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>(1.0, 1.0, true, 1));
+}
@@ -182,3 +182,38 @@ TEST(XE_Device_Gemm_bf16n_bf16n_f32t_tensor_op_f32_cooperative, 256x256x32) {
   // TODO(Codeplay): Enable batch tests
   EXPECT_TRUE(test::gemm::device::TestXe<Gemm>(1.0, 0.0, false));
 }
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_cooperative_dynamic_persistent, 256x256x32) {
+  using ElementA = cute::bfloat16_t;
+  using ElementB = cute::bfloat16_t;
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+
+  using Config = cutlass::gemm::device::DefaultGemmConfigurationToCutlass3Types<
+    cutlass::arch::OpClassTensorOp, cutlass::arch::IntelPVC,
+    ElementA, LayoutA,
+    ElementB, LayoutB,
+    float, cutlass::layout::RowMajor,
+    float>;
+
+  using DispatchPolicy = cutlass::gemm::MainloopIntelPVC<3, cutlass::gemm::KernelPVCCooperative>;
+
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+    DispatchPolicy, Config::TileShape,
+    ElementA, cutlass::detail::TagToStrideA_t<LayoutA>,
+    ElementB, cutlass::detail::TagToStrideB_t<LayoutB>,
+    Config::TiledMma,
+    Config::GmemTiledCopyA, void, void, cute::identity,  // A
+    Config::GmemTiledCopyB, void, void, cute::identity   // B
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      CollectiveMainloop,
+      Config::CollectiveEpilogue,
+      cutlass::gemm::DynamicPersistentScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
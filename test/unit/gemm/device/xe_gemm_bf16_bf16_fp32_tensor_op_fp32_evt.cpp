@@ -34,7 +34,11 @@
     LinCombEltAct
 */
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
 
 #include "cutlass/cutlass.h"
 
@@ -42,6 +46,8 @@
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
 
 #include "gemm_testbed_3x.hpp"
 
@@ -233,3 +239,364 @@ TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinC
   bool passed = test::gemm::device::TestXe<Gemm>(1.0, 0.0);
   EXPECT_TRUE(passed);
 }
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinCombPerColBias) {
+  using namespace cute;
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementBias = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombPerColBias<
+      ElementOutput, ElementComputeEpilogue, ElementBias, ElementAccumulator,
+      ElementAccumulator, 128 / sizeof_bits_v<ElementBias>,
+      cutlass::FloatRoundStyle::round_to_nearest>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  bool passed = test::gemm::device::TestXe<Gemm>(1.0, 1.0);
+  EXPECT_TRUE(passed);
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinCombPerColBiasEltActAux) {
+  using namespace cute;
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+  using LayoutAux = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementAux = float;
+  using ElementBias = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombPerColBiasEltActAux<
+      LayoutAux, cutlass::epilogue::thread::ReLu,
+      ElementOutput, ElementComputeEpilogue, ElementAux, ElementBias, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  bool passed = test::gemm::device::TestXe<Gemm, cutlass::epilogue::thread::ReLu>(1.0, 1.0);
+  EXPECT_TRUE(passed);
+}
+
+namespace {
+
+using namespace cute;
+
+// bf16 GEMM with fp32 output whose epilogue runs FusionOp
+template <class FusionOp>
+struct XeReductionGemm {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, 128 / sizeof_bits_v<ElementAccumulator>,
+      ElementOutput, LayoutD, 128 / sizeof_bits_v<ElementOutput>,
+      cutlass::epilogue::collective::EpilogueScheduleAuto,
+      FusionOp
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, 128 / sizeof_bits_v<ElementInputA>,
+      ElementInputB, LayoutB, 128 / sizeof_bits_v<ElementInputB>,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+// Runs D = alpha * A x B on small integer operands, which keeps D and its reductions exact in fp32, and checks D
+// against a host reference. set_fusion_args fills in the reduction outputs of the epilogue arguments.
+template <class Gemm, class SetFusionArgs>
+bool RunXeReductionGemm(int M, int N, int K, int L, float alpha, SetFusionArgs set_fusion_args,
+                        std::vector<float>& host_D) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(M, K, L));
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(N, K, L));
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, cute::make_shape(M, N, L));
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(M, N, L));
+
+  std::mt19937 generator(2024);
+  std::uniform_int_distribution<int> distribution(-2, 2);
+  std::vector<ElementA> host_A(size_t(M) * K * L);
+  std::vector<ElementB> host_B(size_t(N) * K * L);
+  for (auto& a : host_A) { a = ElementA(float(distribution(generator))); }
+  for (auto& b : host_B) { b = ElementB(float(distribution(generator))); }
+
+  cutlass::DeviceAllocation<ElementA> block_A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> block_B(host_B.size());
+  cutlass::DeviceAllocation<float> block_D(size_t(M) * N * L);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    L > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {block_A.get(), stride_A, block_B.get(), stride_B},
+    {{}, nullptr, stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = alpha;
+  arguments.epilogue.thread.beta = 0.f;
+  set_fusion_args(arguments.epilogue.thread);
+
+  Gemm gemm_op;
+  if (gemm_op.can_implement(arguments) != cutlass::Status::kSuccess) {
+    ADD_FAILURE() << "GEMM MNKL " << M << " " << N << " " << K << " " << L << " cannot be implemented";
+    return false;
+  }
+
+  // initialize fills the reduction outputs with the reduction identity
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  EXPECT_EQ(gemm_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.run(), cutlass::Status::kSuccess);
+  try {
+    syclcompat::wait_and_throw();
+  } catch (std::exception const &e) {
+    ADD_FAILURE() << "Error at Kernel Sync.";
+    return false;
+  }
+
+  host_D.resize(block_D.size());
+  block_D.copy_to_host(host_D.data());
+
+  auto tensor_A = make_tensor(host_A.data(), make_layout(make_shape(M, K, L), stride_A));
+  auto tensor_B = make_tensor(host_B.data(), make_layout(make_shape(N, K, L), stride_B));
+  int errors = 0;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float reference = 0.f;
+        for (int k = 0; k < K; ++k) {
+          reference += float(tensor_A(m, k, l)) * float(tensor_B(n, k, l));
+        }
+        reference *= alpha;
+        float result = host_D[n + size_t(N) * (m + size_t(M) * l)];
+        if (result != reference && errors++ < 8) {
+          ADD_FAILURE() << "D(" << m << ", " << n << ", " << l << ") = " << result << ", expected " << reference;
+        }
+      }
+    }
+  }
+  return errors == 0;
+}
+
+// Checks the absolute maximum of D, reduced over all batches
+bool TestXeAmax(int M, int N, int K, int L) {
+  using FusionOp = cutlass::epilogue::fusion::LinCombAmax<float, float>;
+  using Gemm = XeReductionGemm<FusionOp>::Gemm;
+
+  cutlass::DeviceAllocation<float> amax(1);
+  std::vector<float> host_D;
+  if (!RunXeReductionGemm<Gemm>(M, N, K, L, 0.5f, [&](auto& fusion_args) { fusion_args.amax_ptr = amax.get(); }, host_D)) {
+    return false;
+  }
+
+  float host_amax = 0.f;
+  amax.copy_to_host(&host_amax);
+
+  float reference = 0.f;
+  for (float d : host_D) {
+    reference = std::max(reference, std::abs(d));
+  }
+  EXPECT_EQ(host_amax, reference);
+  return host_amax == reference;
+}
+
+template <class T>
+using maximum_reduction = cutlass::maximum<T>;
+
+// Checks the reductions of each batch of D along M (one value per column) and along N (one value per row)
+template <template <class> class RegReduceFn, template <class> class GmemReduceFn, class HostReduceFn>
+bool TestXeRowColReduction(int M, int N, int K, int L, float identity, HostReduceFn host_reduce_fn) {
+  using FusionOp = cutlass::epilogue::fusion::LinCombRowColReduction<RegReduceFn, GmemReduceFn, float, float>;
+  using Gemm = typename XeReductionGemm<FusionOp>::Gemm;
+
+  cutlass::DeviceAllocation<float> row_reduction(size_t(N) * L);
+  cutlass::DeviceAllocation<float> col_reduction(size_t(M) * L);
+  std::vector<float> host_D;
+  bool passed = RunXeReductionGemm<Gemm>(M, N, K, L, 1.f, [&](auto& fusion_args) {
+    fusion_args.reduction_identity = identity;
+    fusion_args.row_reduction_ptr = row_reduction.get();
+    fusion_args.dRowReduction = {_0{}, _1{}, int64_t(N)};
+    fusion_args.col_reduction_ptr = col_reduction.get();
+    fusion_args.dColReduction = {_1{}, _0{}, int64_t(M)};
+  }, host_D);
+  if (!passed) {
+    return false;
+  }
+
+  std::vector<float> host_row(row_reduction.size());
+  std::vector<float> host_col(col_reduction.size());
+  row_reduction.copy_to_host(host_row.data());
+  col_reduction.copy_to_host(host_col.data());
+
+  std::vector<float> reference_row(host_row.size(), identity);
+  std::vector<float> reference_col(host_col.size(), identity);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float d = host_D[n + size_t(N) * (m + size_t(M) * l)];
+        reference_row[n + size_t(N) * l] = host_reduce_fn(reference_row[n + size_t(N) * l], d);
+        reference_col[m + size_t(M) * l] = host_reduce_fn(reference_col[m + size_t(M) * l], d);
+      }
+    }
+  }
+
+  // D holds integers well below 2^24, so the reductions are exact in any order
+  int errors = 0;
+  for (size_t i = 0; i < host_row.size(); ++i) {
+    if (host_row[i] != reference_row[i] && errors++ < 8) {
+      ADD_FAILURE() << "row_reduction[" << i << "] = " << host_row[i] << ", expected " << reference_row[i];
+    }
+  }
+  for (size_t i = 0; i < host_col.size(); ++i) {
+    if (host_col[i] != reference_col[i] && errors++ < 8) {
+      ADD_FAILURE() << "col_reduction[" << i << "] = " << host_col[i] << ", expected " << reference_col[i];
+    }
+  }
+  return errors == 0;
+}
+
+} // namespace
+
+// D = alpha * acc, amax = max(abs(D))
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinCombAmax) {
+  EXPECT_TRUE(TestXeAmax(256, 256, 64, 1));
+  // Several workgroups and batches combine their partial maxima with atomic_maximum
+  EXPECT_TRUE(TestXeAmax(1024, 768, 64, 2));
+  EXPECT_TRUE(TestXeAmax(1000, 760, 96, 3));
+}
+
+// D = alpha * acc, row/column sums of D
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinCombRowColReduction_sum) {
+  auto host_sum = [](float a, float b) { return a + b; };
+  EXPECT_TRUE((TestXeRowColReduction<cutlass::plus, cutlass::atomic_add>(256, 256, 64, 1, 0.f, host_sum)));
+  // Several workgroups along each reduced mode combine their partial sums with atomic_add
+  EXPECT_TRUE((TestXeRowColReduction<cutlass::plus, cutlass::atomic_add>(1024, 768, 64, 2, 0.f, host_sum)));
+  EXPECT_TRUE((TestXeRowColReduction<cutlass::plus, cutlass::atomic_add>(1000, 760, 96, 2, 0.f, host_sum)));
+}
+
+// D = alpha * acc, row/column maxima of D
+TEST(XE_Device_Gemm_bf16t_bf16t_f32_tensor_op_gmma_f32_epilogue, 256x256x32_LinCombRowColReduction_max) {
+  auto host_max = [](float a, float b) { return std::max(a, b); };
+  float const identity = -std::numeric_limits<float>::infinity();
+  // Some row and column maxima are negative, so atomic_maximum<float> also has to order negative values
+  EXPECT_TRUE((TestXeRowColReduction<maximum_reduction, cutlass::atomic_maximum>(1024, 768, 64, 2, identity, host_max)));
+  EXPECT_TRUE((TestXeRowColReduction<maximum_reduction, cutlass::atomic_maximum>(1000, 760, 96, 2, identity, host_max)));
+}
@@ -0,0 +1,311 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the Xe bf16_bf16_fp32 grouped and ptr-array GEMMs
+*/
+
+#include "cutlass/epilogue/collective/xe_array_epilogue.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "gemm_testbed_3x.hpp"
+
+#include <random>
+
+namespace {
+
+using namespace cute;
+
+// Grouped GEMMs take one pointer and one stride per group, ptr-array GEMMs one pointer per batch and a shared stride
+template <bool Grouped>
+struct XeGroupGemmBF16 {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using StrideA = cute::conditional_t<Grouped, cutlass::gemm::TagToStrideA_t<LayoutA*>, cutlass::gemm::TagToStrideA_t<LayoutA>>;
+  using StrideB = cute::conditional_t<Grouped, cutlass::gemm::TagToStrideB_t<LayoutB*>, cutlass::gemm::TagToStrideB_t<LayoutB>>;
+  using StrideC = cute::conditional_t<Grouped, cutlass::gemm::TagToStrideC_t<LayoutC*>, cutlass::gemm::TagToStrideC_t<LayoutC>>;
+  using StrideD = cute::conditional_t<Grouped, cutlass::gemm::TagToStrideC_t<LayoutD*>, cutlass::gemm::TagToStrideC_t<LayoutD>>;
+
+  using ProblemShape = cute::conditional_t<Grouped,
+    cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+    cutlass::gemm::ArrayProblemShape<Shape<int,int,int,int>>>;
+  using TileScheduler = cute::conditional_t<Grouped, cutlass::gemm::GroupScheduler, void>;
+
+  using TileShape = Shape<_256, _256, _32>;
+  using TiledMma =
+      TiledMMA<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
+               Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>,
+               Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                    Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, _32>>;
+
+  using EpilogueOp = cutlass::epilogue::fusion::LinearCombination<float, float, float, float,
+          cutlass::FloatRoundStyle::round_to_nearest>;
+  using FusionCallBacks = cutlass::epilogue::fusion::FusionCallbacks<cutlass::epilogue::IntelPVCEpilogue, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+  using CollectiveEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+          cutlass::epilogue::IntelPVCGroupEpilogue,
+          TileShape,
+          float, StrideC,
+          float, StrideD,
+          FusionCallBacks,
+          XE_2D_U32x8x16_LD_N, void, void,
+          XE_2D_U32x8x16_ST_N, void, void>;
+
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+          cutlass::gemm::MainloopIntelPVCGroup<2>,
+          TileShape,
+          cute::bfloat16_t, StrideA,
+          cute::bfloat16_t, StrideB,
+          TiledMma,
+          XE_2D_U16x32x32_LD_N, void, void, cute::identity,  // A
+          XE_2D_U16x32x32_LD_V, void, void, cute::identity   // B
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      TileScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+// Runs one GEMM per entry of `problems` and checks every group (or batch) against a host reference. The operands
+// hold small integers, so the bf16 products are exact and the results are compared exactly. Ptr-array GEMMs take
+// the first problem for all batches. A positive sm_count limits the persistent grid, so that each workgroup
+// walks over several tiles and groups.
+template <class Gemm>
+bool TestXeGroupGemm(std::vector<Shape<int,int,int>> const& problems, float alpha = 1.f, float beta = 1.f,
+                     int sm_count = 0) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementD = typename GemmKernel::ElementD;
+  using StrideA = typename GemmKernel::InternalStrideA;
+  using StrideB = typename GemmKernel::InternalStrideB;
+  using StrideC = typename GemmKernel::InternalStrideC;
+  using StrideD = typename GemmKernel::InternalStrideD;
+
+  int groups = static_cast<int>(problems.size());
+
+  std::mt19937 rng(2025);
+  std::uniform_int_distribution<int> dist(-2, 2);
+
+  std::vector<std::vector<ElementA>> host_A(groups);
+  std::vector<std::vector<ElementB>> host_B(groups);
+  std::vector<std::vector<ElementC>> host_C(groups);
+  std::vector<cutlass::DeviceAllocation<ElementA>> block_A(groups);
+  std::vector<cutlass::DeviceAllocation<ElementB>> block_B(groups);
+  std::vector<cutlass::DeviceAllocation<ElementC>> block_C(groups);
+  std::vector<cutlass::DeviceAllocation<ElementD>> block_D(groups);
+
+  std::vector<ElementA const*> ptr_A_host(groups);
+  std::vector<ElementB const*> ptr_B_host(groups);
+  std::vector<ElementC const*> ptr_C_host(groups);
+  std::vector<ElementD*> ptr_D_host(groups);
+  std::vector<StrideA> stride_A_host;
+  std::vector<StrideB> stride_B_host;
+  std::vector<StrideC> stride_C_host;
+  std::vector<StrideD> stride_D_host;
+
+  for (int i = 0; i < groups; ++i) {
+    auto [M, N, K] = problems.at(i);
+
+    host_A.at(i).resize(size_t(M) * K);
+    host_B.at(i).resize(size_t(K) * N);
+    host_C.at(i).resize(size_t(M) * N);
+    for (auto& a : host_A.at(i)) { a = ElementA(float(dist(rng))); }
+    for (auto& b : host_B.at(i)) { b = ElementB(float(dist(rng))); }
+    for (auto& c : host_C.at(i)) { c = ElementC(float(dist(rng))); }
+
+    block_A.at(i).reset(host_A.at(i).size());
+    block_B.at(i).reset(host_B.at(i).size());
+    block_C.at(i).reset(host_C.at(i).size());
+    block_D.at(i).reset(size_t(M) * N);
+    block_A.at(i).copy_from_host(host_A.at(i).data());
+    block_B.at(i).copy_from_host(host_B.at(i).data());
+    block_C.at(i).copy_from_host(host_C.at(i).data());
+
+    ptr_A_host.at(i) = block_A.at(i).get();
+    ptr_B_host.at(i) = block_B.at(i).get();
+    ptr_C_host.at(i) = block_C.at(i).get();
+    ptr_D_host.at(i) = block_D.at(i).get();
+
+    stride_A_host.push_back(cutlass::make_cute_packed_stride(StrideA{}, {M, K, 1}));
+    stride_B_host.push_back(cutlass::make_cute_packed_stride(StrideB{}, {N, K, 1}));
+    stride_C_host.push_back(cutlass::make_cute_packed_stride(StrideC{}, {M, N, 1}));
+    stride_D_host.push_back(cutlass::make_cute_packed_stride(StrideD{}, {M, N, 1}));
+  }
+
+  cutlass::DeviceAllocation<ElementA const*> ptr_A(groups);
+  cutlass::DeviceAllocation<ElementB const*> ptr_B(groups);
+  cutlass::DeviceAllocation<ElementC const*> ptr_C(groups);
+  cutlass::DeviceAllocation<ElementD*> ptr_D(groups);
+  ptr_A.copy_from_host(ptr_A_host.data());
+  ptr_B.copy_from_host(ptr_B_host.data());
+  ptr_C.copy_from_host(ptr_C_host.data());
+  ptr_D.copy_from_host(ptr_D_host.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = sm_count > 0 ? sm_count
+                                  : cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  cutlass::DeviceAllocation<Shape<int,int,int>> problem_sizes;
+  cutlass::DeviceAllocation<StrideA> stride_A;
+  cutlass::DeviceAllocation<StrideB> stride_B;
+  cutlass::DeviceAllocation<StrideC> stride_C;
+  cutlass::DeviceAllocation<StrideD> stride_D;
+
+  typename GemmKernel::Arguments arguments;
+  if constexpr (GemmKernel::IsGroupedGemmKernel) {
+    problem_sizes.reset(groups);
+    problem_sizes.copy_from_host(problems.data());
+    stride_A.reset(groups);
+    stride_B.reset(groups);
+    stride_C.reset(groups);
+    stride_D.reset(groups);
+    stride_A.copy_from_host(stride_A_host.data());
+    stride_B.copy_from_host(stride_B_host.data());
+    stride_C.copy_from_host(stride_C_host.data());
+    stride_D.copy_from_host(stride_D_host.data());
+
+    arguments = {
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {groups, problem_sizes.get(), problems.data()},
+      {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
+      {{alpha, beta}, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
+      hw_info
+    };
+  } else {
+    auto [M, N, K] = problems.front();
+    arguments = {
+      cutlass::gemm::GemmUniversalMode::kArray,
+      typename GemmKernel::ProblemShape{make_shape(M, N, K, groups)},
+      {ptr_A.get(), stride_A_host.front(), ptr_B.get(), stride_B_host.front()},
+      {{alpha, beta}, ptr_C.get(), stride_C_host.front(), ptr_D.get(), stride_D_host.front()},
+      hw_info
+    };
+  }
+
+  Gemm gemm_op;
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  EXPECT_EQ(gemm_op.can_implement(arguments), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.run(), cutlass::Status::kSuccess);
+
+  try {
+    syclcompat::wait_and_throw();
+  } catch (std::exception const& e) {
+    ADD_FAILURE() << "Error at Kernel Sync.";
+    return false;
+  }
+
+  bool passed = true;
+  for (int i = 0; i < groups; ++i) {
+    auto [M, N, K] = problems.at(i);
+    std::vector<ElementD> host_D(size_t(M) * N);
+    block_D.at(i).copy_to_host(host_D.data());
+
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(host_A.at(i)[size_t(m) * K + k]) * float(host_B.at(i)[size_t(k) * N + n]);
+        }
+        float expected = alpha * accum + beta * float(host_C.at(i)[size_t(m) * N + n]);
+        float result = float(host_D[size_t(m) * N + n]);
+        if (result != expected) {
+          ADD_FAILURE() << "Mismatch in group " << i << " at (" << m << "," << n << "): "
+                        << result << " != " << expected;
+          passed = false;
+          break;
+        }
+      }
+      if (!passed) {
+        break;
+      }
+    }
+  }
+  return passed;
+}
+
+} // namespace
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_group, 256x256x32) {
+  using Gemm = XeGroupGemmBF16<true>::Gemm;
+
+  // Groups of different shapes, with partial M/N tiles and a K smaller than the K tile
+  std::vector<Shape<int,int,int>> problems = {
+    {256, 256, 64},
+    {512, 384, 256},
+    {128, 512, 16},
+    {264, 136, 96},
+    {1024, 256, 128},
+    {64, 128, 40}
+  };
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(problems));
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(problems, 2.f, 0.f));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_group, 256x256x32_persistent) {
+  using Gemm = XeGroupGemmBF16<true>::Gemm;
+
+  // A single SM runs far fewer workgroups than there are tiles, so every workgroup computes several tiles of
+  // several groups and has to start each one from cleared accumulators
+  std::vector<Shape<int,int,int>> problems;
+  for (int i = 0; i < 16; ++i) {
+    problems.push_back({256 * (1 + i % 3), 256 * (1 + i % 2), 32 * (1 + i % 4)});
+  }
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(problems, 1.f, 1.f, 1));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_ptr_array, 256x256x32) {
+  using Gemm = XeGroupGemmBF16<false>::Gemm;
+
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(std::vector<Shape<int,int,int>>(3, {512, 384, 96})));
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(std::vector<Shape<int,int,int>>(2, {264, 136, 48})));
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(std::vector<Shape<int,int,int>>(4, {128, 256, 16})));
+  EXPECT_TRUE(TestXeGroupGemm<Gemm>(std::vector<Shape<int,int,int>>(8, {512, 512, 64}), 1.f, 1.f, 1));
+}
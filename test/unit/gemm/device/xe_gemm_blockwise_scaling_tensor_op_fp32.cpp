@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for Xe blockwise-scaled int8 and fp8 GEMM
+*/
+
+
+#include "xe_gemm_testbed_fp8.hpp"
+
+namespace {
+
+// A holds one scale per row and 128-deep K block, B one per 128 columns and K block
+template <class ElementA, class ElementB, int ScaleGranularityK>
+using XeBlockScalingGemm = typename test::gemm::device::XeFP8GemmConfig<ElementA, ElementB,
+  cutlass::gemm::MainloopIntelPVCBlockScaling<3, 1, 128, ScaleGranularityK>>::Gemm;
+
+// Runs an MxNxKxL problem with varying, non-unit block scales and checks it against a host reference which looks
+// the scales up with the same blocking
+template <class Gemm>
+bool TestXeBlockScaling(int M, int N, int K, int L = 1) {
+  using CollectiveMainloop = typename Gemm::GemmKernel::CollectiveMainloop;
+  using ElementBlockScale = typename CollectiveMainloop::ElementBlockScale;
+  constexpr int ScaleGranularityM = CollectiveMainloop::ScaleGranularityM;
+  constexpr int ScaleGranularityN = CollectiveMainloop::ScaleGranularityN;
+  constexpr int ScaleGranularityK = CollectiveMainloop::ScaleGranularityK;
+
+  int const scale_m = cute::ceil_div(M, ScaleGranularityM);
+  int const scale_n = cute::ceil_div(N, ScaleGranularityN);
+  int const scale_k = cute::ceil_div(K, ScaleGranularityK);
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(0.25f, 2.f);
+  std::vector<ElementBlockScale> host_scale_A(size_t(scale_m) * scale_k * L);
+  std::vector<ElementBlockScale> host_scale_B(size_t(scale_n) * scale_k * L);
+  for (auto& s : host_scale_A) { s = distribution(generator); }
+  for (auto& s : host_scale_B) { s = -distribution(generator); }
+
+  cutlass::DeviceAllocation<ElementBlockScale> scale_A(host_scale_A.size());
+  cutlass::DeviceAllocation<ElementBlockScale> scale_B(host_scale_B.size());
+  scale_A.copy_from_host(host_scale_A.data());
+  scale_B.copy_from_host(host_scale_B.data());
+
+  return test::gemm::device::TestXeScaledMainloop<Gemm>(M, N, K, L,
+    [&](auto ptr_A, auto dA, auto ptr_B, auto dB) {
+      return typename CollectiveMainloop::Arguments{ptr_A, dA, ptr_B, dB, scale_A.get(), scale_B.get()};
+    },
+    [&](int m, int n, int k, int l) {
+      int const kb = k / ScaleGranularityK;
+      return host_scale_A[m / ScaleGranularityM + scale_m * (kb + scale_k * l)] *
+             host_scale_B[n / ScaleGranularityN + scale_n * (kb + scale_k * l)];
+    });
+}
+
+} // namespace
+
+TEST(XE_Device_Gemm_e4m3t_e4m3t_f32t_tensor_op_f32_blockwise_scaling, 256x256x32_1x128x128_scaled) {
+  using Gemm = XeBlockScalingGemm<cutlass::float_e4m3_t, cutlass::float_e4m3_t, 128>;
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(1024, 256, 384));
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(136, 400, 160, 3));
+}
+
+TEST(XE_Device_Gemm_e5m2t_e4m3t_f32t_tensor_op_f32_blockwise_scaling, 256x256x32_1x128x64_scaled) {
+  using Gemm = XeBlockScalingGemm<cutlass::float_e5m2_t, cutlass::float_e4m3_t, 64>;
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(512, 384, 512));
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(264, 144, 320, 2));
+}
+
+TEST(XE_Device_Gemm_s8t_s8t_f32t_tensor_op_f32_blockwise_scaling, 256x256x32_1x128x128_scaled) {
+  using Gemm = XeBlockScalingGemm<int8_t, int8_t, 128>;
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(512, 384, 512));
+  // Partial last tiles and a partial last K block
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(264, 144, 320, 2));
+}
+
+TEST(XE_Device_Gemm_e4m3t_e4m3t_f32t_tensor_op_f32_blockwise_scaling, 256x256x32_1x128x64_scaled) {
+  using Gemm = XeBlockScalingGemm<cutlass::float_e4m3_t, cutlass::float_e4m3_t, 64>;
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(512, 384, 512));
+  EXPECT_TRUE(TestXeBlockScaling<Gemm>(264, 144, 320, 2));
+}
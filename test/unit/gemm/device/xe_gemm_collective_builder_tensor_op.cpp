@@ -0,0 +1,180 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the Xe CollectiveBuilder across element types and operand layouts
+*/
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "gemm_testbed_3x.hpp"
+
+namespace {
+
+template <class ElementA, class LayoutA, class ElementB, class LayoutB, class ElementAccumulator,
+          class KernelSchedule = cutlass::gemm::collective::KernelScheduleAuto,
+          class TileShape_ = cute::Shape<cute::_256, cute::_256, cute::_32>>
+struct XeBuilderGemm {
+  using TileShape = TileShape_;
+  using ClusterShape = cute::Shape<cute::_1, cute::_1, cute::_1>;
+  using LayoutC = cutlass::layout::RowMajor;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA, 128 / cute::sizeof_bits_v<ElementA>,
+      ElementB, LayoutB, 128 / cute::sizeof_bits_v<ElementB>,
+      ElementAccumulator,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAuto,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, ElementAccumulator,
+      ElementAccumulator, LayoutC, 128 / cute::sizeof_bits_v<ElementAccumulator>,
+      ElementAccumulator, LayoutC, 128 / cute::sizeof_bits_v<ElementAccumulator>,
+      cutlass::epilogue::collective::EpilogueScheduleAuto,
+      cutlass::epilogue::fusion::LinearCombination<ElementAccumulator, float, ElementAccumulator, float>
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+} // namespace
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_bf16n_bf16t_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::ColumnMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({520, 496, 264, 2}, 1.0, 1.0));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16n_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::ColumnMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 496, 264, 2}, 1.0, 1.0));
+}
+
+TEST(XE_Device_Gemm_bf16n_bf16n_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::ColumnMajor,
+                             cute::bfloat16_t, cutlass::layout::ColumnMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({520, 496, 264, 2}, 1.0, 1.0));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_builder_cooperative, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float,
+                             cutlass::gemm::KernelPVCCooperative>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_fp16t_fp16t_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::half_t, cutlass::layout::RowMajor,
+                             cute::half_t, cutlass::layout::RowMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_fp16n_fp16n_f32t_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<cute::half_t, cutlass::layout::ColumnMajor,
+                             cute::half_t, cutlass::layout::ColumnMajor, float>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({520, 496, 264, 2}, 1.0, 1.0));
+}
+
+TEST(XE_Device_Gemm_s8t_s8t_s32t_tensor_op_s32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<int8_t, cutlass::layout::RowMajor,
+                             int8_t, cutlass::layout::RowMajor, int32_t>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 496, 272, 1}, 1.0, 1.0));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_builder, 128x512x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float,
+                             cutlass::gemm::collective::KernelScheduleAuto,
+                             cute::Shape<cute::_128, cute::_512, cute::_32>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_builder, 64x128x32) {
+  using Gemm = XeBuilderGemm<cute::bfloat16_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float,
+                             cutlass::gemm::collective::KernelScheduleAuto,
+                             cute::Shape<cute::_64, cute::_128, cute::_32>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_fp16t_fp16t_f32t_tensor_op_f32_builder, 8x128x32) {
+  using Gemm = XeBuilderGemm<cute::half_t, cutlass::layout::RowMajor,
+                             cute::half_t, cutlass::layout::RowMajor, float,
+                             cutlass::gemm::collective::KernelScheduleAuto,
+                             cute::Shape<cute::_8, cute::_128, cute::_32>>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+}
+
+TEST(XE_Device_Gemm_s8t_bf16t_f32t_mixed_input_tensor_op_f32_builder, 256x256x32) {
+  using Gemm = XeBuilderGemm<int8_t, cutlass::layout::RowMajor,
+                             cute::bfloat16_t, cutlass::layout::RowMajor, float>::Gemm;
+  // TODO(Codeplay): gemm batch doesn't work for mixed type
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>(1.0, 1.0, false, 8));
+}
+
+TEST(XE_Device_Gemm_f16t_s4t_f32t_mixed_input_tensor_op_f32_builder, 256x256x64) {
+  using Gemm = XeBuilderGemm<cute::half_t, cutlass::layout::RowMajor,
+                             cute::int4_t, cutlass::layout::RowMajor, float,
+                             cutlass::gemm::collective::KernelScheduleAuto,
+                             cute::Shape<cute::_256, cute::_256, cute::_64>>::Gemm;
+  // 4-bit B rows need a multiple of 32 columns for the 2D block loads
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>(1.0, 1.0, false, 32));
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({256, 480, 192, 1}, 1.0, 1.0));
+}
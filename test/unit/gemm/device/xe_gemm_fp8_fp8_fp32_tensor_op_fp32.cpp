@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for Xe fp8_fp8_fp32
+*/
+
+
+#include "xe_gemm_testbed_fp8.hpp"
+
+using test::gemm::device::XeFP8GemmConfig;
+
+TEST(XE_Device_Gemm_e4m3t_e4m3t_f32t_tensor_op_f32, 256x256x32) {
+  using Gemm = XeFP8GemmConfig<cutlass::float_e4m3_t, cutlass::float_e4m3_t>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  // N is the pitch of the row-major 8-bit B, so it has to be a multiple of 16 elements
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 496, 272, 1}));
+}
+
+TEST(XE_Device_Gemm_e5m2t_e5m2t_f32t_tensor_op_f32, 256x256x32) {
+  using Gemm = XeFP8GemmConfig<cutlass::float_e5m2_t, cutlass::float_e5m2_t>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  // N is the pitch of the row-major 8-bit B, so it has to be a multiple of 16 elements
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 496, 272, 1}));
+}
+
+TEST(XE_Device_Gemm_e4m3t_e5m2t_f32t_tensor_op_f32, 256x256x32) {
+  using Gemm = XeFP8GemmConfig<cutlass::float_e4m3_t, cutlass::float_e5m2_t>::Gemm;
+  EXPECT_TRUE(test::gemm::device::TestXe<Gemm>());
+  // N is the pitch of the row-major 8-bit B, so it has to be a multiple of 16 elements
+  EXPECT_TRUE(test::gemm::device::TestXeProblemSize<Gemm>({512, 496, 272, 1}));
+}
+
+namespace {
+
+// Runs an MxNxKxL problem with non-unit per-tensor scales and, optionally, per-row scales of A and per-column
+// scales of B, and checks it against a host reference
+template <class Gemm>
+bool TestXeFP8Scales(int M, int N, int K, int L, bool use_row_col_scales) {
+  using CollectiveMainloop = typename Gemm::GemmKernel::CollectiveMainloop;
+  using ElementScale = typename CollectiveMainloop::ElementScale;
+
+  ElementScale const scale_A = 0.5f;
+  ElementScale const scale_B = -3.f;
+
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> distribution(0.25f, 4.f);
+  std::vector<ElementScale> host_row_scale_A(size_t(M) * L);
+  std::vector<ElementScale> host_col_scale_B(size_t(N) * L);
+  for (auto& s : host_row_scale_A) { s = distribution(generator); }
+  for (auto& s : host_col_scale_B) { s = distribution(generator); }
+
+  cutlass::DeviceAllocation<ElementScale> row_scale_A(host_row_scale_A.size());
+  cutlass::DeviceAllocation<ElementScale> col_scale_B(host_col_scale_B.size());
+  row_scale_A.copy_from_host(host_row_scale_A.data());
+  col_scale_B.copy_from_host(host_col_scale_B.data());
+
+  return test::gemm::device::TestXeScaledMainloop<Gemm>(M, N, K, L,
+    [&](auto ptr_A, auto dA, auto ptr_B, auto dB) {
+      return typename CollectiveMainloop::Arguments{ptr_A, dA, ptr_B, dB, scale_A, scale_B,
+        use_row_col_scales ? row_scale_A.get() : nullptr,
+        use_row_col_scales ? col_scale_B.get() : nullptr};
+    },
+    [&](int m, int n, int k, int l) {
+      ElementScale scale = scale_A * scale_B;
+      if (use_row_col_scales) {
+        scale *= host_row_scale_A[m + size_t(M) * l] * host_col_scale_B[n + size_t(N) * l];
+      }
+      return scale;
+    });
+}
+
+} // namespace
+
+TEST(XE_Device_Gemm_e4m3t_e4m3t_f32t_tensor_op_f32, 256x256x32_tensor_scales) {
+  using Gemm = XeFP8GemmConfig<cutlass::float_e4m3_t, cutlass::float_e4m3_t>::Gemm;
+  EXPECT_TRUE(TestXeFP8Scales<Gemm>(512, 384, 256, 1, false));
+  EXPECT_TRUE(TestXeFP8Scales<Gemm>(264, 144, 96, 2, false));
+}
+
+TEST(XE_Device_Gemm_e4m3t_e5m2t_f32t_tensor_op_f32, 256x256x32_row_col_scales) {
+  using Gemm = XeFP8GemmConfig<cutlass::float_e4m3_t, cutlass::float_e5m2_t>::Gemm;
+  EXPECT_TRUE(TestXeFP8Scales<Gemm>(512, 384, 256, 1, true));
+  // Partial last tiles, where the scale lookups of out-of-bounds accumulators must be skipped
+  EXPECT_TRUE(TestXeFP8Scales<Gemm>(264, 144, 96, 2, true));
+}
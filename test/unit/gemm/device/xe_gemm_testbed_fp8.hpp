@@ -0,0 +1,195 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Configuration and scaled testbed shared by the Xe 8-bit mainloop tests
+*/
+
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/collective/xe_epilogue.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "gemm_testbed_3x.hpp"
+
+namespace test {
+namespace gemm {
+namespace device {
+
+using namespace cute;
+
+// 8-bit operands are upconverted to fp16 in registers, so the MMA runs on the fp16 DPAS atom. DispatchPolicy selects
+// the mainloop, e.g. MainloopIntelPVCBlockScaling for blockwise scales.
+template <class ElementA, class ElementB, class DispatchPolicy = cutlass::gemm::MainloopIntelPVCFP8<3>>
+struct XeFP8GemmConfig {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+
+  using TileShape = Shape<_256, _256, _32>;
+
+  using TiledMma =
+      TiledMMA<MMA_Atom<XE_8x16x16_F32F16F16F32_TT>,
+               Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>,
+               Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                    Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, _32>>;
+
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+    DispatchPolicy, TileShape,
+    ElementA, cutlass::gemm::TagToStrideA_t<LayoutA>,
+    ElementB, cutlass::gemm::TagToStrideB_t<LayoutB>,
+    TiledMma,
+    XE_2D_U8x32x32_LD_V, void, void, cute::identity,  // A
+    XE_2D_U8x32x32_LD_V, void, void, cute::identity   // B
+  >;
+
+  using EpilogueOp = cutlass::epilogue::fusion::LinearCombination<float, float>;
+
+  using FusionCallBacks = cutlass::epilogue::fusion::FusionCallbacks<
+    cutlass::epilogue::IntelPVCEpilogue,
+    EpilogueOp,
+    TileShape,
+    decltype(tile_shape(TiledMma()))
+  >;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+    cutlass::epilogue::IntelPVCEpilogue,
+    TileShape,
+    float, cutlass::gemm::TagToStrideC_t<LayoutC>,
+    float, cutlass::gemm::TagToStrideC_t<LayoutC>,
+    FusionCallBacks,
+    XE_2D_U32x8x16_LD_N, void, void,
+    XE_2D_U32x8x16_ST_N, void, void>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Runs D = A x B on an MxNxKxL problem whose mainloop applies scales, and compares D with a host reference.
+/// make_mainloop_args(ptr_A, dA, ptr_B, dB) returns the mainloop arguments, including the device scales, and
+/// scale(m, n, k, l) the factor the mainloop applies to the product A(m,k,l) * B(n,k,l).
+template <class Gemm, class MakeMainloopArgs, class Scale>
+bool TestXeScaledMainloop(int M, int N, int K, int L, MakeMainloopArgs make_mainloop_args, Scale scale) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementD = typename GemmKernel::ElementD;
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(M, K, L));
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(N, K, L));
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, cute::make_shape(M, N, L));
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(M, N, L));
+
+  // Small integers are exact in every 8-bit type, so the reference only differs from the kernel in the scales
+  std::mt19937 generator(2025);
+  std::uniform_int_distribution<int> distribution(-3, 3);
+  std::vector<ElementA> host_A(size_t(M) * K * L);
+  std::vector<ElementB> host_B(size_t(N) * K * L);
+  for (auto& a : host_A) { a = ElementA(float(distribution(generator))); }
+  for (auto& b : host_B) { b = ElementB(float(distribution(generator))); }
+
+  cutlass::DeviceAllocation<ElementA> block_A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> block_B(host_B.size());
+  cutlass::DeviceAllocation<ElementD> block_D(size_t(M) * N * L);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+
+  typename Gemm::Arguments arguments{
+    L > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    make_mainloop_args(block_A.get(), stride_A, block_B.get(), stride_B),
+    {{1.f, 0.f}, nullptr, stride_C, block_D.get(), stride_D}
+  };
+
+  Gemm gemm_op;
+  if (gemm_op.can_implement(arguments) != cutlass::Status::kSuccess) {
+    ADD_FAILURE() << "GEMM MNKL " << M << " " << N << " " << K << " " << L << " cannot be implemented";
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  EXPECT_EQ(gemm_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.run(), cutlass::Status::kSuccess);
+  try {
+    syclcompat::wait_and_throw();
+  } catch (std::exception const &e) {
+    ADD_FAILURE() << "Error at Kernel Sync.";
+    return false;
+  }
+
+  std::vector<ElementD> host_D(block_D.size());
+  block_D.copy_to_host(host_D.data());
+
+  auto tensor_A = make_tensor(host_A.data(), make_layout(make_shape(M, K, L), stride_A));
+  auto tensor_B = make_tensor(host_B.data(), make_layout(make_shape(N, K, L), stride_B));
+  auto tensor_D = make_tensor(host_D.data(), make_layout(make_shape(M, N, L), stride_D));
+
+  int errors = 0;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double reference = 0;
+        double magnitude = 0;
+        for (int k = 0; k < K; ++k) {
+          double term = double(float(tensor_A(m, k, l))) * double(float(tensor_B(n, k, l))) * double(scale(m, n, k, l));
+          reference += term;
+          magnitude += std::abs(term);
+        }
+        // The kernel rounds the scaled partial sums to fp32, so the tolerance follows the magnitude of the terms
+        double result = double(tensor_D(m, n, l));
+        if (std::abs(result - reference) > 1e-5 * std::max(1.0, magnitude) && errors++ < 8) {
+          ADD_FAILURE() << "D(" << m << ", " << n << ", " << l << ") = " << result << ", expected " << reference;
+        }
+      }
+    }
+  }
+  return errors == 0;
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
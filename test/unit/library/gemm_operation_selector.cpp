@@ -0,0 +1,297 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the ranking of GEMM operations by GemmOperationSelector
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/library/gemm_operation_selector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cutlass::library;
+
+/// Operation that only describes a bf16 x bf16 -> f32 GEMM, so that selection does not depend on the
+/// kernels generated into the library
+class MockGemmOperation : public Operation {
+public:
+
+  MockGemmOperation(
+    char const *name,
+    cutlass::gemm::GemmCoord threadblock_shape,
+    cutlass::gemm::GemmCoord warp_count,
+    int alignment_A = 8,
+    int alignment_B = 8,
+    int alignment_C = 4,
+    int minimum_compute_capability = 11,
+    int maximum_compute_capability = 11) {
+
+    description_.name = name;
+    description_.provider = Provider::kCUTLASS;
+    description_.kind = OperationKind::kGemm;
+    description_.tile_description = TileDescription(
+      threadblock_shape, 2, warp_count,
+      MathInstructionDescription({8, 16, 16}, NumericTypeID::kF32, OpcodeClassID::kTensorOp),
+      minimum_compute_capability, maximum_compute_capability);
+    description_.gemm_kind = GemmKind::kUniversal;
+    description_.A = TensorDescription(NumericTypeID::kBF16, LayoutTypeID::kRowMajor, alignment_A);
+    description_.B = TensorDescription(NumericTypeID::kBF16, LayoutTypeID::kRowMajor, alignment_B);
+    description_.C = TensorDescription(NumericTypeID::kF32, LayoutTypeID::kRowMajor, alignment_C);
+    description_.D = TensorDescription(NumericTypeID::kF32, LayoutTypeID::kRowMajor, alignment_C);
+    description_.element_epilogue = NumericTypeID::kF32;
+  }
+
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+  Status can_implement(void const *, void const *) const override {
+    return Status::kErrorNotSupported;
+  }
+
+  uint64_t get_host_workspace_size(void const *) const override {
+    return 0;
+  }
+
+  uint64_t get_device_workspace_size(void const *, void const *) const override {
+    return 0;
+  }
+
+  Status initialize(void const *, void *, void *, cudaStream_t) const override {
+    return Status::kErrorNotSupported;
+  }
+
+  Status run(void const *, void *, void *, cudaStream_t) const override {
+    return Status::kErrorNotSupported;
+  }
+
+private:
+
+  GemmDescription description_;
+};
+
+/// Selector for a device with 64 SMs (Xe-cores) of compute capability 11
+GemmOperationSelector make_selector() {
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = 64;
+  return GemmOperationSelector(hw_info, 11);
+}
+
+GemmSelectionProblem make_problem(int m, int n, int k, int batch_count = 1) {
+  GemmSelectionProblem problem;
+  problem.problem_size = cutlass::gemm::GemmCoord(m, n, k);
+  problem.batch_count = batch_count;
+  problem.alignment_A = 8;
+  problem.alignment_B = 8;
+  problem.alignment_C = 4;
+  return problem;
+}
+
+std::vector<std::string> operation_names(std::vector<GemmSelectionResult> const &results) {
+  std::vector<std::string> names;
+  for (GemmSelectionResult const &result : results) {
+    names.push_back(result.operation->description().name);
+  }
+  return names;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GemmOperationSelector, candidates_compute_capability) {
+  MockGemmOperation xe("xe", {256, 256, 32}, {8, 4, 1});
+  MockGemmOperation sm90("sm90", {256, 256, 32}, {8, 4, 1}, 8, 8, 4, 90, 90);
+  MockGemmOperation any("any", {256, 256, 32}, {8, 4, 1}, 8, 8, 4, 0, 1024);
+
+  GemmOperationSelector selector = make_selector();
+  std::vector<GemmSelectionResult> results = selector.rank({&xe, &sm90, &any}, make_problem(1024, 1024, 1024));
+
+  std::vector<std::string> names = operation_names(results);
+  EXPECT_EQ(names.size(), size_t(2));
+  EXPECT_NE(std::find(names.begin(), names.end(), "xe"), names.end());
+  EXPECT_NE(std::find(names.begin(), names.end(), "any"), names.end());
+}
+
+TEST(GemmOperationSelector, candidates_alignment) {
+  // Each operation requires more than the problem on exactly one operand
+  MockGemmOperation aligned("aligned", {256, 256, 32}, {8, 4, 1}, 8, 8, 4);
+  MockGemmOperation wide_A("wide_A", {256, 256, 32}, {8, 4, 1}, 16, 8, 4);
+  MockGemmOperation wide_B("wide_B", {256, 256, 32}, {8, 4, 1}, 8, 16, 4);
+  MockGemmOperation wide_C("wide_C", {256, 256, 32}, {8, 4, 1}, 8, 8, 8);
+
+  GemmOperationSelector selector = make_selector();
+  GemmSelectionProblem problem = make_problem(1024, 1024, 1024);
+
+  std::vector<GemmSelectionResult> results = selector.rank({&aligned, &wide_A, &wide_B, &wide_C}, problem);
+  ASSERT_EQ(results.size(), size_t(1));
+  EXPECT_EQ(results.front().operation, &aligned);
+
+  // Alignments are checked per operand: an A alignment of 16 does not make up for B or C
+  problem.alignment_A = 16;
+  results = selector.rank({&aligned, &wide_A, &wide_B, &wide_C}, problem);
+  std::vector<std::string> names = operation_names(results);
+  EXPECT_EQ(names.size(), size_t(2));
+  EXPECT_NE(std::find(names.begin(), names.end(), "wide_A"), names.end());
+  EXPECT_EQ(std::find(names.begin(), names.end(), "wide_B"), names.end());
+  EXPECT_EQ(std::find(names.begin(), names.end(), "wide_C"), names.end());
+
+  EXPECT_TRUE(selector.is_candidate(&wide_A, problem));
+  EXPECT_FALSE(selector.is_candidate(&wide_B, problem));
+  EXPECT_FALSE(selector.is_candidate(&wide_C, problem));
+}
+
+TEST(GemmOperationSelector, rank_by_problem_size) {
+  MockGemmOperation small("small", {64, 64, 32}, {2, 2, 1});
+  MockGemmOperation large("large", {256, 256, 32}, {8, 4, 1});
+
+  GemmOperationSelector selector = make_selector();
+
+  // A small problem only fills one large tile, but spreads over several small ones
+  std::vector<GemmSelectionResult> results = selector.rank({&large, &small}, make_problem(128, 128, 128));
+  ASSERT_EQ(results.size(), size_t(2));
+  EXPECT_EQ(results.front().operation, &small);
+  EXPECT_LE(results.front().runtime_us, results.back().runtime_us);
+
+  // A large problem fills the device either way, and large tiles have the higher arithmetic intensity
+  results = selector.rank({&small, &large}, make_problem(8192, 8192, 4096));
+  ASSERT_EQ(results.size(), size_t(2));
+  EXPECT_EQ(results.front().operation, &large);
+  EXPECT_GT(results.front().arithmetic_intensity, results.back().arithmetic_intensity);
+
+  for (GemmSelectionResult const &result : results) {
+    EXPECT_EQ(result.source, GemmSelectionSource::kAnalytic);
+    EXPECT_EQ(result.runtime_us, result.analytic_runtime_us);
+    EXPECT_GT(result.tile_efficiency, 0);
+    EXPECT_LE(result.tile_efficiency, 1);
+  }
+}
+
+TEST(GemmOperationSelector, runtime_sources) {
+  MockGemmOperation small("small", {64, 64, 32}, {2, 2, 1});
+  MockGemmOperation large("large", {256, 256, 32}, {8, 4, 1});
+
+  GemmOperationSelector selector = make_selector();
+  GemmSelectionProblem problem = make_problem(128, 128, 128);
+
+  // Profiled on this problem: the measured runtime is used and can change the order
+  selector.add_profiled_result("large", problem.problem_size, 1, 1.0);
+
+  std::vector<GemmSelectionResult> results = selector.rank({&small, &large}, problem);
+  ASSERT_EQ(results.size(), size_t(2));
+  EXPECT_EQ(results.front().operation, &large);
+  EXPECT_EQ(results.front().source, GemmSelectionSource::kProfiled);
+  EXPECT_EQ(results.front().runtime_us, 1.0);
+  EXPECT_EQ(results.back().source, GemmSelectionSource::kAnalytic);
+
+  // Profiled on another problem: the estimate is scaled by the measured/estimated ratio there
+  GemmSelectionProblem profiled_problem = make_problem(256, 256, 256);
+  double profiled_estimate_us = selector.estimate(&small, profiled_problem).analytic_runtime_us;
+  selector.add_profiled_result("small", profiled_problem.problem_size, 1, 2 * profiled_estimate_us);
+
+  GemmSelectionResult result = selector.rank({&small}, problem).front();
+  EXPECT_EQ(result.source, GemmSelectionSource::kCalibrated);
+  EXPECT_NEAR(result.runtime_us, 2 * result.analytic_runtime_us, 1e-6 * result.runtime_us);
+
+  // A newer result for the same problem replaces the previous one
+  selector.add_profiled_result("large", problem.problem_size, 1, 3.0);
+  EXPECT_EQ(selector.profiled_result_count(), size_t(2));
+  EXPECT_EQ(selector.rank({&large}, problem).front().runtime_us, 3.0);
+}
+
+TEST(GemmOperationSelector, csv_round_trip) {
+  MockGemmOperation small("small", {64, 64, 32}, {2, 2, 1});
+  MockGemmOperation large("large", {256, 256, 32}, {8, 4, 1});
+
+  std::string const path = "gemm_operation_selector_round_trip.csv";
+
+  GemmOperationSelector selector = make_selector();
+  selector.add_profiled_result("small", {128, 128, 128}, 1, 12.5);
+  selector.add_profiled_result("small", {1024, 512, 256}, 4, 250);
+  selector.add_profiled_result("large", {128, 128, 128}, 1, 20);
+  ASSERT_EQ(selector.save_profiled_results(path), Status::kSuccess);
+
+  GemmOperationSelector loaded = make_selector();
+  ASSERT_EQ(loaded.load_profiled_results(path), Status::kSuccess);
+  std::remove(path.c_str());
+
+  EXPECT_EQ(loaded.profiled_result_count(), size_t(3));
+
+  std::vector<GemmSelectionResult> results = loaded.rank({&small, &large}, make_problem(128, 128, 128));
+  ASSERT_EQ(results.size(), size_t(2));
+  EXPECT_EQ(results.front().operation, &small);
+  EXPECT_EQ(results.front().source, GemmSelectionSource::kProfiled);
+  EXPECT_NEAR(results.front().runtime_us, 12.5, 1e-3);
+  EXPECT_EQ(results.back().source, GemmSelectionSource::kProfiled);
+  EXPECT_NEAR(results.back().runtime_us, 20, 1e-3);
+
+  GemmSelectionResult batched = loaded.rank({&small}, make_problem(1024, 512, 256, 4)).front();
+  EXPECT_EQ(batched.source, GemmSelectionSource::kProfiled);
+  EXPECT_NEAR(batched.runtime_us, 250, 1e-3);
+}
+
+TEST(GemmOperationSelector, csv_profiler_output) {
+  std::string const path = "gemm_operation_selector_profiler_output.csv";
+
+  // Columns in the order of the profiler report, with runs that must be skipped
+  {
+    std::ofstream file(path);
+    file << "Problem,Provider,OperationKind,Operation,Disposition,Status,m,n,k,Runtime,GFLOPs\n";
+    file << "1,CUTLASS,gemm,small,passed,success,128,128,128,0.01,400\n";
+    file << "1,CUTLASS,gemm,large,incorrect,success,128,128,128,0.001,4000\n";
+    file << "1,CUTLASS,gemm,large,not_supported,error_not_supported,128,128,128,0,0\n";
+    file << "2,CUTLASS,gemm,large,passed,success,2048,2048,2048\n";
+  }
+
+  GemmOperationSelector selector = make_selector();
+  ASSERT_EQ(selector.load_profiled_results(path), Status::kSuccess);
+  std::remove(path.c_str());
+
+  EXPECT_EQ(selector.profiled_result_count(), size_t(1));
+
+  MockGemmOperation small("small", {64, 64, 32}, {2, 2, 1});
+  GemmSelectionResult result = selector.rank({&small}, make_problem(128, 128, 128)).front();
+  EXPECT_EQ(result.source, GemmSelectionSource::kProfiled);
+  EXPECT_NEAR(result.runtime_us, 10, 1e-6);
+
+  EXPECT_NE(selector.load_profiled_results("gemm_operation_selector_missing.csv"), Status::kSuccess);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,20 @@ template <> struct ArchMap<arch::Sm100, arch::OpClassTensorOp> {
   static int const kMax = 100;
 };
 
+#if defined(CUTLASS_ENABLE_SYCL)
+// Intel Xe kernels are generated with compute capability 11
+template <typename OperatorClass> struct ArchMap<arch::IntelPVC, OperatorClass> {
+  static int const kMin = 11;
+  static int const kMax = 11;
+};
+
+// Device agnostic kernels run on any SYCL device, which all report a compute capability of at least 1
+template <typename OperatorClass> struct ArchMap<arch::Agnostic, OperatorClass> {
+  static int const kMin = 1;
+  static int const kMax = 1024;
+};
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,243 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Ranks the GEMM operations of the library for a problem and selects the fastest one.
+
+    Candidates are the operations registered for a GemmFunctionalKey whose compute capability range and
+    alignment fit the device and problem. Each one is given an estimated runtime from an analytic model:
+
+      - tile efficiency: the fraction of the tiled M x N x K iteration space that is inside the problem
+      - wave quantization: the number of waves of workgroups over KernelHardwareInfo::sm_count SMs
+        (Xe-cores on Intel GPUs), and how full the last one is. Stream-K kernels split the work evenly instead
+      - arithmetic intensity: each tile runs at the slower of its MMA rate and the rate its A and B panels are
+        streamed in, and the whole kernel at least as long as moving the unique operand bytes through memory
+
+    Profiled runtimes, for example the CSV written by `cutlass_profiler --output`, can be loaded into the
+    selector. A kernel profiled on the same problem uses its measured runtime, one profiled on other problems
+    has its estimate scaled by the measured/estimated ratio of the nearest of them.
+*/
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/operation_table.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Per-SM throughput of the device, used to turn the analytic model into microseconds. The defaults
+/// describe one Xe-core of an Intel Data Center GPU Max (PVC) in large register file mode.
+struct GemmSelectionDeviceModel {
+
+  /// Core clock in MHz
+  double clock_mhz = 1600;
+
+  /// Dense multiply-adds per clock per SM for 16-bit operands. 8-bit operands run at twice this rate,
+  /// 32-bit operands at half of it.
+  double mma_per_clock_per_sm = 2048;
+
+  /// Bandwidth in GB/s at which one SM streams operand tiles, mostly served from the L2 cache
+  double operand_bandwidth_gbs_per_sm = 128;
+
+  /// Share of the global memory bandwidth in GB/s per SM
+  double memory_bandwidth_gbs_per_sm = 25.6;
+
+  /// Number of warps (subgroups) that can be resident on one SM
+  int max_warps_per_sm = 32;
+
+  /// Fixed cost of a kernel launch in microseconds
+  double launch_latency_us = 5;
+};
+
+/// Source of the runtime of a ranked operation
+enum class GemmSelectionSource {
+  kAnalytic,                  ///< Estimated by the analytic model
+  kCalibrated,                ///< Analytic estimate scaled by profiled runtimes on other problems
+  kProfiled,                  ///< Profiled on this problem
+  kInvalid
+};
+
+/// Problem to select a GEMM operation for
+struct GemmSelectionProblem {
+
+  /// Data types and layouts of the GEMM
+  GemmFunctionalKey functional_key{Provider::kCUTLASS, GemmKind::kUniversal};
+
+  /// GEMM M, N and K dimensions
+  gemm::GemmCoord problem_size{};
+
+  /// Number of GEMMs in the batch
+  int batch_count = 1;
+
+  /// Largest alignments in elements that A, B and C (and D) satisfy. Operations requiring more on any
+  /// operand are not candidates.
+  int alignment_A = 16;
+  int alignment_B = 16;
+  int alignment_C = 16;
+
+  /// Whether the source matrix C is read (beta != 0)
+  bool use_source = true;
+};
+
+/// Estimated runtime of one candidate operation
+struct GemmSelectionResult {
+
+  /// Candidate operation
+  Operation const *operation = nullptr;
+
+  /// Estimated or profiled runtime in microseconds
+  double runtime_us = 0;
+
+  /// Where runtime_us comes from
+  GemmSelectionSource source = GemmSelectionSource::kInvalid;
+
+  //
+  // Analytic model terms
+  //
+
+  /// Fraction of the tiled iteration space inside the problem
+  double tile_efficiency = 0;
+
+  /// Number of waves of workgroups over the device
+  double waves = 0;
+
+  /// Fraction of the workgroup slots of all waves that have work
+  double wave_efficiency = 0;
+
+  /// Multiply-adds (as two flops) per byte of A and B loaded by one tile
+  double arithmetic_intensity = 0;
+
+  /// Runtime estimated by the analytic model in microseconds
+  double analytic_runtime_us = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Ranks GEMM operations of the library Singleton for a problem
+class GemmOperationSelector {
+public:
+
+  /// Profiled runtime of an operation on one problem
+  struct ProfiledResult {
+    gemm::GemmCoord problem_size{};
+    int batch_count = 1;
+    double runtime_us = 0;
+  };
+
+private:
+
+  /// Device the operations are ranked for
+  KernelHardwareInfo hw_info_;
+
+  /// Compute capability of the device
+  int compute_capability_;
+
+  /// Throughput model of the device
+  GemmSelectionDeviceModel model_;
+
+  /// Profiled results keyed by operation name
+  std::unordered_map<std::string, std::vector<ProfiledResult>> profiled_results_;
+
+public:
+
+  /// Constructs a selector for a device
+  GemmOperationSelector(
+    KernelHardwareInfo const &hw_info,
+    int compute_capability,
+    GemmSelectionDeviceModel const &model = GemmSelectionDeviceModel());
+
+  /// Records the profiled runtime of an operation
+  void add_profiled_result(
+    std::string const &operation_name,
+    gemm::GemmCoord problem_size,
+    int batch_count,
+    double runtime_us);
+
+  /// Loads profiled results from a CSV file with a header line. Reads the Operation, m, n, k, batch_count
+  /// (optional) and Runtime (in ms) columns, as written by the profiler, and skips failed or incorrect runs.
+  Status load_profiled_results(std::string const &path);
+
+  /// Writes all profiled results to a CSV file that load_profiled_results() reads back
+  Status save_profiled_results(std::string const &path) const;
+
+  /// Returns the number of profiled results
+  size_t profiled_result_count() const;
+
+  /// Estimates the runtime of one GEMM operation on a problem with the analytic model only
+  GemmSelectionResult estimate(Operation const *operation, GemmSelectionProblem const &problem) const;
+
+  /// Returns the candidate operations of the library for a problem, fastest first
+  std::vector<GemmSelectionResult> rank(GemmSelectionProblem const &problem) const;
+
+  /// Returns the candidates among the given operations, fastest first. The operations are expected to
+  /// implement problem.functional_key, only their compute capability range and alignments are checked.
+  std::vector<GemmSelectionResult> rank(
+    std::vector<Operation const *> const &operations,
+    GemmSelectionProblem const &problem) const;
+
+  /// Returns whether an operation can run a problem on the device
+  bool is_candidate(Operation const *operation, GemmSelectionProblem const &problem) const;
+
+  /// Returns the fastest operation for a problem. The operation is null when there is no candidate.
+  GemmSelectionResult select(GemmSelectionProblem const &problem) const;
+
+private:
+
+  /// Ranks the given candidates for a problem
+  std::vector<GemmSelectionResult> rank_(
+    std::vector<Operation const *> const &candidates,
+    GemmSelectionProblem const &problem) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Converts a GemmSelectionSource enumerant to a string
+char const *to_string(GemmSelectionSource source, bool pretty = false);
+
+/// Prints the ranked operations
+std::ostream &operator<<(std::ostream &out, GemmSelectionResult const &result);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
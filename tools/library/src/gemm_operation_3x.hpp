@@ -42,7 +42,9 @@
 #include "library_internal.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/util/packed_stride.hpp"
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include "cutlass/util/mixed_dtype_utils.hpp"
+#endif
 #include "cutlass/util/device_memory.h"
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "cutlass/util/reference/device/tensor_compare.h"
@@ -262,6 +264,8 @@ protected:
     return false;
   }
 
+#if !defined(CUTLASS_ENABLE_SYCL)
+  // SM90 mixed input helpers: dequantization and reordering kernels are CUDA only
   template <
     typename ElementWide,
     typename ElementNarrow,
@@ -358,6 +362,7 @@ protected:
       }
     }
   }
+#endif
 
   /// Constructs the arguments structure given the configuration and arguments
   Status update_arguments_(
@@ -440,6 +445,7 @@ protected:
         arguments->ldc, arguments->batch_stride_C);
     operator_args.epilogue.dD = operator_args.epilogue.dC;
 
+#if !defined(CUTLASS_ENABLE_SYCL)
     using MainloopPolicy = typename CollectiveMainloop::DispatchPolicy;
     if constexpr(is_mixed_dtype_mainloop_(MainloopPolicy{})) {
       int problem_m = arguments->problem_size.m();
@@ -581,6 +587,7 @@ protected:
           operator_args, arguments, problem_m, problem_k, options_l);
       }
     } // End of "if constexpr(is_mixed_dtype_mainloop_(MainloopPolicy{}))"
+#endif
 
     /* Query device SM count and max active clusters to pass onto the kernel as an argument, where needed */
     operator_args.hw_info.sm_count = arguments->sm_count;
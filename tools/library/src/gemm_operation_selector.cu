@@ -0,0 +1,500 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Analytic and profile guided ranking of the GEMM operations of the library.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "cutlass/library/gemm_operation_selector.h"
+#include "cutlass/library/singleton.h"
+#include "cutlass/library/util.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  GemmSelectionSource enumerant;
+}
+GemmSelectionSource_enumerants[] = {
+  {"analytic", "Analytic", GemmSelectionSource::kAnalytic},
+  {"calibrated", "Calibrated", GemmSelectionSource::kCalibrated},
+  {"profiled", "Profiled", GemmSelectionSource::kProfiled},
+};
+
+/// Converts a GemmSelectionSource enumerant to a string
+char const *to_string(GemmSelectionSource source, bool pretty) {
+
+  for (auto const & possible : GemmSelectionSource_enumerants) {
+    if (source == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Prints the ranked operations
+std::ostream &operator<<(std::ostream &out, GemmSelectionResult const &result) {
+
+  out << (result.operation ? result.operation->description().name : "<none>")
+    << ": " << result.runtime_us << " us (" << to_string(result.source) << ")"
+    << ", tile efficiency " << result.tile_efficiency
+    << ", waves " << result.waves
+    << ", wave efficiency " << result.wave_efficiency
+    << ", arithmetic intensity " << result.arithmetic_intensity;
+
+  return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Stream-K kernels are named with a _stream_k tile scheduler suffix by the library generator
+static bool is_stream_k(GemmDescription const &desc) {
+  return std::string(desc.name).find("_stream_k") != std::string::npos;
+}
+
+/// Distance between two problems, on a log scale so that relative differences count
+static double problem_distance(
+  gemm::GemmCoord a, int batch_a,
+  gemm::GemmCoord b, int batch_b) {
+
+  auto term = [](int x, int y) {
+    return std::abs(std::log(double(std::max(x, 1))) - std::log(double(std::max(y, 1))));
+  };
+
+  return term(a.m(), b.m()) + term(a.n(), b.n()) + term(a.k(), b.k()) + term(batch_a, batch_b);
+}
+
+/// Splits one CSV line into its fields
+static std::vector<std::string> split_csv_line(std::string const &line) {
+
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+
+  while (std::getline(ss, field, ',')) {
+    if (!field.empty() && field.back() == '\r') {
+      field.pop_back();
+    }
+    fields.push_back(field);
+  }
+
+  return fields;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Constructs a selector for a device
+GemmOperationSelector::GemmOperationSelector(
+  KernelHardwareInfo const &hw_info,
+  int compute_capability,
+  GemmSelectionDeviceModel const &model
+):
+  hw_info_(hw_info),
+  compute_capability_(compute_capability),
+  model_(model) {
+
+}
+
+/// Records the profiled runtime of an operation
+void GemmOperationSelector::add_profiled_result(
+  std::string const &operation_name,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  double runtime_us) {
+
+  std::vector<ProfiledResult> &results = profiled_results_[operation_name];
+
+  // A result for the same problem replaces the previous one
+  for (ProfiledResult &result : results) {
+    if (result.problem_size == problem_size && result.batch_count == batch_count) {
+      result.runtime_us = runtime_us;
+      return;
+    }
+  }
+
+  results.push_back({problem_size, batch_count, runtime_us});
+}
+
+/// Loads profiled results from a CSV file
+Status GemmOperationSelector::load_profiled_results(std::string const &path) {
+
+  std::ifstream file(path);
+
+  if (!file.good()) {
+    return Status::kErrorInternal;
+  }
+
+  std::string line;
+
+  if (!std::getline(file, line)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  std::vector<std::string> header = split_csv_line(line);
+
+  auto column = [&](char const *name) -> int {
+    auto it = std::find(header.begin(), header.end(), name);
+    return it == header.end() ? -1 : int(it - header.begin());
+  };
+
+  int const operation_idx = column("Operation");
+  int const m_idx = column("m");
+  int const n_idx = column("n");
+  int const k_idx = column("k");
+  int const batch_count_idx = column("batch_count");
+  int const runtime_idx = column("Runtime");
+  int const status_idx = column("Status");
+  int const disposition_idx = column("Disposition");
+
+  if (operation_idx < 0 || m_idx < 0 || n_idx < 0 || k_idx < 0 || runtime_idx < 0) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  while (std::getline(file, line)) {
+
+    std::vector<std::string> fields = split_csv_line(line);
+
+    if (fields.size() != header.size()) {
+      continue;
+    }
+
+    if (status_idx >= 0 && fields[status_idx] != "success") {
+      continue;
+    }
+
+    if (disposition_idx >= 0 &&
+      (fields[disposition_idx] == "failed" || fields[disposition_idx] == "incorrect" ||
+       fields[disposition_idx] == "not_run" || fields[disposition_idx] == "not_supported")) {
+      continue;
+    }
+
+    try {
+      gemm::GemmCoord problem_size(
+        std::stoi(fields[m_idx]),
+        std::stoi(fields[n_idx]),
+        std::stoi(fields[k_idx]));
+
+      int batch_count = batch_count_idx >= 0 ? std::stoi(fields[batch_count_idx]) : 1;
+
+      // Runtimes are reported in milliseconds
+      double runtime_us = std::stod(fields[runtime_idx]) * 1000.0;
+
+      if (runtime_us > 0) {
+        add_profiled_result(fields[operation_idx], problem_size, batch_count, runtime_us);
+      }
+    }
+    catch (std::exception const &) {
+      continue;
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+/// Writes all profiled results to a CSV file
+Status GemmOperationSelector::save_profiled_results(std::string const &path) const {
+
+  std::ofstream file(path);
+
+  if (!file.good()) {
+    return Status::kErrorInternal;
+  }
+
+  file << "Operation,m,n,k,batch_count,Runtime\n";
+
+  for (auto const &entry : profiled_results_) {
+    for (ProfiledResult const &result : entry.second) {
+      file << entry.first
+        << "," << result.problem_size.m()
+        << "," << result.problem_size.n()
+        << "," << result.problem_size.k()
+        << "," << result.batch_count
+        << "," << result.runtime_us / 1000.0 << "\n";
+    }
+  }
+
+  return file.good() ? Status::kSuccess : Status::kErrorInternal;
+}
+
+/// Returns the number of profiled results
+size_t GemmOperationSelector::profiled_result_count() const {
+
+  size_t count = 0;
+  for (auto const &entry : profiled_results_) {
+    count += entry.second.size();
+  }
+  return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Estimates the runtime of one GEMM operation on a problem with the analytic model only
+GemmSelectionResult GemmOperationSelector::estimate(
+  Operation const *operation,
+  GemmSelectionProblem const &problem) const {
+
+  GemmDescription const &desc = static_cast<GemmDescription const &>(operation->description());
+
+  GemmSelectionResult result;
+  result.operation = operation;
+  result.source = GemmSelectionSource::kAnalytic;
+
+  double const M = std::max(problem.problem_size.m(), 1);
+  double const N = std::max(problem.problem_size.n(), 1);
+  double const K = std::max(problem.problem_size.k(), 1);
+  double const batch_count = std::max(problem.batch_count, 1);
+
+  double const tile_m = std::max(desc.tile_description.threadblock_shape.m(), 1);
+  double const tile_n = std::max(desc.tile_description.threadblock_shape.n(), 1);
+  double const tile_k = std::max(desc.tile_description.threadblock_shape.k(), 1);
+
+  double const tiles_m = std::ceil(M / tile_m);
+  double const tiles_n = std::ceil(N / tile_n);
+  double const k_iterations = std::ceil(K / tile_k);
+  double const tiles = tiles_m * tiles_n * batch_count;
+
+  result.tile_efficiency = (M * N * K) / (tiles_m * tile_m * tiles_n * tile_n * k_iterations * tile_k);
+
+  //
+  // Wave quantization
+  //
+
+  cutlass::gemm::GemmCoord const &warp_count = desc.tile_description.warp_count;
+  int const warps = std::max(warp_count.m() * warp_count.n() * warp_count.k(), 1);
+
+  // Workgroups resident on one SM, and workgroup slots on the device
+  double const occupancy = std::max(model_.max_warps_per_sm / warps, 1);
+  double const slots = std::max(hw_info_.sm_count, 1) * occupancy;
+
+  bool const stream_k = is_stream_k(desc);
+
+  if (stream_k) {
+    // Work is split evenly across the slots, down to one k-iteration per workgroup
+    result.waves = std::max(tiles / slots, 1.0 / k_iterations);
+  }
+  else {
+    result.waves = std::ceil(tiles / slots);
+  }
+  result.wave_efficiency = std::min(tiles / (result.waves * slots), 1.0);
+
+  //
+  // Tile runtime: the slower of the MMAs and streaming in the A and B panels
+  //
+
+  int const bits_A = library::sizeof_bits(desc.A.element);
+  int const bits_B = library::sizeof_bits(desc.B.element);
+  int const bits_C = problem.use_source ? library::sizeof_bits(desc.C.element) : 0;
+  int const bits_D = library::sizeof_bits(desc.D.element);
+  int const bits_accumulator = library::sizeof_bits(desc.tile_description.math_instruction.element_accumulator);
+
+  // Mixed input kernels run the MMA of the wider operand
+  int const bits_mma = std::max(std::max(bits_A, bits_B), 8);
+  double const mma_per_clock = model_.mma_per_clock_per_sm * 16.0 / bits_mma;
+
+  // MHz is clocks per microsecond and GB/s is 1000 bytes per microsecond
+  double const slot_mma_per_us = mma_per_clock * model_.clock_mhz / occupancy;
+  double const slot_bytes_per_us = model_.operand_bandwidth_gbs_per_sm * 1000.0 / occupancy;
+
+  double const tile_mma = tile_m * tile_n * k_iterations * tile_k;
+  double const tile_operand_bytes = (tile_m * bits_A + tile_n * bits_B) * k_iterations * tile_k / 8;
+  double const tile_epilogue_bytes = tile_m * tile_n * (bits_C + bits_D) / 8;
+
+  result.arithmetic_intensity = 2 * tile_mma / tile_operand_bytes;
+
+  double const tile_us =
+    std::max(tile_mma / slot_mma_per_us, tile_operand_bytes / slot_bytes_per_us) +
+    tile_epilogue_bytes / slot_bytes_per_us;
+
+  double kernel_us = result.waves * tile_us;
+
+  // Tiles split across workgroups write and read back partial accumulators
+  if (stream_k && std::fmod(tiles, slots) != 0) {
+    kernel_us += 2 * tile_m * tile_n * bits_accumulator / 8 / slot_bytes_per_us;
+  }
+
+  //
+  // Kernel runtime is bounded by moving the unique operand bytes through global memory
+  //
+
+  double const memory_bytes = batch_count * (M * K * bits_A + N * K * bits_B + M * N * (bits_C + bits_D)) / 8;
+  double const memory_us = memory_bytes /
+    (model_.memory_bandwidth_gbs_per_sm * 1000.0 * std::max(hw_info_.sm_count, 1));
+
+  result.analytic_runtime_us = model_.launch_latency_us + std::max(kernel_us, memory_us);
+  result.runtime_us = result.analytic_runtime_us;
+
+  return result;
+}
+
+/// Returns whether an operation can run a problem on the device
+bool GemmOperationSelector::is_candidate(Operation const *operation, GemmSelectionProblem const &problem) const {
+
+  GemmDescription const &desc = static_cast<GemmDescription const &>(operation->description());
+
+  int min_cc = desc.tile_description.minimum_compute_capability;
+  int max_cc = desc.tile_description.maximum_compute_capability;
+
+  return (min_cc <= compute_capability_) &&
+    (compute_capability_ <= max_cc) &&
+    (desc.A.alignment <= problem.alignment_A) &&
+    (desc.B.alignment <= problem.alignment_B) &&
+    (desc.C.alignment <= problem.alignment_C) &&
+    (desc.D.alignment <= problem.alignment_C);
+}
+
+/// Returns the candidate operations of the library for a problem, fastest first
+std::vector<GemmSelectionResult> GemmOperationSelector::rank(GemmSelectionProblem const &problem) const {
+
+  std::vector<Operation const *> operations;
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(problem.functional_key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return {};
+  }
+
+  for (auto const &preference : operators_it->second) {
+    operations.insert(operations.end(), preference.second.begin(), preference.second.end());
+  }
+
+  return rank(operations, problem);
+}
+
+/// Returns the candidates among the given operations, fastest first
+std::vector<GemmSelectionResult> GemmOperationSelector::rank(
+  std::vector<Operation const *> const &operations,
+  GemmSelectionProblem const &problem) const {
+
+  std::vector<Operation const *> candidates;
+
+  for (Operation const *operation : operations) {
+    if (is_candidate(operation, problem)) {
+      candidates.push_back(operation);
+    }
+  }
+
+  return rank_(candidates, problem);
+}
+
+/// Ranks the given candidates for a problem
+std::vector<GemmSelectionResult> GemmOperationSelector::rank_(
+  std::vector<Operation const *> const &candidates,
+  GemmSelectionProblem const &problem) const {
+
+  std::vector<GemmSelectionResult> results;
+  results.reserve(candidates.size());
+
+  for (Operation const *operation : candidates) {
+
+    GemmSelectionResult result = estimate(operation, problem);
+
+    auto profiled_it = profiled_results_.find(operation->description().name);
+
+    if (profiled_it != profiled_results_.end() && !profiled_it->second.empty()) {
+
+      // Nearest profiled problem of this operation
+      ProfiledResult const *nearest = nullptr;
+      double nearest_distance = 0;
+
+      for (ProfiledResult const &profiled : profiled_it->second) {
+        double distance = problem_distance(
+          problem.problem_size, problem.batch_count, profiled.problem_size, profiled.batch_count);
+
+        if (!nearest || distance < nearest_distance) {
+          nearest = &profiled;
+          nearest_distance = distance;
+        }
+      }
+
+      if (nearest_distance == 0) {
+        result.runtime_us = nearest->runtime_us;
+        result.source = GemmSelectionSource::kProfiled;
+      }
+      else {
+        GemmSelectionProblem nearest_problem = problem;
+        nearest_problem.problem_size = nearest->problem_size;
+        nearest_problem.batch_count = nearest->batch_count;
+
+        double nearest_estimate_us = estimate(operation, nearest_problem).analytic_runtime_us;
+
+        // Without a usable estimate for the profiled problem the analytic runtime is kept
+        if (nearest_estimate_us > 0) {
+          result.runtime_us = result.analytic_runtime_us * nearest->runtime_us / nearest_estimate_us;
+          result.source = GemmSelectionSource::kCalibrated;
+        }
+      }
+    }
+
+    results.push_back(result);
+  }
+
+  std::stable_sort(results.begin(), results.end(),
+    [](GemmSelectionResult const &lhs, GemmSelectionResult const &rhs) {
+      return lhs.runtime_us < rhs.runtime_us;
+    });
+
+  return results;
+}
+
+/// Returns the fastest operation for a problem
+GemmSelectionResult GemmOperationSelector::select(GemmSelectionProblem const &problem) const {
+
+  std::vector<GemmSelectionResult> results = rank(problem);
+
+  if (results.empty()) {
+    return GemmSelectionResult();
+  }
+
+  return results.front();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,8 +60,10 @@ Status Manifest::initialize() {
   // initialize manually instanced reference op in manifest object
   initialize_reference_operations(*this);
 
+#if !defined(CUTLASS_ENABLE_SYCL)
   // initialize manually instanced reduction reference op in manifest object
   initialize_all_reduction_op(*this);
+#endif
 
   return Status::kSuccess;
 }
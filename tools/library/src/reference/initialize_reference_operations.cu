@@ -78,6 +78,13 @@ void initialize_conv3d_reference_operations(Manifest &manifest);
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 void initialize_reference_operations(Manifest &manifest) {
+#if defined(CUTLASS_ENABLE_SYCL)
+  // Only the GEMM references used to verify the generated Xe and device agnostic kernels are built for SYCL
+  initialize_gemm_reference_operations_s8_s8_s32(manifest);
+  initialize_gemm_reference_operations_u8_u8_s32(manifest);
+  initialize_gemm_reference_operations_fp32out(manifest);
+  initialize_gemm_reference_operations_fp_mixed_input(manifest);
+#else
   initialize_conv2d_reference_operations(manifest);
   initialize_conv3d_reference_operations(manifest);
 
@@ -113,6 +120,7 @@ void initialize_reference_operations(Manifest &manifest) {
   initialize_block_scaled_gemm_reference_operations_fp4a_vs16(manifest);
   initialize_block_scaled_gemm_reference_operations_fp4a_vs32(manifest);
   initialize_block_scaled_gemm_reference_operations_mixed8bitsa(manifest);
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
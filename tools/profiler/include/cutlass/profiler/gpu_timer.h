@@ -34,7 +34,12 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include <memory>
+#include "cutlass/util/sycl_timer.hpp"
+#else
 #include <cuda_runtime.h>
+#endif
 #include "cutlass/cutlass.h"
 
 namespace cutlass {
@@ -42,9 +47,19 @@ namespace profiler {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(CUTLASS_ENABLE_SYCL)
+// There are no event record flags in SYCL, they are accepted and ignored
+constexpr unsigned int cudaEventRecordDefault = 0;
+constexpr unsigned int cudaEventRecordExternal = 1;
+#endif
+
 struct GpuTimer {
 
+#if defined(CUTLASS_ENABLE_SYCL)
+  std::unique_ptr<SYCLTimer> timer;
+#else
   cudaEvent_t events[2];
+#endif
 
   //
   // Methods
@@ -38,7 +38,9 @@
 #include <vector>
 #include <map>
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda_runtime.h>
+#endif
 
 #include "cutlass/util/command_line.h"
 #include "cutlass/util/distribution.h"
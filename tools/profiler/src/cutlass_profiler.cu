@@ -36,17 +36,19 @@
 #include <stdexcept>
 
 // Profiler includes
+#include "cutlass/profiler/cutlass_profiler.h"
+#include "cutlass/profiler/gemm_operation_profiler.h"
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include "cutlass/profiler/block_scaled_gemm_operation_profiler.h"
 #include "cutlass/profiler/conv2d_operation_profiler.h"
 #include "cutlass/profiler/conv3d_operation_profiler.h"
-#include "cutlass/profiler/cutlass_profiler.h"
-#include "cutlass/profiler/gemm_operation_profiler.h"
 #include "cutlass/profiler/grouped_gemm_operation_profiler.h"
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
 #include "cutlass/profiler/symm_operation_profiler.h"
 #include "cutlass/profiler/trmm_operation_profiler.h"
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +64,7 @@ CutlassProfiler::CutlassProfiler(
 
   operation_profilers_.emplace_back(new GemmOperationProfiler(options));
 
+#if !defined(CUTLASS_ENABLE_SYCL)
   operation_profilers_.emplace_back(new BlockScaledGemmOperationProfiler(options));   
 
   operation_profilers_.emplace_back(new SparseGemmOperationProfiler(options));
@@ -79,6 +82,7 @@ CutlassProfiler::CutlassProfiler(
   operation_profilers_.emplace_back(new SymmOperationProfiler(options));
 
   operation_profilers_.emplace_back(new GroupedGemmOperationProfiler(options));
+#endif
 }
 
 CutlassProfiler::~CutlassProfiler() {
@@ -39,8 +39,10 @@
 #include <vector>
 
 #include "cutlass/core_io.h"
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda_runtime_api.h>
 #include <cuda/atomic>
+#endif
 
 #include "cutlass/profiler/cublas_helpers.h"
 #include "cutlass/profiler/gemm_operation_profiler.h"
@@ -462,7 +464,12 @@ Status GemmOperationProfiler::initialize_configuration(
   for (size_t i = 0; i < device_count; ++i) {
     cudaSetDevice(options.device.device_id(i));
     gemm_workspace_.emplace_back();
+#if defined(CUTLASS_ENABLE_SYCL)
+    // Operations are enqueued on the default queue of the selected device
+    gemm_workspace_[i].stream = nullptr;
+#else
     cudaStreamCreateWithFlags(&gemm_workspace_[i].stream, cudaStreamNonBlocking);
+#endif
     gemm_workspace_[i].configuration.mode = problem_.mode;
     gemm_workspace_[i].configuration.problem_size.m() = int(problem_.m);
     gemm_workspace_[i].configuration.problem_size.n() = int(problem_.n);
@@ -43,6 +43,37 @@ namespace profiler {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(CUTLASS_ENABLE_SYCL)
+
+GpuTimer::GpuTimer(): timer(std::make_unique<SYCLTimer>()) { }
+
+GpuTimer::GpuTimer(GpuTimer&& gpu_timer) noexcept = default;
+
+GpuTimer::~GpuTimer() = default;
+
+/// Records a start event on the default queue, the flag is ignored
+void GpuTimer::start(cudaStream_t stream, const unsigned int flag) {
+  timer->start();
+}
+
+/// Records a stop event on the default queue, the flag is ignored
+void GpuTimer::stop(cudaStream_t stream, const unsigned int flag) {
+  timer->stop();
+}
+
+/// Records a stop event on the default queue and waits for it, the flag is ignored
+void GpuTimer::stop_and_wait(cudaStream_t stream, const unsigned int flag) {
+  stop(stream, flag);
+  syclcompat::get_default_queue().wait_and_throw();
+}
+
+/// Returns the duration in milliseconds
+double GpuTimer::duration(int iterations) const {
+  return double(timer->milliseconds()) / double(iterations);
+}
+
+#else
+
 GpuTimer::GpuTimer() {
   cudaError_t result;
 
@@ -116,6 +147,8 @@ double GpuTimer::duration(int iterations) const {
   return double(avg_ms) / double(iterations);
 }
 
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace profiler
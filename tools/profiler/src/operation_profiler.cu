@@ -47,7 +47,9 @@
 // sleep not supported
 #endif
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda/atomic>
+#endif
 
 #include "cutlass/profiler/options.h"
 #include "cutlass/profiler/operation_profiler.h"
@@ -681,6 +683,7 @@ void OperationProfiler::save_workspace(
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace {
+#if !defined(CUTLASS_ENABLE_SYCL)
 extern "C" {
 __global__ void delay(cuda::atomic<bool> const *release) {
   while (release->load(cuda::memory_order_acquire) != true) {
@@ -690,6 +693,7 @@ __global__ void delay(cuda::atomic<bool> const *release) {
   }
 }
 }
+#endif
 
 Status predict_iters(
   int &iterations,
@@ -738,6 +742,17 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
   std::function<Status(int, cudaStream_t, int)> const& func,
   std::vector<cudaStream_t> const& streams) {
 
+#if defined(CUTLASS_ENABLE_SYCL)
+  // SYCL has no graph capture, so multi-device interference runs are not supported and a
+  // single device is timed directly on its queue.
+  if (streams.size() != 1) {
+    return Status::kErrorNotSupported;
+  }
+  auto single_device_func = [&](cudaStream_t stream, int iteration) {
+    return func(0, stream, iteration);
+  };
+  return profile_kernel_no_cuda_graphs_(result, options, single_device_func, streams[0]);
+#else
   auto dev_count = streams.size();
 
   cuda::atomic<bool> *release;
@@ -840,6 +855,7 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
   }
 
   return Status::kSuccess;
+#endif
 }
 
 Status OperationProfiler::profile_kernel_(
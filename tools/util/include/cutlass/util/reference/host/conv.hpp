@@ -41,7 +41,9 @@
 
 #include "cute/tensor.hpp"
 
+#if !defined(CUTLASS_ENABLE_SYCL)
 #include <cuda_runtime.h>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 